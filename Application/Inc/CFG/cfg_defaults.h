@@ -18,6 +18,7 @@ extern "C" {
 #include "mess_main.h"
 #include "mess_error_correction.h"
 #include "mess_demodulate.h"
+#include "reed_solomon.h"
 
 /* Private includes ----------------------------------------------------------*/
 
@@ -37,6 +38,10 @@ extern "C" {
 #define MIN_OUTPUT_AMPLITUDE        (0.02f)
 #define MAX_OUTPUT_AMPLITUDE        (0.5f)
 
+#define DEFAULT_GFSK_BT             (0.0f)  // Frequency shaping off
+#define MIN_GFSK_BT                 (0.0f)  // Any other value below DAC_MIN_SHAPING_BT is raised to it
+#define MAX_GFSK_BT                 (1.0f)
+
 #define DEFAULT_MSG_START_FCN       (MSG_START_FREQUENCY)
 #define MIN_MSG_START_FCN           0
 #define MAX_MSG_START_FCN           (NUM_MSG_START_FCN - 1)
@@ -74,6 +79,10 @@ extern "C" {
 #define MIN_FHBFSK_NUM_TONES        2
 #define MAX_FHBFSK_NUM_TONES        30
 
+#define DEFAULT_MFSK_BITS           2   // 4-FSK
+#define MIN_MFSK_BITS               2
+#define MAX_MFSK_BITS               (DEMOD_MAX_BITS_PER_SYMBOL) // 16-FSK
+
 #define DEFAULT_EVAL_MODE_STATE     (false)
 #define MIN_EVAL_MODE_STATE         (false)
 #define MAX_EVAL_MODE_STATE         (true)
@@ -90,14 +99,69 @@ extern "C" {
 #define MIN_STATIONARY_FLAG         (false)
 #define MAX_STATIONARY_FLAG         (true)
 
+#define DEFAULT_PACKET_FORMAT       (PACKET_FORMAT_POWER_OF_TWO)
+#define MIN_PACKET_FORMAT           0
+#define MAX_PACKET_FORMAT           (NUM_PACKET_FORMATS - 1)
+
+#define DEFAULT_INTERLEAVER_DEPTH   1   // Bits sent in the order they were coded
+#define MIN_INTERLEAVER_DEPTH       1
+#define MAX_INTERLEAVER_DEPTH       64
+
+// Bit n set compresses the payloads of MessageData_t n
+#define DEFAULT_COMPRESSED_TYPES    0
+#define MIN_COMPRESSED_TYPES        0
+#define MAX_COMPRESSED_TYPES        ((1 << UNKNOWN) - 1)
+
 #define DEFAULT_ERROR_CORRECTION    (CRC_16)
 #define MIN_ERROR_CORRECTION        0
 #define MAX_ERROR_CORRECTION        (NUM_ERROR_CORRECTION_METHODS - 1)
 
+#define DEFAULT_RS_PARITY           16  // Corrects 8 bytes in error
+#define MIN_RS_PARITY               2
+#define MAX_RS_PARITY               (REED_SOLOMON_MAX_PARITY)
+
 #define DEFAULT_DEMOD_DECISION      (HISTORICAL_COMPARISON)
 #define MIN_DEMOD_DECISION          0
 #define MAX_DEMOD_DECISION          (NUM_DEMODULATION_DECISION - 1)
 
+#define DEFAULT_SOFT_OUTPUT         (true)
+#define MIN_SOFT_OUTPUT             (false)
+#define MAX_SOFT_OUTPUT             (true)
+
+#define DEFAULT_CHIRP_PREAMBLE      (false)
+#define MIN_CHIRP_PREAMBLE          (false)
+#define MAX_CHIRP_PREAMBLE          (true)
+
+#define DEFAULT_CHIRP_START_FREQ    29000
+#define DEFAULT_CHIRP_END_FREQ      33000
+
+#define DEFAULT_CHIRP_THRESHOLD     (0.4f)
+#define MIN_CHIRP_THRESHOLD         (0.1f)
+#define MAX_CHIRP_THRESHOLD         (0.95f)
+
+#define DEFAULT_CFAR_REFERENCE_CELLS  64
+#define MIN_CFAR_REFERENCE_CELLS      16
+#define MAX_CFAR_REFERENCE_CELLS      128
+
+#define DEFAULT_CFAR_PFA_EXPONENT   6   // False alarm probability of 10^-6 per cell
+#define MIN_CFAR_PFA_EXPONENT       2
+#define MAX_CFAR_PFA_EXPONENT       12
+
+#define DEFAULT_CAL_LOWER_FREQ      (MIN_FSK_FREQUENCY)
+#define DEFAULT_CAL_UPPER_FREQ      (MAX_FSK_FREQUENCY)
+
+#define DEFAULT_CAL_FREQ_STEP       500
+#define MIN_CAL_FREQ_STEP           250 // Keeps the full band within CALIBRATION_MAX_POINTS
+#define MAX_CAL_FREQ_STEP           5000
+
+#define DEFAULT_BURST_MODE          (false)
+#define MIN_BURST_MODE              (false)
+#define MAX_BURST_MODE              (true)
+
+#define DEFAULT_BURST_GAP_MS        20  // Silence between the messages of a burst
+#define MIN_BURST_GAP_MS            10  // Detection needs some quiet before a message starts
+#define MAX_BURST_GAP_MS            1000
+
 
 /* Exported macro ------------------------------------------------------------*/
 
@@ -41,6 +41,24 @@ typedef enum {
   PARAM_STATIONARY_FLAG,
   PARAM_ERROR_CORRECTION,
   PARAM_DEMODULATION_DECISION,
+  PARAM_CHIRP_PREAMBLE,
+  PARAM_CHIRP_START_FREQ,
+  PARAM_CHIRP_END_FREQ,
+  PARAM_CHIRP_THRESHOLD,
+  PARAM_CFAR_REFERENCE_CELLS,
+  PARAM_CFAR_PFA_EXPONENT,
+  PARAM_SOFT_OUTPUT,
+  PARAM_MFSK_BITS,
+  PARAM_GFSK_BT,
+  PARAM_CAL_LOWER_FREQ,
+  PARAM_CAL_UPPER_FREQ,
+  PARAM_CAL_FREQ_STEP,
+  PARAM_BURST_MODE,
+  PARAM_BURST_GAP,
+  PARAM_RS_PARITY,
+  PARAM_PACKET_FORMAT,
+  PARAM_INTERLEAVER_DEPTH,
+  PARAM_COMPRESSED_TYPES,
   // Add new parameters here and nowhere else
   NUM_PARAM
 } ParamIds_t;
@@ -42,6 +42,16 @@ typedef enum {
   MENU_ID_CFG_UNIV_FHBFSK_FSEP, // Integer frequency separation to use in the FHBFSK scheme
   MENU_ID_CFG_UNIV_FHBFSK_DWELL,// Number of bit periods to dwell on a tone in FHBFSK
   MENU_ID_CFG_UNIV_FHBFSK_TONES,// Number of tones to use in the FHBFSK modulations scheme
+  MENU_ID_CFG_UNIV_MFSK_BITS,   // Bits carried by each M-FSK symbol
+  MENU_ID_CFG_UNIV_GFSK_BT,     // Bandwidth-time product of the GFSK frequency shaping, 0 for none, at least 0.4 otherwise
+  MENU_ID_CFG_UNIV_RS_PARITY,   // Parity bytes added by Reed-Solomon error correction
+  MENU_ID_CFG_UNIV_PKT_FORMAT,  // Whether packet lengths are powers of two or exact byte counts
+  MENU_ID_CFG_UNIV_INTERLEAVE,  // Rows of the interleaver spreading bursts of errors over a packet
+  MENU_ID_CFG_UNIV_COMPRESS,    // Data types whose payloads are compressed before sending
+  MENU_ID_CFG_UNIV_CHIRP,       // Chirp preamble options
+  MENU_ID_CFG_UNIV_CHIRP_EN,    // Enable/disable the chirp sent ahead of each packet
+  MENU_ID_CFG_UNIV_CHIRP_START, // Frequency the chirp sweeps from
+  MENU_ID_CFG_UNIV_CHIRP_END,   // Frequency the chirp sweeps to
   MENU_ID_CFG_UNIV_BAUD,        // Raw baud rate used for transmission
   MENU_ID_CFG_UNIV_FC,          // Center frequency used 
   MENU_ID_CFG_UNIV_BP,          // Bit period used in the baud rate. Currently the inverse of ^^
@@ -75,6 +85,10 @@ typedef enum {
   MENU_ID_CFG_DEMOD_CAL_EXP,    // Export calibration results
   MENU_ID_CFG_DEMOD_START,      // Select the message start function to use
   MENU_ID_CFG_DEMOD_DECISION,   // Select the bit decision maker
+  MENU_ID_CFG_DEMOD_CHIRP,      // Correlation the chirp matched filter needs to detect a message
+  MENU_ID_CFG_DEMOD_CFAR_CELLS, // Reference cells CFAR averages the noise over
+  MENU_ID_CFG_DEMOD_CFAR_PFA,   // Exponent of the CFAR false alarm probability per cell
+  MENU_ID_CFG_DEMOD_SOFT,       // Toggle soft decision output for the decoders
   MENU_ID_CFG_DAU,              // Daughter card configuration options
   MENU_ID_CFG_DAU_UART,         // UART configuration
   MENU_ID_CFG_DAU_UART_BAUD,    // UART baud rate to use
@@ -117,6 +131,8 @@ typedef enum {
   MENU_ID_TXRX_FLOATOUT,        // Transmit a float through transducer
   MENU_ID_TXRX_FLOATFB,         // Transmit a float through feedback
   MENU_ID_TXRX_ENPNT,           // Enable/disable printing of waveforms as they are received
+  MENU_ID_TXRX_BURST,           // Enable/disable sending the queued messages as one burst
+  MENU_ID_TXRX_BURST_GAP,       // Silence between the messages of a burst
   MENU_ID_EVAL_TOGGLE,          // Toggle evaluation mode
   MENU_ID_EVAL_SETMSG,          // Set the message to compare to
   MENU_ID_EVAL_FEEDBACK,        // Send evaluation message through feedback network
@@ -32,6 +32,21 @@ extern "C" {
 
 #define ADC_SAMPLING_RATE         120000  // 120 kHz
 
+// 1: the input and feedback DMA streams write straight into their processing
+// buffers in ADC_BUFFER_SIZE / 2 slots, 0: half buffers are copied out of
+// adc_buffer
+#ifndef ADC_ZERO_COPY_INPUT
+#define ADC_ZERO_COPY_INPUT       1
+#endif
+
+// Processing buffer samples past the published data that may be in the
+// middle of being written, which processing can never catch up to
+#if ADC_ZERO_COPY_INPUT == 1
+#define ADC_WRITE_AHEAD           ADC_BUFFER_SIZE       // the two slots owned by the DMA
+#else
+#define ADC_WRITE_AHEAD           (ADC_BUFFER_SIZE / 2) // the half buffer being copied
+#endif
+
 /* Exported macro ------------------------------------------------------------*/
 
 extern ADC_HandleTypeDef hadc1;
@@ -77,7 +92,8 @@ bool ADC_RegisterFeedbackBuffer(uint16_t* fb_buffer);
  * @brief Starts ADC conversions on the input channel using DMA
  *
  * Resets the input buffer index, starts Timer 8, and initiates DMA-based
- * ADC conversions for the input channel.
+ * ADC conversions for the input channel. With ADC_ZERO_COPY_INPUT the DMA
+ * stream runs double-buffered directly over the registered input buffer.
  *
  * @return true if operation starts successfully, false otherwise
  */
@@ -88,6 +104,8 @@ bool ADC_StartInput();
  *
  * Resets the feedback buffer index and initiates DMA-based ADC conversions
  * for the feedback channel. Requires a feedback buffer to be registered first.
+ * With ADC_ZERO_COPY_INPUT the DMA stream runs double-buffered directly over
+ * the registered feedback buffer.
  *
  * @return true if operation starts successfully, false if feedback buffer is NULL or DMA fails
  *
@@ -109,6 +127,13 @@ bool ADC_StopFeedback();
  */
 bool ADC_StopInput();
 
+/**
+ * @brief Gets the number of input samples delivered since ADC_StartInput
+ *
+ * @return Sample counter published by the input DMA interrupt, wraps at 2^32
+ */
+uint32_t ADC_GetInputSampleCount();
+
 /**
  * @brief Stops all ADC conversions and resets buffer indices
  *
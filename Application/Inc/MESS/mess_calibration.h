@@ -14,6 +14,7 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h7xx_hal.h"
+#include <stdbool.h>
 
 
 /* Private includes ----------------------------------------------------------*/
@@ -26,7 +27,9 @@ extern "C" {
 
 /* Exported constants --------------------------------------------------------*/
 
-
+#define CALIBRATION_MAX_POINTS    64
+#define CALIBRATION_MIN_GAIN      0.25f // Limits on the pre-equalization of a tone
+#define CALIBRATION_MAX_GAIN      4.0f
 
 /* Exported macro ------------------------------------------------------------*/
 
@@ -34,7 +37,89 @@ extern "C" {
 
 /* Exported functions prototypes ---------------------------------------------*/
 
+/**
+ * @brief Registers the frequency range and step of the calibration sweep
+ *
+ * @return true if successful, false otherwise
+ */
+bool Calibration_RegisterParams(void);
 
+/**
+ * @brief Starts a calibration sweep over the configured frequency range
+ *
+ * The gain table in use is kept until the sweep finishes.
+ *
+ * @return true if the sweep was started, false if the range holds more than
+ *         CALIBRATION_MAX_POINTS frequencies
+ */
+bool Calibration_StartSweep(void);
+
+/**
+ * @brief Gets the frequency of the next point of the sweep to measure
+ *
+ * @param freq_hz Output for the frequency
+ *
+ * @return true if a point is left, false once every point has been recorded
+ */
+bool Calibration_GetSweepFrequency(uint32_t* freq_hz);
+
+/**
+ * @brief Records the amplitude measured at the current point of the sweep
+ *
+ * @param amplitude Amplitude of the feedback at the point's frequency
+ *
+ * @return true if recorded, false if no point is left
+ */
+bool Calibration_RecordPoint(float amplitude);
+
+/**
+ * @brief Turns the amplitudes of a completed sweep into the gain table in use
+ *
+ * Each gain brings its frequency's response to the average of the sweep,
+ * limited to CALIBRATION_MIN_GAIN to CALIBRATION_MAX_GAIN.
+ *
+ * @return true if the table was replaced, false if the sweep is incomplete or
+ *         measured no signal at a point
+ */
+bool Calibration_FinishSweep(void);
+
+/**
+ * @brief Discards the gain table so every frequency has a gain of 1
+ */
+void Calibration_Clear(void);
+
+/**
+ * @brief Gets the gain to apply to a tone
+ *
+ * Interpolated linearly between the points of the table and held at the
+ * first or last point outside it.
+ *
+ * @param freq_hz Frequency of the tone
+ *
+ * @return Gain relative to the output amplitude, 1 without a table
+ *
+ * @note Safe to call from interrupt context
+ */
+float Calibration_GetGain(uint32_t freq_hz);
+
+/**
+ * @brief Gets the number of points in the gain table in use
+ *
+ * @return Number of points, 0 without a table
+ */
+uint16_t Calibration_GetNumPoints(void);
+
+/**
+ * @brief Gets one point of the gain table in use
+ *
+ * @param index Index of the point, below Calibration_GetNumPoints
+ * @param freq_hz Output for the frequency of the point
+ * @param amplitude Output for the amplitude measured at it
+ * @param gain Output for its gain
+ *
+ * @return true if successful, false if index is out of range
+ */
+bool Calibration_GetPoint(uint16_t index, uint32_t* freq_hz, float* amplitude, float* gain);
 
 /* Private defines -----------------------------------------------------------*/
 
@@ -14,6 +14,7 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h7xx_hal.h"
+#include "mess_ofdm.h"
 #include <stdbool.h>
 
 
@@ -23,6 +24,9 @@ extern "C" {
 
 /* Exported types ------------------------------------------------------------*/
 
+#define DEMOD_MAX_BITS_PER_SYMBOL   4     // 16-FSK
+#define DEMOD_MAX_BITS_PER_BLOCK    OFDM_BITS_PER_SYMBOL // Every data carrier of an OFDM symbol
+
 typedef struct {
   uint16_t* data_buf;
   uint16_t buf_len;          // length of data_buf
@@ -31,10 +35,13 @@ typedef struct {
   uint16_t bit_index;
   bool decoded_bit;          // TODO: Change to have an undetermined state
   bool analysis_done;
-  uint32_t f0;
-  uint32_t f1;
-  float energy_f0;
-  float energy_f1;
+  uint32_t f0;               // For M-FSK the second strongest tone
+  uint32_t f1;               // For M-FSK the strongest tone
+  float energy_f0;           // For DPSK the energy of the previous symbol, for OFDM the noise of a carrier
+  float energy_f1;           // For DPSK the energy of this symbol, for OFDM the signal of a carrier
+  uint8_t num_bits;          // Bits decoded from the block, more than 1 for M-FSK, DQPSK and OFDM, 0 for a reference
+  uint8_t bits[DEMOD_MAX_BITS_PER_BLOCK]; // Decoded bits of 0 or 1 in the order they were sent
+  float llr[DEMOD_MAX_BITS_PER_BLOCK];    // Log-likelihood ratio of a 1 for each decoded bit
 } DemodulationInfo_t;
 
 typedef enum {
@@ -48,6 +55,8 @@ typedef enum {
 
 #define MAX_ANALYSIS_BUFFER_SIZE    32
 
+#define DEMOD_LLR_MAX               32.0f // Magnitude of a hard decision and limit of soft ones
+
 /* Exported macro ------------------------------------------------------------*/
 
 
@@ -58,11 +67,21 @@ typedef enum {
  * @brief Performs demodulation on the provided data
  *
  * Executes the appropriate demodulation algorithm based on the currently set
- * modulation method (FSK or FHBFSK). Then applies the selected decision method
- * to determine the decoded bit value.
+ * modulation method (FSK, FHBFSK, M-FSK, DBPSK, DQPSK or OFDM). For the binary
+ * FSK methods the selected decision method then determines the decoded bit
+ * value, M-FSK takes the strongest tone of the set. DBPSK and DQPSK compare the
+ * carrier phase of each symbol to the one before, the reference symbols at the
+ * start decode no bits. OFDM takes the FFT of the block after half the cyclic
+ * prefix, the training symbols at the start estimate the channel and decode
+ * no bits. With soft output enabled each bit's log-likelihood ratio is
+ * computed from the tone energies or symbol phases and running signal and
+ * noise estimates that restart with bit index 0, otherwise it is
+ * +/-DEMOD_LLR_MAX.
  *
  * @param data Pointer to demodulation data structure containing input samples
- *             and which will be updated with demodulation results
+ *             and which will be updated with demodulation results. bit_index
+ *             counts symbols, which are bits for the binary methods. DPSK
+ *             and OFDM symbols must be demodulated in order
  *
  * @return true if demodulation was successful, false otherwise
  *
@@ -75,8 +94,8 @@ bool Demodulate_Perform(DemodulationInfo_t* data);
 /**
  * @brief Registers demodulation parameters with the parameter management system
  *
- * Registers the decision method parameter to allow it to be accessed and
- * modified through the HMI interface.
+ * Registers the decision method and soft output parameters to allow them to be
+ * accessed and modified through the HMI interface.
  *
  * @return true if registration was successful, false otherwise
  *
@@ -31,6 +31,10 @@ typedef enum {
   CHECKSUM_8,
   CHECKSUM_16,
   CHECKSUM_32,
+  CONVOLUTIONAL_1_2,  // K=7 convolutional code over the data and a CRC-16
+  CONVOLUTIONAL_2_3,
+  CONVOLUTIONAL_3_4,
+  REED_SOLOMON,       // GF(256) code over the data and a CRC-16, PARAM_RS_PARITY bytes of parity
   NUM_ERROR_CORRECTION_METHODS
 } ErrorCorrectionMethod_t;
 
@@ -49,7 +53,9 @@ typedef enum {
  *
  * Calculates and appends CRC or checksum data to the bit message based on the
  * currently selected error correction method. Updates the final_length field
- * of the message accordingly.
+ * of the message accordingly. The convolutional methods append a CRC-16 and
+ * replace everything after the header with the encoded data and CRC. Reed-
+ * Solomon appends a CRC-16 and the parity bytes.
  *
  * @param bit_msg Pointer to the bit message to modify
  *
@@ -74,16 +80,35 @@ bool ErrorCorrection_AddCorrection(BitMessage_t* bit_msg);
  */
 bool ErrorCorrection_CheckCorrection(BitMessage_t* bit_msg, bool* error);
 
+/**
+ * @brief Corrects the errors of a fully received bit message
+ *
+ * For the convolutional methods, decodes everything after the header from
+ * the reliability of each received bit and puts the corrected data and CRC
+ * in its place, leaving the message as it would be with plain CRC-16. Reed-
+ * Solomon corrects the data and CRC bytes in place and drops the parity,
+ * or leaves them as received if there are too many errors. Does nothing for
+ * the methods that only detect errors. Call before the data is
+ * read out of the message and before ErrorCorrection_CheckCorrection.
+ *
+ * @param bit_msg Pointer to the received bit message
+ *
+ * @return true if successful, false if the message is too short for its
+ *         length field or the correction method is invalid
+ */
+bool ErrorCorrection_CorrectErrors(BitMessage_t* bit_msg);
+
 /**
  * @brief Gets the bit length of the current error correction method
  *
- * @param length Output parameter to receive the bit length of the
- *               current error correction method
+ * @param data_bits Number of data bits in the packet
+ * @param length Output parameter to receive the number of bits the current
+ *               error correction method adds to the header and data
  *
  * @return true if length was set successfully,
  *         false if the current correction method is invalid
  */
-bool ErrorCorrection_CheckLength(uint16_t* length);
+bool ErrorCorrection_CheckLength(uint16_t data_bits, uint16_t* length);
 
 /**
  * @brief Registers error correction parameters with the system
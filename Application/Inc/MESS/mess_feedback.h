@@ -35,9 +35,32 @@ extern "C" {
 
 /* Exported functions prototypes ---------------------------------------------*/
 
+/*
+ * The feedback capture keeps only the latest window of samples. Nothing
+ * consumes it while the ADC runs, so older samples are overwritten by design
+ * and are not counted as overruns.
+ */
+
 bool Feedback_Init();
 void Feedback_IncrementEndIndex();
-void Feedback_DumpData();
+
+/**
+ * @brief Empties the capture before the feedback ADC is started
+ */
+void Feedback_Reset();
+
+/**
+ * @brief Measures the amplitude of a test tone in the feedback capture
+ *
+ * Takes the strongest window of the tone's frequency near the end of the
+ * capture.
+ *
+ * @param freq_hz Frequency of the test tone
+ * @param amplitude Output for the peak amplitude in ADC codes
+ *
+ * @return true if successful, false if the capture is too short to measure
+ */
+bool Feedback_MeasureTone(uint32_t freq_hz, float* amplitude);
 
 /* Private defines -----------------------------------------------------------*/
 
@@ -0,0 +1,112 @@
+/*
+ * mess_goertzel.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef MESS_MESS_GOERTZEL_H_
+#define MESS_MESS_GOERTZEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+#include "cfg_defaults.h"
+#include <stdbool.h>
+
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+#define GOERTZEL_LANES          4   // Tones filtered together per pass over the samples
+#define GOERTZEL_MAX_TONES      (2 * MAX_FHBFSK_NUM_TONES) // Every FHBFSK tone, multiple of GOERTZEL_LANES
+
+/*
+ * Tone set for the Goertzel bank. Coefficients are computed once when the set
+ * changes instead of for every block.
+ */
+typedef struct {
+  uint16_t num_tones;
+  uint32_t frequencies[GOERTZEL_MAX_TONES];
+  float coeffs[GOERTZEL_MAX_TONES];
+} GoertzelBank_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Precomputes the Goertzel coefficients for a set of tones
+ *
+ * @param bank Bank to initialize
+ * @param frequencies Tone frequencies in Hertz
+ * @param num_tones Number of tones, at most GOERTZEL_MAX_TONES
+ * @param sample_rate Sampling rate of the data the bank will run on
+ *
+ * @return true if the tone set is valid
+ */
+bool Goertzel_InitBank(GoertzelBank_t* bank, const uint32_t* frequencies, uint16_t num_tones,
+                       uint32_t sample_rate);
+
+/**
+ * @brief Computes the energy of a range of bank tones over a block of a ring buffer
+ *
+ * All tones are filtered in one pass over the samples, GOERTZEL_LANES at a
+ * time. A block that does not wrap the ring is read as one contiguous run,
+ * otherwise as two.
+ *
+ * @param bank Initialized bank
+ * @param first_tone First tone of the bank to compute
+ * @param num_tones Number of consecutive tones to compute
+ * @param buffer Ring buffer of ADC samples
+ * @param buf_len Ring length, must be a power of 2
+ * @param start_index Index of the first sample of the block
+ * @param length Number of samples in the block
+ * @param energies Output with num_tones squared magnitudes
+ *
+ * @return true if the tone range and block are valid
+ */
+bool Goertzel_Compute(const GoertzelBank_t* bank, uint16_t first_tone, uint16_t num_tones,
+                      const uint16_t* buffer, uint16_t buf_len, uint16_t start_index, uint16_t length,
+                      float* energies);
+
+/**
+ * @brief Computes the energy of a range of bank tones over a block with its mean removed
+ *
+ * As Goertzel_Compute, but the mean of the block is taken off every sample
+ * first, so the leakage of a large DC offset does not swamp weak tones.
+ *
+ * @param bank Initialized bank
+ * @param first_tone First tone of the bank to compute
+ * @param num_tones Number of consecutive tones to compute
+ * @param buffer Ring buffer of ADC samples
+ * @param buf_len Ring length, must be a power of 2
+ * @param start_index Index of the first sample of the block
+ * @param length Number of samples in the block, not 0
+ * @param energies Output with num_tones squared magnitudes
+ *
+ * @return true if the tone range and block are valid
+ */
+bool Goertzel_ComputeWithoutMean(const GoertzelBank_t* bank, uint16_t first_tone, uint16_t num_tones,
+                                 const uint16_t* buffer, uint16_t buf_len, uint16_t start_index,
+                                 uint16_t length, float* energies);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MESS_MESS_GOERTZEL_H_ */
@@ -30,6 +30,9 @@ extern "C" {
 typedef enum {
   MSG_START_AMPLITUDE,
   MSG_START_FREQUENCY,
+  MSG_START_SLIDING_GOERTZEL,
+  MSG_START_CHIRP,
+  MSG_START_CFAR,
   NUM_MSG_START_FCN
 } MsgStartFunctions_t;
 
@@ -56,19 +59,57 @@ typedef enum {
 bool Input_Init();
 
 /**
- * @brief Increments the buffer end index after new ADC data has been received
+ * @brief Publishes a half ADC buffer of new samples to the processing ring
  *
- * Updates the circular buffer end pointer to incorporate newly received samples.
- *
- * @warning Does not currently check for buffer overflow conditions
+ * Called from the ADC interrupt. If the samples overwrote data that had not
+ * been processed yet the overrun is counted and picked up by
+ * Input_CheckOverrun().
  */
 void Input_IncrementEndIndex();
 
+/**
+ * @brief Checks if the ADC lapped the processing since the last check
+ *
+ * Moves processing onto the oldest intact data and drops the detector
+ * history, which no longer lines up with the buffer.
+ *
+ * @return true if samples were lost since the last call
+ */
+bool Input_CheckOverrun();
+
+/**
+ * @brief Gets the number of input buffer overruns since initialization
+ *
+ * @return Times the ADC overwrote unprocessed samples
+ */
+uint32_t Input_GetOverruns();
+
+/**
+ * @brief Gets the number of input samples lost to overruns since initialization
+ *
+ * @return Unprocessed samples overwritten by the ADC
+ */
+uint32_t Input_GetLostSamples();
+
+/**
+ * @brief Gets the number of packet headers rejected since initialization
+ *
+ * @return Headers with more bits in error than their Golay code corrects
+ */
+uint32_t Input_GetHeaderRejects();
+
 /**
  * @brief Detects the start of an acoustic message in the input stream
  *
- * Applies the currently configured detection method (amplitude or frequency-based)
- * to determine if a valid message transmission has begun.
+ * Applies the currently configured detection method (amplitude, overlapping
+ * FFTs, sliding Goertzel, chirp matched filter or CFAR) to determine if a
+ * valid message transmission has begun. The overlapping FFT and sliding
+ * Goertzel methods apply the same fixed start conditions to the same analysis
+ * bins and differ only in how the bins are computed. The CFAR method uses the
+ * same FFT bins but compares them against a threshold scaled from the noise
+ * measured in the preceding cells. The chirp matched filter requires the
+ * transmitter to send the chirp preamble and places the start on the first
+ * sample after it.
  *
  * @return true if a message start is detected, false otherwise
  */
@@ -103,7 +144,10 @@ bool Input_ProcessBlocks(BitMessage_t* bit_msg, EvalMessageInfo_t* eval_info);
  * @brief Decodes header information from accumulated bits
  *
  * Attempts to extract message header fields (sender ID, data type, length, etc.)
- * once sufficient bits have been received.
+ * once sufficient bits have been received. The header is corrected with its
+ * Golay(24,12) parity first. A header with more errors than that corrects
+ * sets header_rejected instead, so reception can stop without waiting for
+ * a length that can't be trusted.
  *
  * @param bit_msg Pointer to the bit message structure containing received bits
  * @param evaluation_mode If true, bypasses header decoding (no header in evaluation mode)
@@ -116,7 +160,9 @@ bool Input_DecodeBits(BitMessage_t* bit_msg, bool evaluation_mode);
  * @brief Extracts payload data from bit message into a structured message
  *
  * Converts the stream of bits in the bit message into bytes and copies them
- * to the message data field.
+ * to the message data field. A compressed payload is decompressed, which
+ * sets the message length to the original one. If it can't be, the bytes
+ * are left as received and error_correction_error is set.
  *
  * @param input_bit_msg Pointer to the bit message containing the encoded data
  * @param msg Pointer to message structure where decoded data will be stored
@@ -135,6 +181,25 @@ bool Input_DecodeMessage(BitMessage_t* input_bit_msg, Message_t* msg);
  */
 void Input_Reset();
 
+/**
+ * @brief Restarts the search for a message from the next unread sample
+ *
+ * Clears the analysis and detector state like Input_Reset but leaves the
+ * buffer and its indices alone, so it can be used with the ADC running and
+ * nothing that has arrived since is lost.
+ */
+void Input_Resume();
+
+/**
+ * @brief Returns the correlation peak quality of the last chirp detection
+ *
+ * The quality is the normalized correlation between the received chirp and
+ * the reference at the detected start, from 0 to 1.
+ *
+ * @return Peak quality, or 0 if no chirp has been detected yet
+ */
+float Input_GetSyncQuality();
+
 /**
  * @brief Transmits current buffer data over USB for noise analysis
  *
@@ -148,7 +213,8 @@ void Input_PrintNoise();
 /**
  * @brief Registers module parameters with the parameter system
  *
- * Makes the message start function parameter accessible via the HMI interface.
+ * Makes the message start function, CFAR and chirp threshold parameters
+ * accessible via the HMI interface.
  *
  * @return true if parameter registration succeeds, false otherwise
  */
@@ -32,18 +32,28 @@ extern "C" {
 #define PACKET_LENGTH_BITS                3
 #define PACKET_STATIONARY_BITS            1
 
-#define PACKET_PREAMBLE_LENGTH_BITS       (PACKET_SENDER_ID_BITS + \
+// Set in the message type field when the payload was compressed, above every
+// data type sent
+#define PACKET_COMPRESSED_FLAG            (1 << (PACKET_MESSAGE_TYPE_BITS - 1))
+
+#define PACKET_HEADER_FIELD_BITS          (PACKET_SENDER_ID_BITS + \
                                            PACKET_MESSAGE_TYPE_BITS + \
                                            PACKET_LENGTH_BITS + \
                                            PACKET_STATIONARY_BITS)
+// Golay(24,12) parity over the header fields, sent right after them
+#define PACKET_HEADER_PARITY_BITS         12
+#define PACKET_PREAMBLE_LENGTH_BITS       (PACKET_HEADER_FIELD_BITS + \
+                                           PACKET_HEADER_PARITY_BITS)
+// Golay coded byte count that follows the header of longer byte-exact packets
+#define PACKET_LENGTH_EXTENSION_BITS      24
+#define PACKET_MAX_PREAMBLE_LENGTH_BITS   (PACKET_PREAMBLE_LENGTH_BITS + \
+                                           PACKET_LENGTH_EXTENSION_BITS)
 
 #define PACKET_DATA_MIN_LENGTH_BITS       (8 * 1)   // If the packet length is 0
 #define PACKET_DATA_MAX_LENGTH_BITS       (8 * 128) // If the packet length is 7
-#define PACKET_MAX_ERROR_CORRECTION_BITS  32
-#define PACKET_MAX_LENGTH_BITS            (PACKET_SENDER_ID_BITS + \
-                                           PACKET_MESSAGE_TYPE_BITS + \
-                                           PACKET_LENGTH_BITS + \
-                                           PACKET_STATIONARY_BITS + \
+// Rate 1/2 convolutional code over the data, its CRC-16 and the 6 tail bits
+#define PACKET_MAX_ERROR_CORRECTION_BITS  (PACKET_DATA_MAX_LENGTH_BITS + 2 * (16 + 6))
+#define PACKET_MAX_LENGTH_BITS            (PACKET_MAX_PREAMBLE_LENGTH_BITS + \
                                            PACKET_DATA_MAX_LENGTH_BITS + \
                                            PACKET_MAX_ERROR_CORRECTION_BITS)
 
@@ -73,6 +83,10 @@ typedef enum {
 typedef enum {
   MOD_DEMOD_FSK,
   MOD_DEMOD_FHBFSK,
+  MOD_DEMOD_MFSK,
+  MOD_DEMOD_DBPSK,
+  MOD_DEMOD_DQPSK,
+  MOD_DEMOD_OFDM,
   NUM_MOD_DEMOD_METHODS
 } ModDemodMethod_t;
 
@@ -111,14 +125,34 @@ typedef struct {
 #define DAC_CHANNEL_TRANSDUCER  DAC_CHANNEL_1
 #define DAC_CHANNEL_FEEDBACK    DAC_CHANNEL_2
 
+// The chirp is sent as constant frequency steps of the shortest duration the
+// DAC sequencer supports so it can be output as waveform steps
+#define CHIRP_PREAMBLE_STEPS    20
+#define CHIRP_STEP_DURATION_US  250
 
+// Unmodulated carrier sent ahead of a DBPSK or DQPSK message as the phase the
+// first symbol is compared to
+#define DPSK_REFERENCE_SYMBOLS  1
+
+
+// The request flags are set in print_event_handle and stay set until the MESS
+// task handles them. Every flag is also a thread flag of the MESS task, set
+// by MESS_NotifyTask, which is what the task blocks on.
 typedef enum {
   MESS_PRINT_REQUEST = 0x01,
   MESS_PRINT_COMPLETE = 0x02,
   MESS_TEST_OUTPUT = 0x04,
-  MESS_FREQ_RESP = 0x08
+  MESS_FREQ_RESP = 0x08,
+  MESS_ADC_DATA = 0x10,       // Input ADC half buffer copied to the input buffer
+  MESS_DAC_COMPLETE = 0x20,   // Waveform sequence finished
+  MESS_TX_QUEUED = 0x40,      // Message added to the TX queue
+  MESS_STATE_CHANGED = 0x80   // Task state changed so the new state runs once
 } MessageFlags_t;
 
+#define MESS_REQUEST_EVENTS     (MESS_PRINT_REQUEST | MESS_TEST_OUTPUT | MESS_FREQ_RESP)
+#define MESS_TASK_EVENTS        (MESS_ADC_DATA | MESS_DAC_COMPLETE | MESS_TX_QUEUED | \
+                                 MESS_STATE_CHANGED)
+
 /* Exported macro ------------------------------------------------------------*/
 
 extern QueueHandle_t tx_queue; // Messages to send
@@ -131,6 +165,10 @@ extern uint32_t fc;
 extern uint8_t fhbfsk_freq_spacing;
 extern uint8_t fhbfsk_num_tones;
 extern uint8_t fhbfsk_dwell_time;
+extern uint8_t mfsk_bits_per_symbol;
+extern bool chirp_preamble;
+extern uint32_t chirp_start_freq;
+extern uint32_t chirp_end_freq;
 
 /* Exported functions prototypes ---------------------------------------------*/
 
@@ -175,7 +213,7 @@ void MESS_InitializeQueues(void);
 BaseType_t MESS_GetMessageFromTxQ(Message_t* msg);
 
 /**
- * @brief Add a message to the transmission queue
+ * @brief Add a message to the transmission queue and wake the MESS task
  *
  * @param msg Pointer to Message_t structure containing the message to transmit
  *
@@ -207,15 +245,31 @@ BaseType_t MESS_GetMessageFromRxQ(Message_t* msg);
  */
 BaseType_t MESS_AddMessageToRxQ(Message_t* msg);
 
+/**
+ * @brief Wakes the MESS task with the given events
+ *
+ * The task blocks until one of the events it is interested in is set, so
+ * anything that produces work for it must call this. A request must also be
+ * set in print_event_handle, where it stays until it is handled.
+ *
+ * @param events One or more of the flags in MessageFlags_t
+ *
+ * @note Safe to call from interrupt context. The events are set as thread
+ *       flags, which notify the task directly. Event flags set from an
+ *       interrupt go through the timer task, which can drop them.
+ */
+void MESS_NotifyTask(uint32_t events);
+
 /**
  * @brief Adjust baud rate to conform to hardware constraints
  *
- * Rounds the baud rate to ensure it aligns with DAC buffer size requirements.
- * This ensures that symbol lengths are compatible with the DAC's buffering system.
+ * Rounds the baud rate to a whole number of hertz. Symbol boundaries can fall
+ * anywhere in a DAC half buffer and the receiver keeps a fractional symbol
+ * clock, so any whole rate is allowed.
  *
  * @param baud Pointer to float containing baud rate to adjust (modified in-place)
  *
- * @note Ensures symbols have a duration that is a multiple of half the DAC buffer size
+ * @note The FHBFSK and M-FSK tones are spaced by whole multiples of the baud rate
  */
 void MESS_RoundBaud(float* baud);
 
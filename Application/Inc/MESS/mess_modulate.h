@@ -28,7 +28,7 @@ extern "C" {
 
 /* Exported constants --------------------------------------------------------*/
 
-
+#define MODULATE_MAX_BURST_MESSAGES   MSG_QUEUE_SIZE // Enough for a full transmit queue
 
 /* Exported macro ------------------------------------------------------------*/
 
@@ -37,42 +37,69 @@ extern "C" {
 /* Exported functions prototypes ---------------------------------------------*/
 
 /**
- * @brief Converts bit message to frequency sequence using the configured modulation method
+ * @brief Sets the DAC up to send a message with the configured modulation method
+ *
+ * The message is copied and nothing else is prepared, the DAC pulls each
+ * step of the chirp preamble, if it is enabled, and of the message as it
+ * needs them. FSK, FHBFSK, M-FSK, DBPSK and DQPSK send one waveform step per
+ * symbol at the baud rate and output amplitude, see Modulate_GetSymbolCount.
+ * With a nonzero GFSK bandwidth-time product the frequency moves between
+ * symbols through a Gaussian filter instead of jumping.
+ * OFDM is not a tone per step, its training and data symbols are generated as
+ * samples instead.
  *
- * Maps bits to appropriate frequencies according to the selected modulation scheme
- * (FSK or FHBFSK) by delegating to the corresponding conversion function.
+ * @param bit_msg Message to send
  *
- * @param bit_msg Pointer to bit message structure to be converted
- * @param message_sequence Pointer to output waveform step array to store the result
+ * @return true if successful, false if the tones or carriers do not fit in
+ *         the band or the baud rate does not suit the DAC
  *
- * @return true if conversion was successful, false otherwise
+ * @see DAC_SetStepSource
+ * @see DAC_SetSampleSource
+ */
+bool Modulate_SetMessageSource(BitMessage_t* bit_msg);
+
+/**
+ * @brief Empties the list of messages to be sent as a burst
  */
-bool Modulate_ConvertToFrequency(BitMessage_t* bit_msg, WaveformStep_t* message_sequence);
+void Modulate_ClearBurst(void);
 
 /**
- * @brief Applies the configured amplitude to all waveform steps in the sequence
+ * @brief Adds a message to the end of the burst
  *
- * Sets the relative_amplitude field of each waveform step to the global output_amplitude value.
+ * Only the bits of the message are copied.
  *
- * @param message_sequence Pointer to waveform step array
- * @param len Number of steps in the sequence
+ * @param bit_msg Message to send
  *
- * @return true if operation was successful
+ * @return true if successful, false if the burst already holds
+ *         MODULATE_MAX_BURST_MESSAGES messages
  */
-bool Modulate_ApplyAmplitude(WaveformStep_t* message_sequence, uint16_t len);
+bool Modulate_AddToBurst(BitMessage_t* bit_msg);
 
 /**
- * @brief Sets duration for all waveform steps based on the configured baud rate
+ * @brief Sets the DAC up to send the messages of the burst back to back
  *
- * Calculates step duration in microseconds as 1,000,000/baud_rate and applies
- * it to each waveform step in the sequence.
+ * Each message is sent as Modulate_SetMessageSource would send it, chirp
+ * preamble included, and is followed by gap_ms of silence before the next
+ * one. The whole burst is a single DAC output so the transducer is only
+ * switched in and out once.
  *
- * @param message_sequence Pointer to waveform step array
- * @param len Number of steps in the sequence
+ * @param gap_ms Silence between one message and the next in milli seconds
  *
- * @return true if operation was successful
+ * @return true if successful, false if the burst is empty or as
+ *         Modulate_SetMessageSource
+ *
+ * @see Modulate_AddToBurst
  */
-bool Modulate_ApplyDuration(WaveformStep_t* message_sequence, uint16_t len);
+bool Modulate_SetBurstSource(uint32_t gap_ms);
+
+/**
+ * @brief Calculates the frequency of one step of the chirp preamble
+ *
+ * @param step_index Index of the step, from 0 to CHIRP_PREAMBLE_STEPS - 1
+ *
+ * @return Frequency of the step in Hz
+ */
+uint32_t Modulate_GetChirpFrequency(uint16_t step_index);
 
 /**
  * @brief Returns the current transducer output amplitude setting
@@ -136,11 +163,117 @@ void Modulate_TestFrequencyResponse();
  */
 uint32_t Modulate_GetFhbfskFrequency(bool bit, uint16_t bit_index);
 
+/**
+ * @brief Gets the position of a bit's frequency in the FHBFSK tone set
+ *
+ * Tones are numbered from the lowest frequency up, the 0 and 1 tones of a hop
+ * are adjacent with the 0 tone at an even index.
+ *
+ * @param bit The bit value (0 or 1)
+ * @param bit_index The position of the bit in the message
+ *
+ * @return Tone index from 0 to 2 * fhbfsk_num_tones - 1
+ */
+uint16_t Modulate_GetFhbfskToneIndex(bool bit, uint16_t bit_index);
+
+/**
+ * @brief Gets the frequency of a tone in the FHBFSK tone set
+ *
+ * @param tone_index Tone index from 0 to 2 * fhbfsk_num_tones - 1
+ *
+ * @return The tone frequency in Hertz
+ */
+uint32_t Modulate_GetFhbfskToneFrequency(uint16_t tone_index);
+
+/**
+ * @brief Gets the number of bits carried by each symbol of the current method
+ *
+ * @return mfsk_bits_per_symbol for M-FSK, 2 for DQPSK, OFDM_BITS_PER_SYMBOL
+ *         for OFDM, 1 for the binary methods
+ */
+uint8_t Modulate_GetBitsPerSymbol(void);
+
+/**
+ * @brief Gets the number of symbols needed to send a number of bits
+ *
+ * The last M-FSK, DQPSK or OFDM symbol is padded with 0 bits. The
+ * differential methods also count their reference symbols and OFDM its
+ * training symbols.
+ *
+ * @param bit_count Number of bits to send
+ *
+ * @return The number of symbols
+ */
+uint16_t Modulate_GetSymbolCount(uint16_t bit_count);
+
+/**
+ * @brief Gets the number of symbols sent per second by the current method
+ *
+ * @return The baud rate, or the rate of OFDM symbols with their cyclic prefix
+ */
+float Modulate_GetSymbolRate(void);
+
+/**
+ * @brief Checks whether the current method encodes symbols as phase differences
+ *
+ * Differential methods send DPSK_REFERENCE_SYMBOLS unmodulated symbols first,
+ * which carry no bits.
+ *
+ * @return true for DBPSK and DQPSK
+ */
+bool Modulate_IsDifferential(void);
+
+/**
+ * @brief Gets the carrier phase jump that sends a DBPSK or DQPSK symbol
+ *
+ * DBPSK sends a 1 as a half cycle jump. DQPSK Gray codes its symbols onto
+ * quarter cycle jumps: 00, 01, 11 and 10 are 0, 1, 2 and 3 quarters.
+ *
+ * @param symbol The symbol bits, first bit in the most significant position
+ *
+ * @return The jump in quarter cycles, from 0 to 3
+ */
+uint8_t Modulate_GetDpskPhaseQuarters(uint8_t symbol);
+
+/**
+ * @brief Gets the M-FSK tone that carries a symbol
+ *
+ * Symbols are Gray coded onto the tones so that mistaking a tone for one of
+ * its neighbours only flips a single bit.
+ *
+ * @param symbol The symbol bits, first bit in the most significant position
+ *
+ * @return Tone index from 0 to 2^mfsk_bits_per_symbol - 1
+ */
+uint16_t Modulate_GetMfskToneIndex(uint16_t symbol);
+
+/**
+ * @brief Gets the symbol carried by an M-FSK tone
+ *
+ * @param tone_index Tone index from 0 to 2^mfsk_bits_per_symbol - 1
+ *
+ * @return The symbol bits, first bit in the most significant position
+ */
+uint16_t Modulate_GetMfskSymbol(uint16_t tone_index);
+
+/**
+ * @brief Gets the frequency of a tone in the M-FSK tone set
+ *
+ * The tones are spaced by the baud rate, the closest spacing at which they stay
+ * orthogonal over a symbol, and centred on fc.
+ *
+ * @param tone_index Tone index from 0 to 2^mfsk_bits_per_symbol - 1
+ *
+ * @return The tone frequency in Hertz
+ */
+uint32_t Modulate_GetMfskToneFrequency(uint16_t tone_index);
+
 /**
  * @brief Registers modulation parameters with the parameter system for HMI access
  *
- * Registers output amplitude with appropriate min/max constraints to make
- * it available for configuration through the system's HMI.
+ * Registers output amplitude and the GFSK bandwidth-time product with
+ * appropriate min/max constraints to make them available for configuration
+ * through the system's HMI.
  *
  * @return true if all parameters registered successfully, false otherwise
  */
@@ -0,0 +1,107 @@
+/*
+ * mess_ofdm.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef MESS_MESS_OFDM_H_
+#define MESS_MESS_OFDM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+#include <stdbool.h>
+
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+
+
+/* Exported constants --------------------------------------------------------*/
+
+#define OFDM_FFT_SIZE             512   // 234.375 Hz carrier spacing at ADC_SAMPLING_RATE
+#define OFDM_CP_LENGTH            256   // 2.1 ms of multipath delay absorbed by the cyclic prefix
+#define OFDM_SYMBOL_LENGTH        (OFDM_FFT_SIZE + OFDM_CP_LENGTH)
+
+#define OFDM_NUM_CARRIERS         49    // 11.5 kHz centred on fc
+#define OFDM_PILOT_SPACING        4     // Carriers from one pilot to the next, the first and last are pilots
+#define OFDM_NUM_PILOTS           ((OFDM_NUM_CARRIERS - 1) / OFDM_PILOT_SPACING + 1)
+#define OFDM_NUM_DATA_CARRIERS    (OFDM_NUM_CARRIERS - OFDM_NUM_PILOTS)
+#define OFDM_BITS_PER_SYMBOL      (2 * OFDM_NUM_DATA_CARRIERS) // QPSK on each data carrier
+
+#define OFDM_TRAINING_SYMBOLS     1     // Symbols of known carriers ahead of the data
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Gets the FFT bin of the lowest OFDM carrier
+ *
+ * The carriers are centred on fc and must fit between MIN_FSK_FREQUENCY and
+ * MAX_FSK_FREQUENCY, the band the transducer is driven in.
+ *
+ * @param first_bin Output for the bin, carrier c is at first_bin + c
+ *
+ * @return true if the carrier set fits in the band
+ */
+bool Ofdm_GetFirstBin(uint16_t* first_bin);
+
+/**
+ * @brief Generates one OFDM symbol with its cyclic prefix
+ *
+ * Data carriers are QPSK, the first bit of a carrier on the real axis, with
+ * a 1 sent as the negative value. The pilots and every carrier of a training
+ * symbol carry a fixed pseudo-random pattern of +/-1. The samples are scaled
+ * to a fixed RMS level and clipped to +/-1.
+ *
+ * @param bits OFDM_BITS_PER_SYMBOL bits of 0 or 1, ignored for a training symbol
+ * @param training true for a training symbol
+ * @param samples Output for OFDM_SYMBOL_LENGTH samples at ADC_SAMPLING_RATE
+ *
+ * @return true if successful, false if the carriers do not fit in the band
+ *
+ * @note Runs from the DAC interrupt while a message is sent and has its own
+ *       buffers so it does not disturb a demodulation in progress
+ */
+bool Ofdm_ModulateSymbol(const uint8_t* bits, bool training, float* samples);
+
+/**
+ * @brief Demodulates one OFDM symbol from a ring buffer of ADC samples
+ *
+ * A training symbol estimates the channel of every carrier and restarts the
+ * noise estimate. In a data symbol the pilots correct that estimate for the
+ * phase and gain the channel has drifted by since, interpolated across the
+ * carriers between them, before each data carrier is equalized.
+ *
+ * @param buffer Ring buffer of ADC samples
+ * @param buf_len Ring length, must be a power of 2
+ * @param start_index Index of the first sample of the FFT window
+ * @param training true for a training symbol
+ * @param bits Output for OFDM_BITS_PER_SYMBOL hard decisions, unused for training
+ * @param llr Output for the log-likelihood ratio of a 1 for each bit, unused for training
+ * @param signal_energy Output for the average energy of the equalized channel
+ * @param noise_energy Output for the current noise energy estimate of a carrier
+ *
+ * @return true if successful, false on a parameter error or if the carriers do not fit in the band
+ */
+bool Ofdm_DemodulateSymbol(const uint16_t* buffer, uint16_t buf_len, uint16_t start_index, bool training,
+                           uint8_t* bits, float* llr, float* signal_energy, float* noise_energy);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MESS_MESS_OFDM_H_ */
@@ -24,21 +24,37 @@ extern "C" {
 
 /* Exported types ------------------------------------------------------------*/
 
+typedef enum {
+  PACKET_FORMAT_POWER_OF_TWO, // Length field is the power of two of the payload bytes
+  PACKET_FORMAT_BYTE_EXACT,   // Length field is the payload bytes, or the extension follows
+  NUM_PACKET_FORMATS
+} PacketFormat_t;
 
 typedef struct {
   uint8_t data[PACKET_MAX_LENGTH_BYTES];
+  int8_t* llr;                 // Received only: reliability of each bit in PACKET_LLR_SCALE steps, positive for a 1
   uint16_t bit_count;
   uint8_t sender_id;
   uint16_t data_len_bits;
   MessageData_t contents_data_type;
   uint16_t final_length;
   bool stationary_flag;
+  bool compressed;             // Payload is a Compress_Encode stream
+  uint16_t preamble_length;    // Header and any length extension, where the data starts
   bool preamble_received;
+  bool header_rejected;   // Too many header bits in error to trust the rest
   bool fully_received;
 } BitMessage_t;
 
 /* Exported constants --------------------------------------------------------*/
 
+#define PACKET_LLR_SCALE        4.0f      // Stored steps per unit of log-likelihood ratio
+#define PACKET_LLR_MAX          INT8_MAX  // Stored value of a hard bit
+
+// Length field of the byte-exact format when the payload is too long to fit
+// it, the Golay coded byte count follows the header
+#define PACKET_EXTENDED_LENGTH  ((1 << PACKET_LENGTH_BITS) - 1)
+#define PACKET_SHORT_MAX_BYTES  PACKET_EXTENDED_LENGTH
 
 
 /* Exported macro ------------------------------------------------------------*/
@@ -52,9 +68,12 @@ typedef struct {
  *
  * This function performs the complete packet preparation sequence:
  * 1. Initializes the bit packet
- * 2. Adds preamble (skipped for EVAL type messages)
- * 3. Adds message payload
- * 4. Applies error correction coding (skipped for EVAL type messages)
+ * 2. Compresses the payload when enabled for its data type and it makes
+ *    the packet shorter, flagged in the header
+ * 3. Adds preamble (skipped for EVAL type messages)
+ * 4. Adds message payload
+ * 5. Applies error correction coding (skipped for EVAL type messages)
+ * 6. Interleaves everything after the preamble (skipped for EVAL type messages)
  *
  * @param msg Pointer to the message to be transmitted
  * @param bit_msg Pointer to the bit message structure to be filled
@@ -66,17 +85,21 @@ bool Packet_PrepareTx(Message_t* msg, BitMessage_t* bit_msg);
 /**
  * @brief Initializes a bit message structure for receiving incoming data
  *
+ * The reliabilities of the received bits are kept in storage owned by the
+ * receiver, so messages built for transmission do not carry them.
+ *
  * @param bit_msg Pointer to the bit message structure to initialize
+ * @param llr Storage for PACKET_MAX_LENGTH_BITS ratios, NULL to keep the bits only
  *
  * @return true if initialization succeeded
  */
-bool Packet_PrepareRx(BitMessage_t* bit_msg);
+bool Packet_PrepareRx(BitMessage_t* bit_msg, int8_t* llr);
 
 /**
  * @brief Adds a single bit to a bit message
  *
  * Appends a bit to the end of the bit message, handling the necessary
- * byte and bit indexing operations.
+ * byte and bit indexing operations. The bit is stored with full reliability.
  *
  * @param bit_msg Pointer to the bit message structure
  * @param bit The bit value to add (true=1, false=0)
@@ -85,6 +108,20 @@ bool Packet_PrepareRx(BitMessage_t* bit_msg);
  */
 bool Packet_AddBit(BitMessage_t* bit_msg, bool bit);
 
+/**
+ * @brief Adds a demodulated bit and its log-likelihood ratio to a bit message
+ *
+ * The ratio is quantized to PACKET_LLR_SCALE steps and saturates at
+ * +/-PACKET_LLR_MAX.
+ *
+ * @param bit_msg Pointer to the bit message structure
+ * @param bit The hard decision for the bit (true=1, false=0)
+ * @param llr Log-likelihood ratio of a 1
+ *
+ * @return true if successful, false if packet is already at maximum capacity
+ */
+bool Packet_AddSoftBit(BitMessage_t* bit_msg, bool bit, float llr);
+
 /**
  * @brief Retrieves a bit value from a specific position in a bit message
  *
@@ -96,6 +133,47 @@ bool Packet_AddBit(BitMessage_t* bit_msg, bool bit);
  */
 bool Packet_GetBit(BitMessage_t* bit_msg, uint16_t position, bool* bit);
 
+/**
+ * @brief Appends a bit string to a bit message
+ *
+ * The bits are copied a word at a time rather than one by one and stored
+ * with full reliability, as Packet_AddBit would store each of them.
+ *
+ * @param bit_msg Pointer to the bit message structure
+ * @param data Bits to add, starting at the MSB of data[0]
+ * @param num_bits Number of bits to add
+ *
+ * @return true if successful, false if the bits do not fit in the packet
+ */
+bool Packet_AddBits(BitMessage_t* bit_msg, const uint8_t* data, uint16_t num_bits);
+
+/**
+ * @brief Copies a bit string out of a bit message
+ *
+ * The bits are placed from the MSB of data[0] and the unused bits of a
+ * partial last byte are cleared.
+ *
+ * @param bit_msg Pointer to the bit message structure
+ * @param start_position Pointer to the starting bit position (will be updated)
+ * @param num_bits Number of bits to copy
+ * @param data Output, at least (num_bits + 7) / 8 bytes
+ *
+ * @return true if successful, false if requested bits exceed message bounds
+ */
+bool Packet_GetBits(BitMessage_t* bit_msg, uint16_t* start_position, uint16_t num_bits, uint8_t* data);
+
+/**
+ * @brief Retrieves the stored log-likelihood ratio of a bit in a bit message
+ *
+ * @param bit_msg Pointer to the bit message structure
+ * @param position Zero-based index of the bit
+ * @param llr Pointer where the quantized ratio will be stored
+ *
+ * @return true if successful, false if position is out of bounds or the
+ *         message keeps no ratios
+ */
+bool Packet_GetLlr(BitMessage_t* bit_msg, uint16_t position, int8_t* llr);
+
 /**
  * @brief Extracts an arbitrary-length chunk of bits (up to 8) from a bit message
  *
@@ -174,20 +252,46 @@ bool Packet_Get16(BitMessage_t* bit_msg, uint16_t* start_position, uint16_t* dat
 bool Packet_Get32(BitMessage_t* bit_msg, uint16_t* start_position, uint32_t* data);
 
 /**
- * @brief Calculates the minimum power-of-2 packet size needed for a given payload
+ * @brief Calculates the minimum packet size needed for a given payload
  *
  * @param str_len The length of data to accommodate
  *
- * @return The minimum packet size (always a power of 2)
+ * @return The minimum packet size, a power of 2 in the power of two format
+ *         and str_len itself in the byte-exact format
  */
 uint16_t Packet_MinimumSize(uint16_t str_len);
 
+/**
+ * @brief Gets the packet format in use, which both ends must share
+ *
+ * @return The packet format
+ */
+PacketFormat_t Packet_GetFormat(void);
+
+/**
+ * @brief Restores the coded order of a fully received packet
+ *
+ * Everything after the header and any length extension is sent through a
+ * block interleaver of PARAM_INTERLEAVER_DEPTH rows, so that a fade or a
+ * tone lost to the channel corrupts bits spread across the codewords rather
+ * than a run of them. The bits and their log-likelihood ratios are put back
+ * in place ahead of error correction. Does nothing with a depth of 1.
+ *
+ * @param bit_msg Pointer to the received bit message, final_length bits long
+ *
+ * @return true if successful, false if the packet is shorter than its header
+ */
+bool Packet_Deinterleave(BitMessage_t* bit_msg);
+
 /**
  * @brief Registers modem parameters with the parameter subsystem for HMI access
  *
  * Registers:
  * - The modem identifier
  * - The stationary flag (indicating if the modem is in a fixed position)
+ * - The packet format
+ * - The interleaver depth
+ * - The data types to compress
  *
  * @return true if all parameters were registered successfully
  */
@@ -0,0 +1,73 @@
+/*
+ * bit_stream.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef COMMON_UTILS_BIT_STREAM_H_
+#define COMMON_UTILS_BIT_STREAM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+
+
+/* Exported constants --------------------------------------------------------*/
+
+
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/*
+ * Bit strings are stored MSB first: bit n of a buffer is bit 7 - n % 8 of
+ * byte n / 8. Both functions move whole words at a time and copy bytes
+ * straight across when the two positions line up.
+ */
+
+/**
+ * @brief Copies a bit string into a buffer at any bit position
+ *
+ * Bits of dest outside the ones written are left as they were.
+ *
+ * @param dest Buffer to write to, at least (dest_bit + num_bits + 7) / 8 bytes
+ * @param dest_bit Position of the first bit to write
+ * @param src Bits to copy, starting at the MSB of src[0]
+ * @param num_bits Number of bits to copy
+ */
+void BitStream_Write(uint8_t* dest, uint32_t dest_bit, const uint8_t* src, uint32_t num_bits);
+
+/**
+ * @brief Copies a bit string out of a buffer from any bit position
+ *
+ * The bits are placed from the MSB of dest[0]. The unused bits of a partial
+ * last byte are cleared.
+ *
+ * @param src Buffer to read from, at least (src_bit + num_bits + 7) / 8 bytes
+ * @param src_bit Position of the first bit to read
+ * @param dest Output, at least (num_bits + 7) / 8 bytes
+ * @param num_bits Number of bits to copy
+ */
+void BitStream_Read(const uint8_t* src, uint32_t src_bit, uint8_t* dest, uint32_t num_bits);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMON_UTILS_BIT_STREAM_H_ */
@@ -0,0 +1,96 @@
+/*
+ * compress.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef COMMON_UTILS_COMPRESS_H_
+#define COMMON_UTILS_COMPRESS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+
+
+/* Exported constants --------------------------------------------------------*/
+
+#define COMPRESS_OFFSET_BITS    8     // Matches start up to 256 bytes back
+#define COMPRESS_LENGTH_BITS    4
+#define COMPRESS_MIN_MATCH      2     // Shortest match worth its 13 bits
+#define COMPRESS_MAX_MATCH      (COMPRESS_MIN_MATCH + (1 << COMPRESS_LENGTH_BITS) - 1)
+#define COMPRESS_MAX_LENGTH     256   // Uncompressed bytes, counted in the first byte
+
+// Output size that always fits num_bytes: the length byte and every byte
+// sent as a 9 bit literal
+#define COMPRESS_MAX_OUTPUT(num_bytes)  (1 + ((num_bytes) * 9 + 7) / 8)
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/*
+ * An LZSS stream in the style of heatshrink. The first byte is the
+ * uncompressed length minus one. Bits follow MSB first: a 1 and 8 bits for a
+ * literal byte, or a 0, COMPRESS_OFFSET_BITS of the distance back minus one
+ * and COMPRESS_LENGTH_BITS of the length minus COMPRESS_MIN_MATCH to copy
+ * earlier bytes. Matches can reach back past the start of the data into a
+ * static dictionary of text common in telemetry, so even short messages
+ * find something to match.
+ */
+
+/**
+ * @brief Compresses a block of bytes
+ *
+ * Takes the longest match at each byte, the nearest one of that length.
+ *
+ * @param input Bytes to compress
+ * @param length Number of bytes, 1 to COMPRESS_MAX_LENGTH
+ * @param output Output, the compressed stream
+ * @param max_output Size of output. COMPRESS_MAX_OUTPUT(length) always fits.
+ * @param output_length Output, bytes of the compressed stream
+ *
+ * @return true if successful, false if length is out of range or the stream
+ *         doesn't fit max_output
+ */
+bool Compress_Encode(const uint8_t* input, uint16_t length, uint8_t* output, uint16_t max_output,
+                     uint16_t* output_length);
+
+/**
+ * @brief Decompresses a stream from Compress_Encode
+ *
+ * Every offset and length is checked, so a corrupted stream can't read or
+ * write out of bounds.
+ *
+ * @param input Compressed stream
+ * @param input_length Bytes of the stream, which may be followed by padding
+ * @param output Output, the uncompressed bytes
+ * @param max_output Size of output
+ * @param output_length Output, number of uncompressed bytes
+ *
+ * @return true if successful, false if the stream is malformed, ends early
+ *         or decompresses to more than max_output
+ */
+bool Compress_Decode(const uint8_t* input, uint16_t input_length, uint8_t* output, uint16_t max_output,
+                     uint16_t* output_length);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMON_UTILS_COMPRESS_H_ */
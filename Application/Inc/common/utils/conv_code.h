@@ -0,0 +1,101 @@
+/*
+ * conv_code.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef COMMON_UTILS_CONV_CODE_H_
+#define COMMON_UTILS_CONV_CODE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef enum {
+  CONV_CODE_RATE_1_2,
+  CONV_CODE_RATE_2_3,   // Rate 1/2 punctured
+  CONV_CODE_RATE_3_4,   // Rate 1/2 punctured
+  NUM_CONV_CODE_RATES
+} ConvCodeRate_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+#define CONV_CODE_CONSTRAINT_LENGTH 7
+#define CONV_CODE_TAIL_BITS         (CONV_CODE_CONSTRAINT_LENGTH - 1)
+
+// Longest input the decoder keeps decisions for, sized for a full packet
+// payload and its CRC-16. Each bit takes 8 bytes.
+#ifndef CONV_CODE_MAX_INPUT_BITS
+#define CONV_CODE_MAX_INPUT_BITS    (1024 + 16)
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/*
+ * The code is the K=7 rate 1/2 code of IEEE 802.11a, with generators 133
+ * and 171 (octal) in that order, punctured to 2/3 and 3/4 with the patterns
+ * of the same standard. Each input is
+ * followed by CONV_CODE_TAIL_BITS zeros so the encoder ends in the zero
+ * state. Bit strings are packed MSB first.
+ */
+
+/**
+ * @brief Gets the number of coded bits an input encodes to
+ *
+ * @param num_bits Number of input bits, not counting the tail
+ * @param rate Code rate
+ *
+ * @return Number of coded bits, tail included, or 0 for an invalid rate
+ */
+uint16_t ConvCode_EncodedLength(uint16_t num_bits, ConvCodeRate_t rate);
+
+/**
+ * @brief Encodes a bit string
+ *
+ * @param data Input bits
+ * @param num_bits Number of input bits
+ * @param rate Code rate
+ * @param coded Output, ConvCode_EncodedLength(num_bits, rate) bits
+ *
+ * @return true if successful, false for an invalid rate
+ */
+bool ConvCode_Encode(const uint8_t* data, uint16_t num_bits, ConvCodeRate_t rate, uint8_t* coded);
+
+/**
+ * @brief Decodes a coded bit string with a soft decision Viterbi decoder
+ *
+ * Takes the reliability of each coded bit, so hard decisions work as
+ * ratios of equal size. Punctured bits are filled back in as unknown.
+ *
+ * @param llr Log-likelihood ratio of each coded bit, positive for a 1
+ * @param num_bits Number of input bits that were encoded
+ * @param rate Code rate
+ * @param data Output, num_bits bits, the unused bits of the last byte cleared
+ *
+ * @return true if successful, false for an invalid rate or a num_bits over
+ *         CONV_CODE_MAX_INPUT_BITS
+ */
+bool ConvCode_Decode(const int8_t* llr, uint16_t num_bits, ConvCodeRate_t rate, uint8_t* data);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMON_UTILS_CONV_CODE_H_ */
@@ -0,0 +1,94 @@
+/*
+ * crc.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef COMMON_UTILS_CRC_H_
+#define COMMON_UTILS_CRC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+
+
+/* Exported constants --------------------------------------------------------*/
+
+// 1: 16 entry tables, two lookups per byte from 112 bytes of flash, 0: 256
+// entry tables, one lookup per byte, with CRC-32 sliced over CRC32_SLICES
+// bytes at a time from CRC32_SLICES kB of flash
+#ifndef CRC_NIBBLE_TABLES
+#define CRC_NIBBLE_TABLES   0
+#endif
+
+// Bytes of CRC-32 input per step with the 256 entry tables, 1, 4 or 8
+#ifndef CRC32_SLICES
+#define CRC32_SLICES        8
+#endif
+
+#if CRC32_SLICES != 1 && CRC32_SLICES != 4 && CRC32_SLICES != 8
+#error "CRC32_SLICES must be 1, 4 or 8"
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Calculates the CRC-8 of a bit string, polynomial 0x07 from 0x00
+ *
+ * The bits are taken MSB first. A partial last byte only contributes its
+ * leading num_bits % 8 bits, the rest of it is ignored.
+ *
+ * @param data Bits, at least (num_bits + 7) / 8 bytes
+ * @param num_bits Number of bits covered
+ *
+ * @return The CRC
+ */
+uint8_t Crc_Calculate8(const uint8_t* data, uint16_t num_bits);
+
+/**
+ * @brief Calculates the CRC-16 of a bit string, polynomial 0x1021 from 0xFFFF
+ *
+ * Bits are taken as in Crc_Calculate8.
+ *
+ * @param data Bits, at least (num_bits + 7) / 8 bytes
+ * @param num_bits Number of bits covered
+ *
+ * @return The CRC
+ */
+uint16_t Crc_Calculate16(const uint8_t* data, uint16_t num_bits);
+
+/**
+ * @brief Calculates the CRC-32 of a bit string, polynomial 0x04C11DB7 from
+ *        0xFFFFFFFF and inverted at the end
+ *
+ * Bits are taken as in Crc_Calculate8.
+ *
+ * @param data Bits, at least (num_bits + 7) / 8 bytes
+ * @param num_bits Number of bits covered
+ *
+ * @return The CRC
+ */
+uint32_t Crc_Calculate32(const uint8_t* data, uint16_t num_bits);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMON_UTILS_CRC_H_ */
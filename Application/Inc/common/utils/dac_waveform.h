@@ -27,14 +27,33 @@ typedef struct {
   uint32_t freq_hz;
   float relative_amplitude;
   uint32_t duration_us;
-  uint32_t phase_increment;
+  uint32_t phase_offset;    // Jump added to the carrier phase at the start of the step, 2^32 per cycle
+  uint32_t carrier_hz;      // Part of freq_hz switched at the start of the step, only the rest is shaped
 } WaveformStep_t;
 
+/*
+ * Supplies the next step of a waveform. Called from the DMA interrupt as each
+ * step ends, so it must be quick. Returns false once the waveform has ended.
+ */
+typedef bool (*DAC_StepSource_t)(WaveformStep_t* step);
+
+/*
+ * Supplies the next run of samples of a sampled waveform, each from -1 to 1.
+ * Called from the DMA interrupt whenever the previous run has been used up,
+ * the samples must stay valid until the next call. Returns the number of
+ * samples in the run, 0 once the waveform has ended.
+ */
+typedef uint16_t (*DAC_SampleSource_t)(const float** samples);
+
 /* Exported constants --------------------------------------------------------*/
 
 #define DAC_BUFFER_SIZE     500
 #define DAC_SAMPLE_RATE     1000000
 
+// Smallest bandwidth-time product of the Gaussian frequency shaping. Below it
+// a transition would reach past the steps either side of its boundary.
+#define DAC_MIN_SHAPING_BT              0.4f
+
 /* Exported macro ------------------------------------------------------------*/
 
 extern DAC_HandleTypeDef hdac1;
@@ -59,30 +78,73 @@ bool DAC_InitWaveformGenerator(void);
  * @brief Configures a sequence of waveform steps for generation
  *
  * Sets up a sequence of waveform steps (frequency, duration, etc.) for the DAC
- * to output. Validates that all step durations are compatible with the DAC buffer
- * configuration and calculates necessary phase increments.
+ * to output. A step can start at any sample, whatever its position in the DAC
+ * buffer.
  *
- * @param sequence Pointer to an array of waveform steps
+ * @param sequence Pointer to an array of waveform steps, which must stay valid during output
  * @param num_steps Number of steps in the sequence
  *
  * @return true if sequence is valid and was set successfully, false otherwise
  *
- * @note Each step's duration must be a multiple of half the DAC buffer duration
- *       (currently DAC_BUFFER_SIZE/2 * DAC_SAMPLE_RATE/1000000 microseconds)
+ * @note Each step must last at least 1 microsecond
+ */
+bool DAC_SetWaveformSequence(const WaveformStep_t* sequence, uint32_t num_steps);
+
+/**
+ * @brief Configures a source that supplies the waveform one step at a time
+ *
+ * Nothing is held beyond the step being output and the one after it, so a
+ * waveform can be as long as the source keeps supplying steps and output
+ * starts without preparing it first. Output ends at the first step with no
+ * duration.
+ * Replaces any sequence or sample source.
+ *
+ * The phase is always continuous from one step to the next. With shaping the
+ * frequency also moves from one step's to the next through a Gaussian filter
+ * of the given bandwidth-time product, as in GFSK, instead of jumping, which
+ * keeps the spectrum of each tone narrower. The time is the duration of the
+ * shorter of the two steps. Only the deviation of each step from its
+ * carrier_hz is filtered, the carrier switches at the boundary, so a hop to a
+ * new carrier does not sweep across the tones in between.
+ *
+ * @param source Function supplying the steps
+ * @param shaping_bt Bandwidth-time product of the frequency shaping, 0 to
+ *                   switch frequencies abruptly. Raised to DAC_MIN_SHAPING_BT
+ *                   if lower
+ *
+ * @return true if the source was set, false on a parameter error
+ */
+bool DAC_SetStepSource(DAC_StepSource_t source, float shaping_bt);
+
+/**
+ * @brief Configures a sampled waveform for generation instead of a sequence of steps
+ *
+ * For waveforms that are not a tone per step, such as OFDM. The source is
+ * pulled from the DMA interrupt as the buffer empties and linearly
+ * interpolated up to DAC_SAMPLE_RATE, so a waveform can be produced at the
+ * rate of the receiver without holding it all in memory. Replaces any
+ * sequence or step source.
+ *
+ * @param source Function supplying the samples
+ * @param sample_rate Rate of the supplied samples in Hertz, at most DAC_SAMPLE_RATE
+ * @param relative_amplitude Output amplitude of a sample of +/-1, from 0 to 1
+ *
+ * @return true if the source was set, false on a parameter error
  */
-bool DAC_SetWaveformSequence(WaveformStep_t* sequence, uint32_t num_steps);
+bool DAC_SetSampleSource(DAC_SampleSource_t source, uint32_t sample_rate, float relative_amplitude);
 
 /**
  * @brief Starts the waveform output on the specified DAC channel
  *
  * Initiates DMA-based waveform generation on the specified DAC channel using
- * the previously configured waveform sequence.
+ * the previously configured waveform sequence or sample source.
  *
  * @param channel DAC channel to use (DAC_CHANNEL_1 or DAC_CHANNEL_2)
  *
  * @return true if output started successfully, false if no sequence is set or DMA failed
  *
- * @pre DAC_SetWaveformSequence must be called successfully before this function
+ * @pre DAC_SetWaveformSequence, DAC_SetStepSource or DAC_SetSampleSource must be
+ *      called successfully before this function
  */
 bool DAC_StartWaveformOutput(uint32_t channel);
 
@@ -102,6 +164,14 @@ bool DAC_StopWaveformOutput(void);
  */
 bool DAC_IsRunning(void);
 
+/**
+ * @brief Called from the DMA interrupt once a waveform sequence has finished
+ *
+ * Weak empty default that can be overridden to be notified without polling
+ * DAC_IsRunning.
+ */
+void DAC_WaveformCompleteCallback(void);
+
 /* Private defines -----------------------------------------------------------*/
 
 #ifdef __cplusplus
@@ -0,0 +1,71 @@
+/*
+ * golay.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef COMMON_UTILS_GOLAY_H_
+#define COMMON_UTILS_GOLAY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+
+
+/* Exported constants --------------------------------------------------------*/
+
+#define GOLAY_DATA_BITS         12
+#define GOLAY_PARITY_BITS       12
+#define GOLAY_CODEWORD_BITS     (GOLAY_DATA_BITS + GOLAY_PARITY_BITS)
+#define GOLAY_MAX_CORRECTED     3     // Four bits in error are always detected
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Encodes 12 bits with the extended Golay(24,12) code
+ *
+ * @param data Bits to encode in the lower 12 bits
+ *
+ * @return The codeword in the lower 24 bits, the data in the upper 12 of
+ *         them followed by the parity
+ */
+uint32_t Golay_Encode(uint16_t data);
+
+/**
+ * @brief Corrects a received Golay(24,12) codeword
+ *
+ * The syndrome indexes a table of the error patterns of up to three bits,
+ * built on the first call.
+ *
+ * @param codeword Received codeword in the lower 24 bits
+ * @param data Output, corrected data in the lower 12 bits
+ * @param num_corrected Output, number of bits of the codeword corrected
+ *
+ * @return true if the codeword had at most 3 bits in error, false if it had
+ *         more and can't be corrected. data is left unchanged when false.
+ */
+bool Golay_Decode(uint32_t codeword, uint16_t* data, uint8_t* num_corrected);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMON_UTILS_GOLAY_H_ */
@@ -0,0 +1,93 @@
+/*
+ * interleaver.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef COMMON_UTILS_INTERLEAVER_H_
+#define COMMON_UTILS_INTERLEAVER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+
+
+/* Exported constants --------------------------------------------------------*/
+
+
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/*
+ * A block of num_bits is written into a matrix of depth rows a row at a
+ * time and sent a column at a time, so bits next to each other in the block
+ * go out about depth bits apart, or as many as there are rows in use when
+ * the block is too short to fill depth of them. A run of errors up to that
+ * many bits long on the channel lands on bits a whole row apart. The last row is left short
+ * when num_bits isn't a multiple of depth, which costs no extra bits. A
+ * depth of 1 leaves the order unchanged. Bits are stored MSB first as in
+ * bit_stream.h.
+ */
+
+/**
+ * @brief Reorders a block of bits into the order they are sent
+ *
+ * @param src Bits in the order they were coded, starting at the MSB of src[0]
+ * @param dest Output, the bits in the order to send them. Must not overlap src.
+ * @param num_bits Number of bits in the block
+ * @param depth Rows of the interleaver, at least 1
+ *
+ * @return true if successful, false if depth is 0
+ */
+bool Interleaver_Interleave(const uint8_t* src, uint8_t* dest, uint16_t num_bits, uint8_t depth);
+
+/**
+ * @brief Restores the coded order of a block of received bits
+ *
+ * @param src Bits in the order they were received, starting at the MSB of src[0]
+ * @param dest Output, the bits in the order they were coded. Must not overlap src.
+ * @param num_bits Number of bits in the block
+ * @param depth Rows the block was interleaved with
+ *
+ * @return true if successful, false if depth is 0
+ */
+bool Interleaver_Deinterleave(const uint8_t* src, uint8_t* dest, uint16_t num_bits, uint8_t depth);
+
+/**
+ * @brief Restores the coded order of the reliabilities of a block of bits
+ *
+ * The same permutation as Interleaver_Deinterleave with one value per bit,
+ * so soft decisions follow their bits.
+ *
+ * @param src Reliabilities in the order the bits were received
+ * @param dest Output, in the order the bits were coded. Must not overlap src.
+ * @param num_bits Number of bits in the block
+ * @param depth Rows the block was interleaved with
+ *
+ * @return true if successful, false if depth is 0
+ */
+bool Interleaver_DeinterleaveLlr(const int8_t* src, int8_t* dest, uint16_t num_bits, uint8_t depth);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMON_UTILS_INTERLEAVER_H_ */
@@ -0,0 +1,85 @@
+/*
+ * reed_solomon.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef COMMON_UTILS_REED_SOLOMON_H_
+#define COMMON_UTILS_REED_SOLOMON_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+
+
+/* Exported constants --------------------------------------------------------*/
+
+#define REED_SOLOMON_MAX_LENGTH     255   // Bytes in a codeword, data and parity
+
+// Largest number of parity bytes, which sizes the decoder's polynomials
+#ifndef REED_SOLOMON_MAX_PARITY
+#define REED_SOLOMON_MAX_PARITY     64
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/*
+ * Systematic Reed-Solomon codes over GF(256), field polynomial 0x11D, with
+ * the generator roots alpha^0 to alpha^(num_parity - 1). Shorter codewords
+ * are the full length code with leading zeros left out. num_parity parity
+ * bytes correct up to num_parity / 2 bytes in error, whatever their bits.
+ */
+
+/**
+ * @brief Calculates the parity bytes of a codeword
+ *
+ * @param data Data bytes of the codeword
+ * @param num_data Number of data bytes
+ * @param num_parity Number of parity bytes, 1 to REED_SOLOMON_MAX_PARITY
+ * @param parity Output, num_parity bytes to follow the data
+ *
+ * @return true if successful, false if the codeword would be longer than
+ *         REED_SOLOMON_MAX_LENGTH or num_parity is out of range
+ */
+bool ReedSolomon_Encode(const uint8_t* data, uint16_t num_data, uint8_t num_parity, uint8_t* parity);
+
+/**
+ * @brief Corrects the byte errors of a received codeword in place
+ *
+ * Finds the error locator with Berlekamp-Massey, the error positions with a
+ * Chien search and their values with Forney's algorithm.
+ *
+ * @param codeword Data bytes followed by the parity bytes
+ * @param length Number of bytes in the codeword, parity included
+ * @param num_parity Number of parity bytes, 1 to REED_SOLOMON_MAX_PARITY
+ * @param num_corrected Output, number of bytes corrected
+ *
+ * @return true if the codeword is correct or was corrected, false if it has
+ *         more errors than the code corrects or the sizes are out of range.
+ *         The codeword is left as it was when false.
+ */
+bool ReedSolomon_Decode(uint8_t* codeword, uint16_t length, uint8_t num_parity, uint8_t* num_corrected);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMON_UTILS_REED_SOLOMON_H_ */
@@ -0,0 +1,171 @@
+/*
+ * sample_ring.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef COMMON_UTILS_SAMPLE_RING_H_
+#define COMMON_UTILS_SAMPLE_RING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+/*
+ * Single-producer/single-consumer sample ring. The producer (an ADC interrupt)
+ * places samples in the buffer and then publishes them with
+ * SampleRing_Commit, the consumer (the MESS task) reads them and releases
+ * them with SampleRing_Advance. Positions are free-running 32-bit sample
+ * counters so a full ring and a lapped ring are never confused with an empty
+ * one. The producer cannot be held off, so writing past the reader is
+ * counted as an overrun and the reader skips ahead with SampleRing_Resync.
+ */
+typedef struct {
+  uint16_t* buffer;
+  uint32_t mask;              // Buffer length - 1
+  uint32_t capacity;          // Unread samples that can be held without loss
+  uint32_t write_count;       // Samples published, written by the producer only
+  uint32_t read_count;        // Samples released, written by the consumer only
+  uint32_t overruns;          // Times the producer lapped the consumer
+  uint32_t lost_samples;      // Unread samples overwritten by the producer
+} SampleRing_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Initializes a ring over an existing buffer
+ *
+ * @param ring Ring to initialize
+ * @param buffer Sample storage
+ * @param size Buffer length in samples, must be a power of 2
+ * @param write_ahead Samples past the published data that the producer may
+ *                    be writing at any time, e.g. slots owned by a DMA stream
+ *
+ * @return true if the geometry is valid
+ *
+ * @note Clears the overrun statistics
+ */
+bool SampleRing_Init(SampleRing_t* ring, uint16_t* buffer, uint32_t size, uint32_t write_ahead);
+
+/**
+ * @brief Empties the ring
+ *
+ * @param ring Initialized ring
+ *
+ * @note The producer must be stopped. The overrun statistics are kept.
+ */
+void SampleRing_Reset(SampleRing_t* ring);
+
+/**
+ * @brief Publishes samples the producer has placed in the buffer
+ *
+ * @param ring Initialized ring
+ * @param count Number of new samples following the previously published ones
+ *
+ * @return false if the new samples overwrote data the consumer had not read
+ *
+ * @note Producer side only, safe to call from an interrupt
+ */
+bool SampleRing_Commit(SampleRing_t* ring, uint32_t count);
+
+/**
+ * @brief Gets the number of published samples the consumer has not released
+ *
+ * @param ring Initialized ring
+ *
+ * @return Unread samples, above the capacity if the producer lapped the consumer
+ *
+ * @note Consumer side only
+ */
+uint32_t SampleRing_Available(const SampleRing_t* ring);
+
+/**
+ * @brief Skips the consumer ahead after the producer lapped it
+ *
+ * Moves the read position to the oldest sample that is still intact.
+ *
+ * @param ring Initialized ring
+ *
+ * @return true if samples were lost and the read position moved
+ *
+ * @note Consumer side only
+ */
+bool SampleRing_Resync(SampleRing_t* ring);
+
+/**
+ * @brief Releases samples the consumer is done with
+ *
+ * @param ring Initialized ring
+ * @param count Samples to release, no more than SampleRing_Available
+ *
+ * @note Consumer side only
+ */
+void SampleRing_Advance(SampleRing_t* ring, uint32_t count);
+
+/**
+ * @brief Moves the read position to a buffer index near it
+ *
+ * Detectors keep buffer indices of earlier windows and move the read position
+ * back onto them. The index is taken at the nearest distance from the current
+ * read position, in either direction.
+ *
+ * @param ring Initialized ring
+ * @param index Buffer index to read from next
+ *
+ * @note Consumer side only
+ */
+void SampleRing_SeekIndex(SampleRing_t* ring, uint32_t index);
+
+/**
+ * @brief Gets the buffer index of the next sample to read
+ *
+ * @param ring Initialized ring
+ *
+ * @return Index into the buffer
+ */
+uint32_t SampleRing_GetReadIndex(const SampleRing_t* ring);
+
+/**
+ * @brief Gets the number of times the producer lapped the consumer
+ *
+ * @param ring Initialized ring
+ *
+ * @return Overrun count since SampleRing_Init
+ */
+uint32_t SampleRing_GetOverruns(const SampleRing_t* ring);
+
+/**
+ * @brief Gets the number of unread samples lost to overruns
+ *
+ * @param ring Initialized ring
+ *
+ * @return Lost sample count since SampleRing_Init
+ */
+uint32_t SampleRing_GetLostSamples(const SampleRing_t* ring);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMON_UTILS_SAMPLE_RING_H_ */
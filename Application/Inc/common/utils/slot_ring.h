@@ -0,0 +1,117 @@
+/*
+ * slot_ring.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef COMMON_UTILS_SLOT_RING_H_
+#define COMMON_UTILS_SLOT_RING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+/*
+ * Processing ring split into equal slots that a double-buffered DMA stream
+ * fills in place. Two slots are always owned by the DMA (the one being
+ * written and the one queued in the other memory register), everything
+ * before write_index belongs to the consumer.
+ */
+typedef struct {
+  uint16_t* buffer;
+  uint16_t buffer_size;               // Power of 2
+  uint16_t slot_size;
+  uint16_t num_slots;
+  uint16_t next_slot;                 // Slot queued when the DMA frees a memory register
+  volatile uint16_t write_index;      // End of the published data
+  volatile uint32_t sample_count;     // Samples published since the last reset
+} SlotRing_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+#define SLOT_RING_DMA_SLOTS       2   // Slots owned by a double-buffered DMA stream
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Splits a processing buffer into DMA slots
+ *
+ * @param ring Ring to initialize
+ * @param buffer Processing buffer the DMA writes into
+ * @param buffer_size Buffer length in samples, must be a power of 2
+ * @param slot_size Samples per DMA transfer, must divide buffer_size
+ *
+ * @return true if the geometry is valid and leaves the consumer at least one slot
+ */
+bool SlotRing_Init(SlotRing_t* ring, uint16_t* buffer, uint16_t buffer_size, uint16_t slot_size);
+
+/**
+ * @brief Rewinds the ring to slot 0 before a DMA restart
+ *
+ * @param ring Initialized ring
+ */
+void SlotRing_Reset(SlotRing_t* ring);
+
+/**
+ * @brief Gets the start of a slot
+ *
+ * @param ring Initialized ring
+ * @param slot Slot number, wraps around the ring
+ *
+ * @return Pointer to the first sample of the slot
+ */
+uint16_t* SlotRing_GetSlot(const SlotRing_t* ring, uint16_t slot);
+
+/**
+ * @brief Publishes the slot the DMA just completed
+ *
+ * Advances the write index and sample counter by one slot and hands back the
+ * slot the freed DMA memory register should be pointed at. Nothing is copied,
+ * so this is cheap enough to run from the DMA interrupt.
+ *
+ * @param ring Initialized ring
+ *
+ * @return Pointer to the slot to queue for the next transfer
+ */
+uint16_t* SlotRing_SlotComplete(SlotRing_t* ring);
+
+/**
+ * @brief Gets the end of the data published so far
+ *
+ * @param ring Initialized ring
+ *
+ * @return Index one past the last completed sample
+ */
+uint16_t SlotRing_GetWriteIndex(const SlotRing_t* ring);
+
+/**
+ * @brief Gets the number of samples published since the last reset
+ *
+ * @param ring Initialized ring
+ *
+ * @return Sample counter, wraps at 2^32
+ */
+uint32_t SlotRing_GetSampleCount(const SlotRing_t* ring);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMON_UTILS_SLOT_RING_H_ */
@@ -15,6 +15,7 @@
 #include "main.h"
 #include "mess_main.h"
 #include "mess_modulate.h"
+#include "mess_calibration.h"
 #include "check_inputs.h"
 #include <string.h>
 #include <stdio.h>
@@ -42,6 +43,15 @@ void setFskF1(void* argument);
 void setFhbfskFreqSpacing(void* argument);
 void setFhbfskDwell(void* argument);
 void setFhbfskTones(void* argument);
+void setMfskBits(void* argument);
+void setGfskBt(void* argument);
+void setRsParity(void* argument);
+void setPacketFormat(void* argument);
+void setInterleaverDepth(void* argument);
+void setCompressedTypes(void* argument);
+void toggleChirpPreamble(void* argument);
+void setChirpStartFreq(void* argument);
+void setChirpEndFreq(void* argument);
 void setBaudRate(void* argument);
 void setCenterFrequency(void* argument);
 void setBitPeriod(void* argument);
@@ -54,6 +64,10 @@ void setOutputPower(void* argument);
 void setDemodSps(void* argument);
 void setMessageStartFunction(void* argument);
 void setBitDecisionFunction(void* argument);
+void setChirpThreshold(void* argument);
+void setCfarReferenceCells(void* argument);
+void setCfarPfaExponent(void* argument);
+void toggleSoftOutput(void* argument);
 void configureSleep(void* argument);
 void setLedBrightness(void* argument);
 void toggleLed(void* argument);
@@ -102,7 +116,9 @@ static MenuID_t univConfigMenuChildren[] = {
   MENU_ID_CFG_UNIV_ENC,   MENU_ID_CFG_UNIV_ERR,     MENU_ID_CFG_UNIV_MOD, 
   MENU_ID_CFG_UNIV_FSK,   MENU_ID_CFG_UNIV_FHBFSK,  MENU_ID_CFG_UNIV_BAUD,
   MENU_ID_CFG_UNIV_FC,    MENU_ID_CFG_UNIV_BP,      MENU_ID_CFG_UNIV_BANDWIDTH,
-  MENU_ID_CFG_UNIV_EXP,   MENU_ID_CFG_UNIV_IMP
+  MENU_ID_CFG_UNIV_EXP,   MENU_ID_CFG_UNIV_IMP,     MENU_ID_CFG_UNIV_MFSK_BITS,
+  MENU_ID_CFG_UNIV_GFSK_BT,  MENU_ID_CFG_UNIV_RS_PARITY,  MENU_ID_CFG_UNIV_PKT_FORMAT,
+  MENU_ID_CFG_UNIV_INTERLEAVE, MENU_ID_CFG_UNIV_COMPRESS, MENU_ID_CFG_UNIV_CHIRP
 };
 static const MenuNode_t univConfigMenu = {
   .id = MENU_ID_CFG_UNIV,
@@ -132,7 +148,8 @@ static const MenuNode_t modConfigMenu = {
 
 static MenuID_t demodConfigMenuChildren[] = {
   MENU_ID_CFG_DEMOD_SPS, MENU_ID_CFG_DEMOD_CAL, MENU_ID_CFG_DEMOD_START,
-  MENU_ID_CFG_DEMOD_DECISION
+  MENU_ID_CFG_DEMOD_DECISION, MENU_ID_CFG_DEMOD_CHIRP, MENU_ID_CFG_DEMOD_CFAR_CELLS,
+  MENU_ID_CFG_DEMOD_CFAR_PFA, MENU_ID_CFG_DEMOD_SOFT
 };
 static const MenuNode_t demodConfigMenu = {
   .id = MENU_ID_CFG_DEMOD,
@@ -264,6 +281,20 @@ static const MenuNode_t univConfigFskMenu = {
   .parameters = NULL
 };
 
+static MenuID_t univConfigChirpChildren[] = {
+  MENU_ID_CFG_UNIV_CHIRP_EN, MENU_ID_CFG_UNIV_CHIRP_START, MENU_ID_CFG_UNIV_CHIRP_END
+};
+static const MenuNode_t univConfigChirpMenu = {
+  .id = MENU_ID_CFG_UNIV_CHIRP,
+  .description = "Chirp Preamble Options",
+  .handler = NULL,
+  .parent_id = MENU_ID_CFG_UNIV,
+  .children_ids = univConfigChirpChildren,
+  .num_children = sizeof(univConfigChirpChildren) / sizeof(univConfigChirpChildren[0]),
+  .access_level = 0,
+  .parameters = NULL
+};
+
 static MenuID_t univConfigFhbfskChildren[] = {
   MENU_ID_CFG_UNIV_FHBFSK_FSEP, MENU_ID_CFG_UNIV_FHBFSK_DWELL,
   MENU_ID_CFG_UNIV_FHBFSK_TONES
@@ -506,6 +537,66 @@ static const MenuNode_t demodConfigDecisionFcn = {
   .parameters = &demodConfigDecisionFcnParam
 };
 
+static ParamContext_t demodConfigChirpThresholdParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_DEMOD_CHIRP
+};
+static const MenuNode_t demodConfigChirpThreshold = {
+  .id = MENU_ID_CFG_DEMOD_CHIRP,
+  .description = "Set Chirp Matched Filter Threshold",
+  .handler = setChirpThreshold,
+  .parent_id = MENU_ID_CFG_DEMOD,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &demodConfigChirpThresholdParam
+};
+
+static ParamContext_t demodConfigCfarCellsParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_DEMOD_CFAR_CELLS
+};
+static const MenuNode_t demodConfigCfarCells = {
+  .id = MENU_ID_CFG_DEMOD_CFAR_CELLS,
+  .description = "Set CFAR Reference Cells",
+  .handler = setCfarReferenceCells,
+  .parent_id = MENU_ID_CFG_DEMOD,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &demodConfigCfarCellsParam
+};
+
+static ParamContext_t demodConfigCfarPfaParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_DEMOD_CFAR_PFA
+};
+static const MenuNode_t demodConfigCfarPfa = {
+  .id = MENU_ID_CFG_DEMOD_CFAR_PFA,
+  .description = "Set CFAR False Alarm Exponent (10^-N per Cell)",
+  .handler = setCfarPfaExponent,
+  .parent_id = MENU_ID_CFG_DEMOD,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &demodConfigCfarPfaParam
+};
+
+static ParamContext_t demodConfigSoftParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_DEMOD_SOFT
+};
+static const MenuNode_t demodConfigSoft = {
+  .id = MENU_ID_CFG_DEMOD_SOFT,
+  .description = "Toggle Soft Decision Output",
+  .handler = toggleSoftOutput,
+  .parent_id = MENU_ID_CFG_DEMOD,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &demodConfigSoftParam
+};
+
 static MenuID_t dauConfigUartChildren[] = {
   MENU_ID_CFG_DAU_UART_BAUD
 };
@@ -642,6 +733,141 @@ static const MenuNode_t univFhbfskConfigTones = {
   .parameters = &univFhbfskConfigTonesParam
 };
 
+static ParamContext_t univConfigMfskBitsParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_UNIV_MFSK_BITS
+};
+static const MenuNode_t univConfigMfskBits = {
+  .id = MENU_ID_CFG_UNIV_MFSK_BITS,
+  .description = "Set M-FSK Bits per Symbol",
+  .handler = setMfskBits,
+  .parent_id = MENU_ID_CFG_UNIV,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &univConfigMfskBitsParam
+};
+
+static ParamContext_t univConfigGfskBtParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_UNIV_GFSK_BT
+};
+static const MenuNode_t univConfigGfskBt = {
+  .id = MENU_ID_CFG_UNIV_GFSK_BT,
+  .description = "Set GFSK Bandwidth-Time Product (0 for None, Raised to 0.4 if Lower)",
+  .handler = setGfskBt,
+  .parent_id = MENU_ID_CFG_UNIV,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &univConfigGfskBtParam
+};
+
+static ParamContext_t univConfigRsParityParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_UNIV_RS_PARITY
+};
+static const MenuNode_t univConfigRsParity = {
+  .id = MENU_ID_CFG_UNIV_RS_PARITY,
+  .description = "Set Reed-Solomon Parity Bytes",
+  .handler = setRsParity,
+  .parent_id = MENU_ID_CFG_UNIV,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &univConfigRsParityParam
+};
+
+static ParamContext_t univConfigPacketFormatParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_UNIV_PKT_FORMAT
+};
+static const MenuNode_t univConfigPacketFormat = {
+  .id = MENU_ID_CFG_UNIV_PKT_FORMAT,
+  .description = "Set Packet Length Format",
+  .handler = setPacketFormat,
+  .parent_id = MENU_ID_CFG_UNIV,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &univConfigPacketFormatParam
+};
+
+static ParamContext_t univConfigInterleaverDepthParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_UNIV_INTERLEAVE
+};
+static const MenuNode_t univConfigInterleaverDepth = {
+  .id = MENU_ID_CFG_UNIV_INTERLEAVE,
+  .description = "Set Interleaver Depth (1 for None)",
+  .handler = setInterleaverDepth,
+  .parent_id = MENU_ID_CFG_UNIV,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &univConfigInterleaverDepthParam
+};
+
+static ParamContext_t univConfigCompressedTypesParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_UNIV_COMPRESS
+};
+static const MenuNode_t univConfigCompressedTypes = {
+  .id = MENU_ID_CFG_UNIV_COMPRESS,
+  .description = "Set Compressed Data Types (1 Integer + 2 String + 4 Float)",
+  .handler = setCompressedTypes,
+  .parent_id = MENU_ID_CFG_UNIV,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &univConfigCompressedTypesParam
+};
+
+static ParamContext_t univChirpConfigToggleParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_UNIV_CHIRP_EN
+};
+static const MenuNode_t univChirpConfigToggle = {
+  .id = MENU_ID_CFG_UNIV_CHIRP_EN,
+  .description = "Toggle Chirp Preamble",
+  .handler = toggleChirpPreamble,
+  .parent_id = MENU_ID_CFG_UNIV_CHIRP,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &univChirpConfigToggleParam
+};
+
+static ParamContext_t univChirpConfigStartParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_UNIV_CHIRP_START
+};
+static const MenuNode_t univChirpConfigStart = {
+  .id = MENU_ID_CFG_UNIV_CHIRP_START,
+  .description = "Set Chirp Start Frequency",
+  .handler = setChirpStartFreq,
+  .parent_id = MENU_ID_CFG_UNIV_CHIRP,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &univChirpConfigStartParam
+};
+
+static ParamContext_t univChirpConfigEndParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_CFG_UNIV_CHIRP_END
+};
+static const MenuNode_t univChirpConfigEnd = {
+  .id = MENU_ID_CFG_UNIV_CHIRP_END,
+  .description = "Set Chirp End Frequency",
+  .handler = setChirpEndFreq,
+  .parent_id = MENU_ID_CFG_UNIV_CHIRP,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &univChirpConfigEndParam
+};
+
 static ParamContext_t modCalConfigFreqParam = {
   .state = PARAM_STATE_0,
   .param_id = MENU_ID_CFG_MOD_CAL_FREQ
@@ -927,7 +1153,14 @@ bool COMM_RegisterConfigurationMenu()
              registerMenu(&univFskConfigF1) && registerMenu(&univFhbfskConfigFreqSpacing) &&
              registerMenu(&univFhbfskConfigDwell) && registerMenu(&univConfigBandwidth) &&
              registerMenu(&univFhbfskConfigTones) && registerMenu(&setNewId) &&
-             registerMenu(&setStationary) && registerMenu(&demodConfigDecisionFcn);
+             registerMenu(&setStationary) && registerMenu(&demodConfigDecisionFcn) &&
+             registerMenu(&univConfigMfskBits) && registerMenu(&univConfigGfskBt) &&
+             registerMenu(&univConfigRsParity) && registerMenu(&univConfigPacketFormat) &&
+             registerMenu(&univConfigInterleaverDepth) && registerMenu(&univConfigCompressedTypes) &&
+             registerMenu(&univConfigChirpMenu) && registerMenu(&univChirpConfigToggle) &&
+             registerMenu(&univChirpConfigStart) && registerMenu(&univChirpConfigEnd) &&
+             registerMenu(&demodConfigChirpThreshold) && registerMenu(&demodConfigCfarCells) &&
+             registerMenu(&demodConfigCfarPfa) && registerMenu(&demodConfigSoft);
 
   return ret;
 }
@@ -943,7 +1176,8 @@ void setEncoding(void* argument)
 void setErrorCorrection(void* argument)
 {
   FunctionContext_t* context = (FunctionContext_t*) argument;
-  char* descriptors[] = {"CRC-8", "CRC-16", "CRC-32", "Checksum-8", "Checksum-16", "Checksum-32"};
+  char* descriptors[] = {"CRC-8", "CRC-16", "CRC-32", "Checksum-8", "Checksum-16", "Checksum-32",
+                         "Convolutional 1/2", "Convolutional 2/3", "Convolutional 3/4", "Reed-Solomon"};
 
   COMMLoops_LoopEnum(context, PARAM_ERROR_CORRECTION, descriptors, sizeof(descriptors) / sizeof(descriptors[0]));
 }
@@ -952,7 +1186,7 @@ void setModulationMethod(void* argument)
 {
   FunctionContext_t* context = (FunctionContext_t*) argument;
 
-  char* descriptors[] = {"FSK", "FHBFSK"};
+  char* descriptors[] = {"FSK", "FHBFSK", "M-FSK", "DBPSK", "DQPSK", "OFDM"};
   
   COMMLoops_LoopEnum(context, PARAM_MOD_DEMOD_METHOD, descriptors, sizeof(descriptors) / sizeof(descriptors[0]));
 }
@@ -992,6 +1226,70 @@ void setFhbfskTones(void* argument)
   COMMLoops_LoopUint8(context, PARAM_FHBFSK_NUM_TONES);
 }
 
+void setMfskBits(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopUint8(context, PARAM_MFSK_BITS);
+}
+
+void setGfskBt(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopFloat(context, PARAM_GFSK_BT);
+}
+
+void setRsParity(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopUint8(context, PARAM_RS_PARITY);
+}
+
+void setPacketFormat(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+  char* descriptors[] = {"Power of Two Lengths", "Byte Exact Lengths"};
+
+  COMMLoops_LoopEnum(context, PARAM_PACKET_FORMAT, descriptors, sizeof(descriptors) / sizeof(descriptors[0]));
+}
+
+void setInterleaverDepth(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopUint8(context, PARAM_INTERLEAVER_DEPTH);
+}
+
+void setCompressedTypes(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopUint8(context, PARAM_COMPRESSED_TYPES);
+}
+
+void toggleChirpPreamble(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopToggle(context, PARAM_CHIRP_PREAMBLE);
+}
+
+void setChirpStartFreq(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopUint32(context, PARAM_CHIRP_START_FREQ);
+}
+
+void setChirpEndFreq(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopUint32(context, PARAM_CHIRP_END_FREQ);
+}
+
 void setBaudRate(void* argument)
 {
   FunctionContext_t* context = (FunctionContext_t*) argument;
@@ -1139,7 +1437,9 @@ void setMessageStartFunction(void* argument)
 {
   FunctionContext_t* context = (FunctionContext_t*) argument;
 
-  char* descriptors[] = {"Use amplitude threshold", "Use overlapping FFTs"};
+  char* descriptors[] = {"Use amplitude threshold", "Use overlapping FFTs",
+                         "Use sliding Goertzel", "Use chirp matched filter",
+                         "Use CFAR"};
 
   COMMLoops_LoopEnum(context, PARAM_MSG_START_FCN, descriptors, sizeof(descriptors) / sizeof(descriptors[0]));
 }
@@ -1153,6 +1453,34 @@ void setBitDecisionFunction(void* argument)
   COMMLoops_LoopEnum(context, PARAM_DEMODULATION_DECISION, descriptors, sizeof(descriptors) / sizeof(descriptors[0]));
 }
 
+void setChirpThreshold(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopFloat(context, PARAM_CHIRP_THRESHOLD);
+}
+
+void setCfarReferenceCells(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopUint8(context, PARAM_CFAR_REFERENCE_CELLS);
+}
+
+void setCfarPfaExponent(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopUint8(context, PARAM_CFAR_PFA_EXPONENT);
+}
+
+void toggleSoftOutput(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopToggle(context, PARAM_SOFT_OUTPUT);
+}
+
 void configureSleep(void* argument)
 {
   FunctionContext_t* context = (FunctionContext_t*) argument;
@@ -1171,25 +1499,46 @@ void toggleLed(void* argument)
   context->state->state = PARAM_STATE_COMPLETE;
 }
 
-// TODO: change to be a registered parameter
 void setModCalFreq(void* argument)
 {
   FunctionContext_t* context = (FunctionContext_t*) argument;
 
   ParamState_t old_state = context->state->state;
 
+  static uint32_t lower_freq;
+
+  uint32_t min, max;
+  if (Param_GetUint32Limits(PARAM_CAL_LOWER_FREQ, &min, &max) == false) {
+    COMM_TransmitData(error_limits_message, CALC_LEN, context->comm_interface);
+    context->state->state = PARAM_STATE_COMPLETE;
+    return;
+  }
+
   do {
     switch (context->state->state) {
       case PARAM_STATE_0:
-        sprintf((char*) context->output_buffer, "\r\n\r\nPlease enter a new frequency from 25000 Hz - 38000 Hz:\r\n");
+        sprintf((char*) context->output_buffer, "\r\n\r\nPlease enter the lowest calibration frequency from %lu Hz - %lu Hz:\r\n", min, max);
         COMM_TransmitData(context->output_buffer, CALC_LEN, context->comm_interface);
         context->state->state = PARAM_STATE_1;
         break;
       case PARAM_STATE_1:
-        uint32_t new_freq = 0;
-        if (checkUint32(context->input, context->input_len, &new_freq, 25000, 38000) == true) {
-          Modulate_SetTestFrequency(new_freq);
-          sprintf((char*) context->output_buffer, "\r\nSuccessfully set the feedback frequency to %lu\r\n\r\n", new_freq);
+        if (checkUint32(context->input, context->input_len, &lower_freq, min, max) == true) {
+          sprintf((char*) context->output_buffer, "\r\nPlease enter the highest calibration frequency from %lu Hz - %lu Hz:\r\n", lower_freq, max);
+          COMM_TransmitData(context->output_buffer, CALC_LEN, context->comm_interface);
+          context->state->state = PARAM_STATE_2;
+        }
+        else {
+          sprintf((char*) context->output_buffer, "\r\nInvalid Input!\r\n");
+          COMM_TransmitData(context->output_buffer, CALC_LEN, context->comm_interface);
+          context->state->state = PARAM_STATE_0;
+        }
+        break;
+      case PARAM_STATE_2:
+        uint32_t upper_freq = 0;
+        if (checkUint32(context->input, context->input_len, &upper_freq, lower_freq, max) == true &&
+            Param_SetUint32(PARAM_CAL_LOWER_FREQ, &lower_freq) == true &&
+            Param_SetUint32(PARAM_CAL_UPPER_FREQ, &upper_freq) == true) {
+          sprintf((char*) context->output_buffer, "\r\nSuccessfully set the calibration range to %lu Hz - %lu Hz\r\n\r\n", lower_freq, upper_freq);
           COMM_TransmitData(context->output_buffer, CALC_LEN, context->comm_interface);
           context->state->state = PARAM_STATE_COMPLETE;
         }
@@ -1209,7 +1558,8 @@ void setModCalFreq(void* argument)
 void setModCalFreqStep(void* argument)
 {
   FunctionContext_t* context = (FunctionContext_t*) argument;
-  context->state->state = PARAM_STATE_COMPLETE;
+
+  COMMLoops_LoopUint32(context, PARAM_CAL_FREQ_STEP);
 }
 
 void updateTvr(void* argument)
@@ -1225,6 +1575,7 @@ void modCalibration(void* argument)
   if (print_event_handle == NULL) return;
 
   osEventFlagsSet(print_event_handle, MESS_FREQ_RESP);
+  MESS_NotifyTask(MESS_FREQ_RESP);
 
   context->state->state = PARAM_STATE_COMPLETE;
 }
@@ -1232,6 +1583,25 @@ void modCalibration(void* argument)
 void exportModCalibration(void* argument)
 {
   FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  uint16_t num_points = Calibration_GetNumPoints();
+  if (num_points == 0) {
+    sprintf((char*) context->output_buffer, "\r\nNo calibration has been performed\r\n\r\n");
+    COMM_TransmitData(context->output_buffer, CALC_LEN, context->comm_interface);
+    context->state->state = PARAM_STATE_COMPLETE;
+    return;
+  }
+
+  sprintf((char*) context->output_buffer, "\r\nFrequency (Hz), Feedback amplitude, Gain\r\n");
+  COMM_TransmitData(context->output_buffer, CALC_LEN, context->comm_interface);
+  for (uint16_t i = 0; i < num_points; i++) {
+    uint32_t freq_hz;
+    float amplitude, gain;
+    if (Calibration_GetPoint(i, &freq_hz, &amplitude, &gain) == true) {
+      sprintf((char*) context->output_buffer, "%lu, %.2f, %.3f\r\n", freq_hz, amplitude, gain);
+      COMM_TransmitData(context->output_buffer, CALC_LEN, context->comm_interface);
+    }
+  }
   context->state->state = PARAM_STATE_COMPLETE;
 }
 
@@ -362,6 +362,7 @@ void performNoiseAnalysis(void* argument)
   if (print_event_handle == NULL) return;
 
   osEventFlagsSet(print_event_handle, MESS_PRINT_REQUEST);
+  MESS_NotifyTask(MESS_PRINT_REQUEST);
   uint32_t flags;
 
   do {
@@ -546,6 +547,7 @@ void sendTestTransducerSignal(void* argument)
   if (print_event_handle == NULL) return;
 
   osEventFlagsSet(print_event_handle, MESS_TEST_OUTPUT);
+  MESS_NotifyTask(MESS_TEST_OUTPUT);
 
   context->state->state = PARAM_STATE_COMPLETE;
 }
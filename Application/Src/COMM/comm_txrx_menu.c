@@ -47,6 +47,8 @@ void transmitIntFb(void* argument);
 void transmitFloatOut(void* argument);
 void transmitFloatFb(void* argument);
 void togglePrint(void* argument);
+void toggleBurst(void* argument);
+void setBurstGap(void* argument);
 
 void transmitBits(FunctionContext_t* context, bool is_feedback);
 void transmitString(FunctionContext_t* context, bool is_feedback);
@@ -58,7 +60,8 @@ void transmitFloat(FunctionContext_t* context, bool is_feedback);
 static MenuID_t txrxMenuChildren[] = {
   MENU_ID_TXRX_BITSOUT,   MENU_ID_TXRX_BITSFB,    MENU_ID_TXRX_STROUT, 
   MENU_ID_TXRX_STRFB,     MENU_ID_TXRX_INTOUT,    MENU_ID_TXRX_INTFB,
-  MENU_ID_TXRX_FLOATOUT,  MENU_ID_TXRX_FLOATFB ,  MENU_ID_TXRX_ENPNT
+  MENU_ID_TXRX_FLOATOUT,  MENU_ID_TXRX_FLOATFB ,  MENU_ID_TXRX_ENPNT,
+  MENU_ID_TXRX_BURST,     MENU_ID_TXRX_BURST_GAP
 };
 static const MenuNode_t txrxMenu = {
   .id = MENU_ID_TXRX,
@@ -206,6 +209,36 @@ static const MenuNode_t txrxTogglePrint = {
   .parameters = &txrxTogglePrintParam
 };
 
+static ParamContext_t txrxToggleBurstParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_TXRX_BURST
+};
+static const MenuNode_t txrxToggleBurst = {
+  .id = MENU_ID_TXRX_BURST,
+  .description = "Enable/Disable Sending Queued Messages As One Burst",
+  .handler = toggleBurst,
+  .parent_id = MENU_ID_TXRX,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &txrxToggleBurstParam
+};
+
+static ParamContext_t txrxBurstGapParam = {
+  .state = PARAM_STATE_0,
+  .param_id = MENU_ID_TXRX_BURST_GAP
+};
+static const MenuNode_t txrxBurstGap = {
+  .id = MENU_ID_TXRX_BURST_GAP,
+  .description = "Set Gap Between Burst Messages (ms)",
+  .handler = setBurstGap,
+  .parent_id = MENU_ID_TXRX,
+  .children_ids = NULL,
+  .num_children = 0,
+  .access_level = 0,
+  .parameters = &txrxBurstGapParam
+};
+
 
 /* Exported function definitions ---------------------------------------------*/
 
@@ -215,7 +248,8 @@ bool COMM_RegisterTxRxMenu()
              registerMenu(&txrxStrTransducer) && registerMenu(&txrxIntTransducer) &&
              registerMenu(&txrxFloatTransducer) && registerMenu(&txrxTogglePrint) &&
              registerMenu(&txrxStrFeedback) && registerMenu(&txrxBitsFeedback) &&
-             registerMenu(&txrxIntFeedback) && registerMenu(&txrxFloatFeedback);
+             registerMenu(&txrxIntFeedback) && registerMenu(&txrxFloatFeedback) &&
+             registerMenu(&txrxToggleBurst) && registerMenu(&txrxBurstGap);
   return ret;
 }
 
@@ -281,6 +315,20 @@ void togglePrint(void* argument)
   COMMLoops_LoopToggle(context, PARAM_PRINT_ENABLED);
 }
 
+void toggleBurst(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopToggle(context, PARAM_BURST_MODE);
+}
+
+void setBurstGap(void* argument)
+{
+  FunctionContext_t* context = (FunctionContext_t*) argument;
+
+  COMMLoops_LoopUint32(context, PARAM_BURST_GAP);
+}
+
 
 void transmitBits(FunctionContext_t* context, bool is_feedback)
 {
@@ -10,6 +10,7 @@
 #include "mess_adc.h"
 #include "mess_input.h"
 #include "mess_feedback.h"
+#include "slot_ring.h"
 #include "stm32h7xx_hal.h"
 #include <string.h>
 #include "FreeRTOS.h"
@@ -23,6 +24,9 @@
 #define INPUT_ADC         hadc3
 #define FEEDBACK_ADC      hadc1
 
+#define INPUT_SLOT_SIZE     (ADC_BUFFER_SIZE / 2)
+#define FEEDBACK_SLOT_SIZE  (ADC_BUFFER_SIZE / 2)
+
 /* Private macro -------------------------------------------------------------*/
 
 
@@ -36,10 +40,22 @@ static uint16_t* feedback_buffer = NULL;
 static uint16_t input_buffer_index = 0;
 static uint16_t feedback_buffer_index = 0;
 
+static SlotRing_t input_ring;
+static SlotRing_t feedback_ring;
+static volatile uint32_t input_sample_count = 0;
+
 /* Private function prototypes -----------------------------------------------*/
 
 void addToInputBuffer(bool firstHalf);
 void addToFeedbackBuffer(bool firstHalf);
+static bool startZeroCopy(ADC_HandleTypeDef* hadc, SlotRing_t* ring, void (*m0_complete)(DMA_HandleTypeDef* hdma),
+                          void (*m1_complete)(DMA_HandleTypeDef* hdma));
+static void inputSlotComplete(DMA_HandleTypeDef* hdma, HAL_DMA_MemoryTypeDef memory);
+static void inputM0CompleteCallback(DMA_HandleTypeDef* hdma);
+static void inputM1CompleteCallback(DMA_HandleTypeDef* hdma);
+static void feedbackSlotComplete(DMA_HandleTypeDef* hdma, HAL_DMA_MemoryTypeDef memory);
+static void feedbackM0CompleteCallback(DMA_HandleTypeDef* hdma);
+static void feedbackM1CompleteCallback(DMA_HandleTypeDef* hdma);
 
 /* Exported function definitions ---------------------------------------------*/
 
@@ -60,7 +76,7 @@ bool ADC_RegisterInputBuffer(uint16_t* in_buffer)
   if (input_buffer != NULL) return false;
 
   input_buffer = in_buffer;
-  return true;
+  return SlotRing_Init(&input_ring, input_buffer, PROCESSING_BUFFER_SIZE, INPUT_SLOT_SIZE);
 }
 
 bool ADC_RegisterFeedbackBuffer(uint16_t* fb_buffer)
@@ -68,23 +84,33 @@ bool ADC_RegisterFeedbackBuffer(uint16_t* fb_buffer)
   if (feedback_buffer != NULL) return false;
 
   feedback_buffer = fb_buffer;
-  return true;
+  return SlotRing_Init(&feedback_ring, feedback_buffer, PROCESSING_BUFFER_SIZE, FEEDBACK_SLOT_SIZE);
 }
 
 bool ADC_StartInput()
 {
   input_buffer_index = 0;
+  input_sample_count = 0;
   HAL_TIM_Base_Start(&htim8);
+#if ADC_ZERO_COPY_INPUT == 1
+  if (input_buffer == NULL) return false;
+  return startZeroCopy(&INPUT_ADC, &input_ring, inputM0CompleteCallback, inputM1CompleteCallback);
+#else
   HAL_StatusTypeDef ret = HAL_ADC_Start_DMA(&INPUT_ADC, (uint32_t*) adc_buffer, ADC_BUFFER_SIZE);
   return ret == HAL_OK;
+#endif
 }
 
 bool ADC_StartFeedback()
 {
   feedback_buffer_index = 0;
   if (feedback_buffer == NULL) return false;
+#if ADC_ZERO_COPY_INPUT == 1
+  return startZeroCopy(&FEEDBACK_ADC, &feedback_ring, feedbackM0CompleteCallback, feedbackM1CompleteCallback);
+#else
   HAL_StatusTypeDef ret = HAL_ADC_Start_DMA(&FEEDBACK_ADC, (uint32_t*) adc_buffer, ADC_BUFFER_SIZE);
   return ret == HAL_OK;
+#endif
 }
 
 bool ADC_StopFeedback()
@@ -97,6 +123,15 @@ bool ADC_StopInput()
   return HAL_ADC_Stop_DMA(&INPUT_ADC) == HAL_OK;
 }
 
+uint32_t ADC_GetInputSampleCount()
+{
+#if ADC_ZERO_COPY_INPUT == 1
+  return SlotRing_GetSampleCount(&input_ring);
+#else
+  return input_sample_count;
+#endif
+}
+
 bool ADC_StopAll()
 {
   if (ADC_StopFeedback() == false) {
@@ -133,8 +168,92 @@ void addToInputBuffer(bool firstHalf)
   }
 
   input_buffer_index = (input_buffer_index + ADC_BUFFER_SIZE / 2) % PROCESSING_BUFFER_SIZE;
+  input_sample_count += ADC_BUFFER_SIZE / 2;
+
+  Input_IncrementEndIndex();
+  MESS_NotifyTask(MESS_ADC_DATA);
+}
+
+// Same ADC setup as HAL_ADC_Start_DMA, but the DMA stream is started in
+// double-buffer mode over the first two slots of the processing buffer
+static bool startZeroCopy(ADC_HandleTypeDef* hadc, SlotRing_t* ring, void (*m0_complete)(DMA_HandleTypeDef* hdma),
+                          void (*m1_complete)(DMA_HandleTypeDef* hdma))
+{
+  SlotRing_Reset(ring);
+
+  DMA_HandleTypeDef* hdma = hadc->DMA_Handle;
+  hdma->XferCpltCallback = m0_complete;
+  hdma->XferM1CpltCallback = m1_complete;
+  hdma->XferHalfCpltCallback = NULL;
+  hdma->XferM1HalfCpltCallback = NULL;
+  hdma->XferErrorCallback = ADC_DMAError;
+
+  HAL_StatusTypeDef ret = HAL_DMAEx_MultiBufferStart_IT(hdma, (uint32_t) &hadc->Instance->DR,
+                                                        (uint32_t) SlotRing_GetSlot(ring, 0),
+                                                        (uint32_t) SlotRing_GetSlot(ring, 1),
+                                                        ring->slot_size);
+  if (ret != HAL_OK) return false;
+
+  // With DMA an overrun is always an error. As in HAL_ADC_Start_DMA it is
+  // reported through HAL_ADC_ErrorCallback, and HAL_ADC_Stop_DMA disables it
+  __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_OVR);
+  __HAL_ADC_ENABLE_IT(hadc, ADC_IT_OVR);
+
+#if defined(ADC_VER_V5_V90)
+  // ADC3, the input ADC, has its own DMA configuration bits on this part
+  if (hadc->Instance == ADC3) {
+    LL_ADC_REG_SetDMATransferMode(hadc->Instance, ADC3_CFGR_DMACONTREQ((uint32_t) hadc->Init.DMAContinuousRequests));
+    LL_ADC_EnableDMAReq(hadc->Instance);
+  }
+  else {
+    LL_ADC_REG_SetDataTransferMode(hadc->Instance, (uint32_t) hadc->Init.ConversionDataManagement);
+  }
+#else
+  LL_ADC_REG_SetDataTransferMode(hadc->Instance, (uint32_t) hadc->Init.ConversionDataManagement);
+#endif
+
+  return HAL_ADC_Start(hadc) == HAL_OK;
+}
+
+// Runs in the DMA interrupt. The completed slot is already in the processing
+// buffer so only the indices are published, then the freed memory register is
+// pointed two slots ahead while the DMA fills the other one
+static void inputSlotComplete(DMA_HandleTypeDef* hdma, HAL_DMA_MemoryTypeDef memory)
+{
+  uint16_t* next_slot = SlotRing_SlotComplete(&input_ring);
+  HAL_DMAEx_ChangeMemory(hdma, (uint32_t) next_slot, memory);
 
   Input_IncrementEndIndex();
+  MESS_NotifyTask(MESS_ADC_DATA);
+}
+
+static void inputM0CompleteCallback(DMA_HandleTypeDef* hdma)
+{
+  inputSlotComplete(hdma, MEMORY0);
+}
+
+static void inputM1CompleteCallback(DMA_HandleTypeDef* hdma)
+{
+  inputSlotComplete(hdma, MEMORY1);
+}
+
+// As for the input, in the feedback ADC's DMA interrupt
+static void feedbackSlotComplete(DMA_HandleTypeDef* hdma, HAL_DMA_MemoryTypeDef memory)
+{
+  uint16_t* next_slot = SlotRing_SlotComplete(&feedback_ring);
+  HAL_DMAEx_ChangeMemory(hdma, (uint32_t) next_slot, memory);
+
+  Feedback_IncrementEndIndex();
+}
+
+static void feedbackM0CompleteCallback(DMA_HandleTypeDef* hdma)
+{
+  feedbackSlotComplete(hdma, MEMORY0);
+}
+
+static void feedbackM1CompleteCallback(DMA_HandleTypeDef* hdma)
+{
+  feedbackSlotComplete(hdma, MEMORY1);
 }
 
 void addToFeedbackBuffer(bool firstHalf)
@@ -147,11 +266,11 @@ void addToFeedbackBuffer(bool firstHalf)
     feedback_buffer_index = feedback_buffer_index % PROCESSING_BUFFER_SIZE;
   }
 
-  if (feedback_buffer_index + ADC_BUFFER_SIZE > PROCESSING_BUFFER_SIZE) {
+  if (feedback_buffer_index + ADC_BUFFER_SIZE / 2 > PROCESSING_BUFFER_SIZE) {
     uint16_t first_block_size = PROCESSING_BUFFER_SIZE - feedback_buffer_index;
     memcpy(&feedback_buffer[feedback_buffer_index], &adc_buffer[dma_buf_start_index], first_block_size * sizeof(uint16_t));
     uint16_t second_block_size = ADC_BUFFER_SIZE / 2 - first_block_size;
-    memcpy(&feedback_buffer[feedback_buffer_index], &adc_buffer[first_block_size + dma_buf_start_index], second_block_size * sizeof(uint16_t));
+    memcpy(&feedback_buffer[0], &adc_buffer[first_block_size + dma_buf_start_index], second_block_size * sizeof(uint16_t));
   }
   else {
     memcpy(&feedback_buffer[feedback_buffer_index], &adc_buffer[dma_buf_start_index], (ADC_BUFFER_SIZE / 2) * sizeof(uint16_t));
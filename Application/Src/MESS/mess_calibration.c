@@ -7,11 +7,22 @@
 
 /* Private includes ----------------------------------------------------------*/
 
-
+#include "mess_calibration.h"
+#include "cfg_parameters.h"
+#include "cfg_defaults.h"
+#include <string.h>
 
 /* Private typedef -----------------------------------------------------------*/
 
-
+// Points are evenly spaced from lower_freq so a frequency finds its points
+// without a search
+typedef struct {
+  uint32_t lower_freq;
+  uint32_t freq_step;
+  uint16_t num_points;
+  float amplitude[CALIBRATION_MAX_POINTS];
+  float gain[CALIBRATION_MAX_POINTS];
+} CalibrationTable_t;
 
 /* Private define ------------------------------------------------------------*/
 
@@ -23,7 +34,13 @@
 
 /* Private variables ---------------------------------------------------------*/
 
+static uint32_t cal_lower_freq = DEFAULT_CAL_LOWER_FREQ;
+static uint32_t cal_upper_freq = DEFAULT_CAL_UPPER_FREQ;
+static uint32_t cal_freq_step = DEFAULT_CAL_FREQ_STEP;
 
+static CalibrationTable_t table;  // In use, read from the DAC interrupt
+static CalibrationTable_t sweep;  // Being measured
+static uint16_t sweep_index = 0;
 
 /* Private function prototypes -----------------------------------------------*/
 
@@ -31,6 +48,132 @@
 
 /* Exported function definitions ---------------------------------------------*/
 
-
+bool Calibration_RegisterParams(void)
+{
+  uint32_t min_u32 = MIN_FSK_FREQUENCY;
+  uint32_t max_u32 = MAX_FSK_FREQUENCY;
+  if (Param_Register(PARAM_CAL_LOWER_FREQ, "calibration lower frequency", PARAM_TYPE_UINT32,
+                     &cal_lower_freq, sizeof(uint32_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
+  if (Param_Register(PARAM_CAL_UPPER_FREQ, "calibration upper frequency", PARAM_TYPE_UINT32,
+                     &cal_upper_freq, sizeof(uint32_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
+  min_u32 = MIN_CAL_FREQ_STEP;
+  max_u32 = MAX_CAL_FREQ_STEP;
+  if (Param_Register(PARAM_CAL_FREQ_STEP, "calibration frequency step", PARAM_TYPE_UINT32,
+                     &cal_freq_step, sizeof(uint32_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+  return true;
+}
+
+bool Calibration_StartSweep(void)
+{
+  if (cal_freq_step == 0 || cal_upper_freq < cal_lower_freq) {
+    return false;
+  }
+  uint32_t num_points = (cal_upper_freq - cal_lower_freq) / cal_freq_step + 1;
+  if (num_points > CALIBRATION_MAX_POINTS) {
+    return false;
+  }
+
+  memset(&sweep, 0, sizeof(CalibrationTable_t));
+  sweep.lower_freq = cal_lower_freq;
+  sweep.freq_step = cal_freq_step;
+  sweep.num_points = (uint16_t) num_points;
+  sweep_index = 0;
+  return true;
+}
+
+bool Calibration_GetSweepFrequency(uint32_t* freq_hz)
+{
+  if (freq_hz == NULL || sweep_index >= sweep.num_points) {
+    return false;
+  }
+  *freq_hz = sweep.lower_freq + sweep_index * sweep.freq_step;
+  return true;
+}
+
+bool Calibration_RecordPoint(float amplitude)
+{
+  if (sweep_index >= sweep.num_points) {
+    return false;
+  }
+  sweep.amplitude[sweep_index++] = amplitude;
+  return true;
+}
+
+bool Calibration_FinishSweep(void)
+{
+  if (sweep.num_points == 0 || sweep_index < sweep.num_points) {
+    return false;
+  }
+
+  float average = 0.0f;
+  for (uint16_t i = 0; i < sweep.num_points; i++) {
+    if (sweep.amplitude[i] <= 0.0f) {
+      return false;
+    }
+    average += sweep.amplitude[i];
+  }
+  average /= sweep.num_points;
+
+  for (uint16_t i = 0; i < sweep.num_points; i++) {
+    float gain = average / sweep.amplitude[i];
+    if (gain < CALIBRATION_MIN_GAIN) {
+      gain = CALIBRATION_MIN_GAIN;
+    }
+    else if (gain > CALIBRATION_MAX_GAIN) {
+      gain = CALIBRATION_MAX_GAIN;
+    }
+    sweep.gain[i] = gain;
+  }
+
+  table = sweep;
+  return true;
+}
+
+void Calibration_Clear(void)
+{
+  table.num_points = 0;
+}
+
+float Calibration_GetGain(uint32_t freq_hz)
+{
+  if (table.num_points == 0) {
+    return 1.0f;
+  }
+  if (freq_hz <= table.lower_freq) {
+    return table.gain[0];
+  }
+
+  uint32_t offset = freq_hz - table.lower_freq;
+  uint32_t index = offset / table.freq_step;
+  if (index >= table.num_points - 1u) {
+    return table.gain[table.num_points - 1];
+  }
+  float fraction = (float) (offset - index * table.freq_step) / (float) table.freq_step;
+  return table.gain[index] + fraction * (table.gain[index + 1] - table.gain[index]);
+}
+
+uint16_t Calibration_GetNumPoints(void)
+{
+  return table.num_points;
+}
+
+bool Calibration_GetPoint(uint16_t index, uint32_t* freq_hz, float* amplitude, float* gain)
+{
+  if (freq_hz == NULL || amplitude == NULL || gain == NULL || index >= table.num_points) {
+    return false;
+  }
+  *freq_hz = table.lower_freq + index * table.freq_step;
+  *amplitude = table.amplitude[index];
+  *gain = table.gain[index];
+  return true;
+}
 
 /* Private function definitions ----------------------------------------------*/
@@ -11,12 +11,16 @@
 #include "mess_adc.h"
 #include "mess_main.h"
 #include "mess_modulate.h"
+#include "mess_goertzel.h"
+#include "mess_ofdm.h"
 
 #include "cfg_defaults.h"
 #include "cfg_parameters.h"
 
 #include <stdbool.h>
+#include <string.h>
 #include <math.h>
+#include <float.h>
 
 /* Private typedef -----------------------------------------------------------*/
 
@@ -25,12 +29,30 @@ typedef struct {
   float energy_f1;
 } DemodulationHistory_t;
 
+// Parameters the demodulation tone set is derived from
+typedef struct {
+  ModDemodMethod_t method;
+  uint32_t fsk_f0;
+  uint32_t fsk_f1;
+  uint32_t fc;
+  float baud_rate;
+  uint8_t freq_spacing;
+  uint8_t num_tones;
+  uint8_t mfsk_bits;
+} ToneSetKey_t;
+
 /* Private define ------------------------------------------------------------*/
 
 #define NUM_DEMODULATION_HISTORY          8 // Number of demodulations to look back on. Must be a power of 2
 
 #define SIGNFIICANT_SHIFT_THRESHOLD       0.15
 
+#define LLR_AVERAGE_BITS                  64 // Bits the noise and signal energy estimates average over
+
+#define LO_TABLE_BITS                     10
+#define LO_TABLE_SIZE                     (1 << LO_TABLE_BITS) // One cycle of the DPSK local oscillator
+#define DPSK_TRACKING_GAIN                0.125f // Share of each symbol's phase error that corrects the drift
+
 /* Private macro -------------------------------------------------------------*/
 
 #define MIN(a, b)     ((a < b) ? (a) : (b))
@@ -41,37 +63,79 @@ typedef struct {
 static DemodulationDecision_t decision_method = DEFAULT_DEMOD_DECISION;
 static DemodulationHistory_t demodulation_history[NUM_DEMODULATION_HISTORY][MAX_FHBFSK_NUM_TONES];
 
+static GoertzelBank_t tone_bank;
+static ToneSetKey_t tone_bank_key;
+static bool tone_bank_valid = false;
+
+static bool soft_output = DEFAULT_SOFT_OUTPUT;
+static float strongest_energy_mean = 0.0f;
+static float noise_energy_mean = 0.0f;
+static uint16_t llr_average_bits = 0;
+
+static float lo_table[LO_TABLE_SIZE];
+static bool lo_table_ready = false;
+static uint32_t lo_phase = 0;           // Oscillator phase at the first sample of the last symbol
+static uint16_t lo_start_index = 0;
+static float previous_real = 0.0f;
+static float previous_imag = 0.0f;
+static float phase_drift = 0.0f;        // Carrier phase rotation between symbols in radians
+static float error_energy_mean = 0.0f;
+static float symbol_energy_mean = 0.0f;
+
 /* Private function prototypes -----------------------------------------------*/
 
-static bool goertzel(DemodulationInfo_t* data);
+static bool updateToneBank();
+static bool goertzel(DemodulationInfo_t* data, uint16_t first_tone);
+static bool demodulateMfsk(DemodulationInfo_t* data);
+static bool demodulateDpsk(DemodulationInfo_t* data);
+static bool demodulateOfdm(DemodulationInfo_t* data);
+static void setSymbolBits(DemodulationInfo_t* data, uint16_t symbol);
+static void mixDown(const uint16_t* samples, uint16_t length, uint32_t* phase, uint32_t phase_increment,
+                    float* sums);
+static void outputBits(DemodulationInfo_t* data, const float* energies, uint16_t num_tones);
+static void computeLlr(DemodulationInfo_t* data, const float* energies, uint16_t num_tones);
+static float bitLlr(const float* metrics, const uint16_t* symbols, uint16_t num_symbols, uint16_t mask);
+static float logBesselI0(float x);
 
 /* Exported function definitions ---------------------------------------------*/
 
 bool Demodulate_Perform(DemodulationInfo_t* data)
 {
+  if (updateToneBank() == false) {
+    return false;
+  }
+
   switch (mod_demod_method) {
     case MOD_DEMOD_FSK:
       data->f0 = fsk_f0;
       data->f1 = fsk_f1;
-      if (goertzel(data) == false) {
+      if (goertzel(data, 0) == false) {
         return false;
       }
       break;
     case MOD_DEMOD_FHBFSK: {
-      data->f0 = Modulate_GetFhbfskFrequency(false, data->bit_index);
-      data->f1 = Modulate_GetFhbfskFrequency(true, data->bit_index);
-      if (goertzel(data) == false) {
+      uint16_t first_tone = Modulate_GetFhbfskToneIndex(false, data->bit_index);
+      data->f0 = tone_bank.frequencies[first_tone];
+      data->f1 = tone_bank.frequencies[first_tone + 1];
+      if (goertzel(data, first_tone) == false) {
         return false;
       }
       break;
     }
+    case MOD_DEMOD_MFSK:
+      return demodulateMfsk(data);
+    case MOD_DEMOD_DBPSK:
+    case MOD_DEMOD_DQPSK:
+      return demodulateDpsk(data);
+    case MOD_DEMOD_OFDM:
+      return demodulateOfdm(data);
     default:
       return false;
   }
 
   switch (decision_method) {
     case AMPLITUDE_COMPARISON:
-      return true;
+      break;
     /* In the HISTORICAL_COMPARISON method:
      * The algorithm uses prior demodulation results to handle cases where
      * there are significant energy shifts between f0 and f1 frequencies.
@@ -96,7 +160,7 @@ bool Demodulate_Perform(DemodulationInfo_t* data)
       if (buffer_length >= 1) {
         // Look at the previous bit and check for large changes
         DemodulationHistory_t previous_result =
-            demodulation_history[(buffer_index - 1) % NUM_DEMODULATION_HISTORY][frequency_index];
+            demodulation_history[(buffer_index + NUM_DEMODULATION_HISTORY - 1) % NUM_DEMODULATION_HISTORY][frequency_index];
 
         delta_energy_f0 = data->energy_f0 - previous_result.energy_f0;
         delta_energy_f1 = data->energy_f1 - previous_result.energy_f1;
@@ -135,6 +199,11 @@ bool Demodulate_Perform(DemodulationInfo_t* data)
     default:
       return false;
   }
+
+  const float energies[2] = {data->energy_f0, data->energy_f1};
+  data->num_bits = 1;
+  data->bits[0] = data->decoded_bit;
+  outputBits(data, energies, 2);
   return true;
 }
 
@@ -146,51 +215,416 @@ bool Demodulate_RegisterParams()
                      &decision_method, sizeof(uint8_t), &min_u32, &max_u32) == false) {
     return false;
   }
+
+  min_u32 = MIN_SOFT_OUTPUT;
+  max_u32 = MAX_SOFT_OUTPUT;
+  if (Param_Register(PARAM_SOFT_OUTPUT, "soft decision output", PARAM_TYPE_UINT8,
+                     &soft_output, sizeof(uint8_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
   return true;
 }
 
 /* Private function definitions ----------------------------------------------*/
 
-bool goertzel(DemodulationInfo_t* data)
+// Refreshes the coefficients when the modulation parameters change so that
+// demodulating a bit never evaluates cosf, whatever the size of the tone set
+static bool updateToneBank()
+{
+  ToneSetKey_t key;
+  memset(&key, 0, sizeof(ToneSetKey_t)); // padding takes part in the comparison
+  key.method = mod_demod_method;
+  key.fsk_f0 = fsk_f0;
+  key.fsk_f1 = fsk_f1;
+  key.fc = fc;
+  key.baud_rate = baud_rate;
+  key.freq_spacing = fhbfsk_freq_spacing;
+  key.num_tones = fhbfsk_num_tones;
+  key.mfsk_bits = mfsk_bits_per_symbol;
+  if (tone_bank_valid == true && memcmp(&key, &tone_bank_key, sizeof(ToneSetKey_t)) == 0) {
+    return true;
+  }
+
+  uint32_t frequencies[GOERTZEL_MAX_TONES];
+  uint16_t num_tones;
+  if (mod_demod_method == MOD_DEMOD_FHBFSK) {
+    num_tones = 2 * fhbfsk_num_tones;
+    for (uint16_t i = 0; i < num_tones; i++) {
+      frequencies[i] = Modulate_GetFhbfskToneFrequency(i);
+    }
+  }
+  else if (mod_demod_method == MOD_DEMOD_MFSK) {
+    num_tones = 1 << mfsk_bits_per_symbol;
+    for (uint16_t i = 0; i < num_tones; i++) {
+      frequencies[i] = Modulate_GetMfskToneFrequency(i);
+    }
+  }
+  else {
+    num_tones = 2;
+    frequencies[0] = fsk_f0;
+    frequencies[1] = fsk_f1;
+  }
+
+  tone_bank_valid = Goertzel_InitBank(&tone_bank, frequencies, num_tones, ADC_SAMPLING_RATE);
+  tone_bank_key = key;
+  return tone_bank_valid;
+}
+
+// Computes the 0 and 1 tones of a bit, which are adjacent in the tone bank
+static bool goertzel(DemodulationInfo_t* data, uint16_t first_tone)
+{
+  if (data == NULL) return false;
+
+  float energies[2];
+  if (Goertzel_Compute(&tone_bank, first_tone, 2, data->data_buf, data->buf_len,
+                       data->data_start_index, data->data_len, energies) == false) {
+    return false;
+  }
+
+  data->energy_f0 = energies[0];
+  data->energy_f1 = energies[1];
+
+  data->decoded_bit = (data->energy_f1 > data->energy_f0) ? true : false;
+  data->analysis_done = true;
+
+  return true;
+}
+
+// Takes the strongest of the M-FSK tones, all of which are filtered in one
+// pass over the block
+static bool demodulateMfsk(DemodulationInfo_t* data)
 {
   if (data == NULL) return false;
 
-  float energy_f0 = 0.0;
-  float energy_f1 = 0.0;
+  uint16_t num_tones = 1 << mfsk_bits_per_symbol;
+  float energies[1 << DEMOD_MAX_BITS_PER_SYMBOL];
+  if (Goertzel_Compute(&tone_bank, 0, num_tones, data->data_buf, data->buf_len,
+                       data->data_start_index, data->data_len, energies) == false) {
+    return false;
+  }
 
-  float omega_f0 = 2.0 * M_PI * data->f0 / ADC_SAMPLING_RATE;
-  float omega_f1 = 2.0 * M_PI * data->f1 / ADC_SAMPLING_RATE;
+  uint16_t best = (energies[1] > energies[0]) ? 1 : 0;
+  uint16_t second = 1 - best;
+  for (uint16_t i = 2; i < num_tones; i++) {
+    if (energies[i] > energies[best]) {
+      second = best;
+      best = i;
+    }
+    else if (energies[i] > energies[second]) {
+      second = i;
+    }
+  }
 
-  float coeff_f0 = 2.0 * cosf(omega_f0);
-  float coeff_f1 = 2.0 * cosf(omega_f1);
+  data->f0 = tone_bank.frequencies[second];
+  data->f1 = tone_bank.frequencies[best];
+  data->energy_f0 = energies[second];
+  data->energy_f1 = energies[best];
+  data->num_bits = mfsk_bits_per_symbol;
+  setSymbolBits(data, Modulate_GetMfskSymbol(best));
+  data->analysis_done = true;
+
+  outputBits(data, energies, num_tones);
+  return true;
+}
+
+// Differential detection of the carrier phase. Each symbol is mixed down to
+// baseband with an oscillator that runs on from the symbol before, so the
+// phase difference between the two integrated symbols is the jump that was
+// sent plus whatever a carrier frequency offset added. That rotation is
+// tracked from the decisions and taken out before the next one.
+static bool demodulateDpsk(DemodulationInfo_t* data)
+{
+  if (data == NULL || data->data_len == 0 || data->data_len > data->buf_len) return false;
+  if ((data->buf_len & (data->buf_len - 1)) != 0) return false;
+
+  if (lo_table_ready == false) {
+    for (uint16_t i = 0; i < LO_TABLE_SIZE; i++) {
+      lo_table[i] = sinf(2.0f * (float) M_PI * (float) i / LO_TABLE_SIZE);
+    }
+    lo_table_ready = true;
+  }
 
   uint16_t mask = data->buf_len - 1;
+  uint32_t phase_increment = (uint32_t) (((uint64_t) fc << 32) / ADC_SAMPLING_RATE);
+  if (data->bit_index == 0) {
+    lo_phase = 0;
+    phase_drift = 0.0f;
+    llr_average_bits = 0;
+    error_energy_mean = 0.0f;
+    symbol_energy_mean = 0.0f;
+  }
+  else {
+    lo_phase += phase_increment * ((data->data_start_index - lo_start_index) & mask);
+  }
+  lo_start_index = data->data_start_index;
+
+  // sums holds the samples, the mixed samples and the oscillator itself, which
+  // takes the ADC offset back out of the mixed sums
+  float sums[5] = {0};
+  uint32_t phase = lo_phase;
+  uint16_t start_index = data->data_start_index & mask;
+  uint16_t first_length = (start_index + data->data_len <= data->buf_len) ?
+                          data->data_len : data->buf_len - start_index;
+  mixDown(&data->data_buf[start_index], first_length, &phase, phase_increment, sums);
+  if (first_length < data->data_len) {
+    mixDown(data->data_buf, data->data_len - first_length, &phase, phase_increment, sums);
+  }
+  float mean = sums[0] / data->data_len;
+  float real = sums[1] - mean * sums[3];
+  float imag = sums[2] - mean * sums[4];
+
+  float energy = real * real + imag * imag;
+  float previous_energy = previous_real * previous_real + previous_imag * previous_imag;
+  float diff_real = real * previous_real + imag * previous_imag;
+  float diff_imag = imag * previous_real - real * previous_imag;
+  previous_real = real;
+  previous_imag = imag;
+
+  data->f0 = fc;
+  data->f1 = fc;
+  data->energy_f0 = previous_energy;
+  data->energy_f1 = energy;
+  data->analysis_done = true;
+  if (data->bit_index < DPSK_REFERENCE_SYMBOLS) {
+    data->num_bits = 0;
+    return true;
+  }
 
-  float q0_f0 = 0, q1_f0 = 0, q2_f0 = 0;
-  float q0_f1 = 0, q1_f1 = 0, q2_f1 = 0;
+  float cos_drift = cosf(phase_drift);
+  float sin_drift = sinf(phase_drift);
+  float rot_real = diff_real * cos_drift + diff_imag * sin_drift;
+  float rot_imag = diff_imag * cos_drift - diff_real * sin_drift;
+  float angle = atan2f(rot_imag, rot_real);
+
+  uint8_t quarters;
+  uint16_t symbol;
+  if (mod_demod_method == MOD_DEMOD_DBPSK) {
+    quarters = (fabsf(angle) > 0.5f * (float) M_PI) ? 2 : 0;
+    data->num_bits = 1;
+    symbol = quarters >> 1;
+  }
+  else {
+    quarters = (uint8_t) lroundf(angle / (0.5f * (float) M_PI)) & 3;
+    data->num_bits = 2;
+    symbol = quarters ^ (quarters >> 1); // Undoes the Gray code
+  }
+  setSymbolBits(data, symbol);
+  data->decoded_bit = (symbol & 1) != 0;
 
-  for (uint16_t i = 0; i < data->data_len; i++) {
-    uint16_t index = (i + data->data_start_index) & mask;
+  float error = angle - (float) quarters * 0.5f * (float) M_PI;
+  error = remainderf(error, 2.0f * (float) M_PI);
+  phase_drift = remainderf(phase_drift + DPSK_TRACKING_GAIN * error, 2.0f * (float) M_PI);
 
-    // Foertzel algorithm for F0
-    q0_f0 = coeff_f0 * q1_f0 - q2_f0 + data->data_buf[index];
-    q2_f0 = q1_f0;
-    q1_f0 = q0_f0;
+  if (soft_output == false) {
+    for (uint8_t i = 0; i < data->num_bits; i++) {
+      data->llr[i] = (data->bits[i] != 0) ? DEMOD_LLR_MAX : -DEMOD_LLR_MAX;
+    }
+    return true;
+  }
 
-    // Goertzel algorithm for F1
-    q0_f1 = coeff_f1 * q1_f1 - q2_f1 + data->data_buf[index];
-    q2_f1 = q1_f1;
-    q1_f1 = q0_f1;
+  // The two symbols together are one noncoherent symbol of twice the length,
+  // with a signal of 2A on y + y' turned by the right jump. Its noise energy
+  // is half that of y - y' turned by the decided jump.
+  const float decided[4] = {rot_real, rot_imag, -rot_real, -rot_imag};
+  if (llr_average_bits < LLR_AVERAGE_BITS) {
+    llr_average_bits++;
+  }
+  float error_energy = MAX(energy + previous_energy - 2.0f * decided[quarters], 0.0f);
+  error_energy_mean += (error_energy - error_energy_mean) / llr_average_bits;
+  symbol_energy_mean += (energy - symbol_energy_mean) / llr_average_bits;
+  float noise_energy = MAX(0.5f * error_energy_mean, FLT_MIN);
+  float signal_energy = MAX(symbol_energy_mean - noise_energy, 0.0f);
+
+  float scale = 2.0f * sqrtf(signal_energy) / noise_energy;
+  uint8_t step = (mod_demod_method == MOD_DEMOD_DBPSK) ? 2 : 1;
+  float metrics[4];
+  uint16_t symbols[4];
+  uint16_t num_symbols = 0;
+  for (uint8_t q = 0; q < 4; q += step) {
+    float combined_energy = MAX(energy + previous_energy + 2.0f * decided[q], 0.0f);
+    metrics[num_symbols] = logBesselI0(scale * sqrtf(combined_energy));
+    symbols[num_symbols] = (step == 2) ? (q >> 1) : (q ^ (q >> 1));
+    num_symbols++;
+  }
+  for (uint8_t i = 0; i < data->num_bits; i++) {
+    data->llr[i] = bitLlr(metrics, symbols, num_symbols, 1 << (data->num_bits - 1 - i));
   }
+  return true;
+}
 
-  energy_f0 = q1_f0 * q1_f0 + q2_f0 * q2_f0 - coeff_f0 * q1_f0 * q2_f0;
-  energy_f1 = q1_f1 * q1_f1 + q2_f1 * q2_f1 - coeff_f1 * q1_f1 * q2_f1;
+// One FFT per symbol, started half the cyclic prefix into it so the window
+// stays inside the symbol whether the sync was early or late by up to that
+// much. The equalization itself is in mess_ofdm.c.
+static bool demodulateOfdm(DemodulationInfo_t* data)
+{
+  if (data == NULL) return false;
 
-  data->energy_f0 = energy_f0;
-  data->energy_f1 = energy_f1;
+  bool training = data->bit_index < OFDM_TRAINING_SYMBOLS;
+  uint16_t start_index = data->data_start_index + OFDM_CP_LENGTH / 2;
+  float noise_energy;
+  float signal_energy;
+  if (Ofdm_DemodulateSymbol(data->data_buf, data->buf_len, start_index, training,
+                            data->bits, data->llr, &signal_energy, &noise_energy) == false) {
+    return false;
+  }
 
-  data->decoded_bit = (energy_f1 > energy_f0) ? true : false;
+  data->f0 = fc;
+  data->f1 = fc;
+  data->energy_f0 = noise_energy;
+  data->energy_f1 = signal_energy;
   data->analysis_done = true;
+  if (training == true) {
+    data->num_bits = 0;
+    return true;
+  }
 
+  data->num_bits = OFDM_BITS_PER_SYMBOL;
+  data->decoded_bit = data->bits[0] != 0;
+  for (uint8_t i = 0; i < data->num_bits; i++) {
+    if (soft_output == false) {
+      data->llr[i] = (data->bits[i] != 0) ? DEMOD_LLR_MAX : -DEMOD_LLR_MAX;
+    }
+    else {
+      data->llr[i] = MIN(MAX(data->llr[i], -DEMOD_LLR_MAX), DEMOD_LLR_MAX);
+    }
+  }
   return true;
 }
+
+// Unpacks a symbol of num_bits bits, sent most significant bit first
+static void setSymbolBits(DemodulationInfo_t* data, uint16_t symbol)
+{
+  for (uint8_t i = 0; i < data->num_bits; i++) {
+    data->bits[i] = (symbol >> (data->num_bits - 1 - i)) & 1;
+  }
+}
+
+static void mixDown(const uint16_t* samples, uint16_t length, uint32_t* phase, uint32_t phase_increment,
+                    float* sums)
+{
+  float sum = sums[0], real = sums[1], imag = sums[2], lo_real = sums[3], lo_imag = sums[4];
+  uint32_t p = *phase;
+  for (uint16_t n = 0; n < length; n++) {
+    const float x = (float) samples[n];
+    uint32_t index = p >> (32 - LO_TABLE_BITS);
+    float lo_sin = lo_table[index];
+    float lo_cos = lo_table[(index + LO_TABLE_SIZE / 4) & (LO_TABLE_SIZE - 1)];
+    sum += x;
+    real += x * lo_cos;
+    imag -= x * lo_sin;
+    lo_real += lo_cos;
+    lo_imag -= lo_sin;
+    p += phase_increment;
+  }
+  sums[0] = sum;
+  sums[1] = real;
+  sums[2] = imag;
+  sums[3] = lo_real;
+  sums[4] = lo_imag;
+  *phase = p;
+}
+
+static void outputBits(DemodulationInfo_t* data, const float* energies, uint16_t num_tones)
+{
+  if (soft_output == true) {
+    computeLlr(data, energies, num_tones);
+    return;
+  }
+  for (uint8_t i = 0; i < data->num_bits; i++) {
+    data->llr[i] = (data->bits[i] != 0) ? DEMOD_LLR_MAX : -DEMOD_LLR_MAX;
+  }
+}
+
+// Noncoherent M-FSK log-likelihood ratio of each bit, the log of the summed
+// likelihoods I0(2A|Xt|/N0) of the tones whose symbol has the bit set over
+// those that do not. The energy N0 of a tone with no signal is averaged over
+// the tones other than the strongest and the signal energy A^2 is what the
+// strongest tone holds above it, both over recent symbols. The estimates
+// restart with each message.
+static void computeLlr(DemodulationInfo_t* data, const float* energies, uint16_t num_tones)
+{
+  if (data->bit_index == 0) {
+    llr_average_bits = 0;
+    strongest_energy_mean = 0.0f;
+    noise_energy_mean = 0.0f;
+  }
+  if (llr_average_bits < LLR_AVERAGE_BITS) {
+    llr_average_bits++;
+  }
+  float sum = 0.0f;
+  float strongest = 0.0f;
+  for (uint16_t i = 0; i < num_tones; i++) {
+    sum += energies[i];
+    strongest = MAX(strongest, energies[i]);
+  }
+  strongest_energy_mean += (strongest - strongest_energy_mean) / llr_average_bits;
+  noise_energy_mean += ((sum - strongest) / (num_tones - 1) - noise_energy_mean) / llr_average_bits;
+
+  float noise_energy = noise_energy_mean;
+  float signal_energy = MAX(strongest_energy_mean - noise_energy, 0.0f);
+
+  float metrics[1 << DEMOD_MAX_BITS_PER_SYMBOL];
+  uint16_t symbols[1 << DEMOD_MAX_BITS_PER_SYMBOL];
+  bool estimated = noise_energy > 0.0f;
+  if (estimated == true) {
+    float scale = 2.0f * sqrtf(signal_energy) / noise_energy;
+    for (uint16_t i = 0; i < num_tones; i++) {
+      metrics[i] = logBesselI0(scale * sqrtf(energies[i]));
+      symbols[i] = Modulate_GetMfskSymbol(i);
+    }
+  }
+
+  for (uint8_t i = 0; i < data->num_bits; i++) {
+    uint16_t mask = 1 << (data->num_bits - 1 - i);
+    bool bit = data->bits[i] != 0;
+    float llr = (bit == true) ? DEMOD_LLR_MAX : -DEMOD_LLR_MAX; // Until there is an estimate
+
+    if (estimated == true) {
+      llr = bitLlr(metrics, symbols, num_tones, mask);
+
+      // The historical decision can overrule the energies, the bit is then an
+      // erasure rather than a confident error
+      if ((llr > 0.0f) != bit) {
+        llr = 0.0f;
+      }
+    }
+    data->llr[i] = llr;
+  }
+}
+
+// Log-sum-exp of the metrics of the symbols with a bit set over those without
+// it, each relative to its largest term, clamped to +/-DEMOD_LLR_MAX
+static float bitLlr(const float* metrics, const uint16_t* symbols, uint16_t num_symbols, uint16_t mask)
+{
+  float largest[2] = {-INFINITY, -INFINITY};
+  for (uint16_t t = 0; t < num_symbols; t++) {
+    uint8_t half = (symbols[t] & mask) != 0;
+    largest[half] = MAX(largest[half], metrics[t]);
+  }
+  float sums[2] = {0.0f, 0.0f};
+  for (uint16_t t = 0; t < num_symbols; t++) {
+    uint8_t half = (symbols[t] & mask) != 0;
+    sums[half] += expf(metrics[t] - largest[half]);
+  }
+  float llr = largest[1] + logf(sums[1]) - largest[0] - logf(sums[0]);
+  return MIN(MAX(llr, -DEMOD_LLR_MAX), DEMOD_LLR_MAX);
+}
+
+// ln(I0(x)) from its power series for small x and its asymptotic expansion
+// otherwise, within 1e-3 everywhere
+static float logBesselI0(float x)
+{
+  if (x < 5.0f) {
+    float q = 0.25f * x * x;
+    float term = 1.0f;
+    float sum = 1.0f;
+    for (uint8_t k = 1; k < 10; k++) {
+      term *= q / (float) (k * k);
+      sum += term;
+    }
+    return logf(sum);
+  }
+  float r = 1.0f / x;
+  return x - 0.5f * logf(2.0f * (float) M_PI * x) +
+         logf(1.0f + r * (1.0f / 8.0f + r * (9.0f / 128.0f + r * (225.0f / 3072.0f))));
+}
@@ -9,6 +9,9 @@
 
 #include "mess_packet.h"
 #include "mess_error_correction.h"
+#include "crc.h"
+#include "conv_code.h"
+#include "reed_solomon.h"
 
 #include "cfg_defaults.h"
 #include "cfg_parameters.h"
@@ -20,7 +23,12 @@
 
 /* Private define ------------------------------------------------------------*/
 
+#define CONVOLUTIONAL_CRC_BITS  16
+#define REED_SOLOMON_CRC_BYTES  2
 
+#if PACKET_DATA_MAX_LENGTH_BYTES + REED_SOLOMON_CRC_BYTES + MAX_RS_PARITY > REED_SOLOMON_MAX_LENGTH
+#error "A full payload, its CRC and the parity must fit in one Reed-Solomon codeword"
+#endif
 
 /* Private macro -------------------------------------------------------------*/
 
@@ -29,6 +37,12 @@
 /* Private variables ---------------------------------------------------------*/
 
 static ErrorCorrectionMethod_t error_correction_method = DEFAULT_ERROR_CORRECTION;
+static uint8_t reed_solomon_parity = DEFAULT_RS_PARITY;
+
+// Data and CRC of a convolutional or Reed-Solomon packet on their own, and
+// their code bits
+static uint8_t uncoded_bits[PACKET_MAX_LENGTH_BYTES];
+static uint8_t coded_bits[PACKET_MAX_LENGTH_BYTES];
 
 /* Private function prototypes -----------------------------------------------*/
 
@@ -46,6 +60,11 @@ bool checkChecksum8(BitMessage_t* bit_msg, bool* error);
 bool checkChecksum16(BitMessage_t* bit_msg, bool* error);
 bool checkChecksum32(BitMessage_t* bit_msg, bool* error);
 
+bool addConvolutional(BitMessage_t* bit_msg, ConvCodeRate_t rate);
+bool decodeConvolutional(BitMessage_t* bit_msg, ConvCodeRate_t rate);
+bool addReedSolomon(BitMessage_t* bit_msg);
+bool decodeReedSolomon(BitMessage_t* bit_msg);
+
 /* Exported function definitions ---------------------------------------------*/
 
 bool ErrorCorrection_AddCorrection(BitMessage_t* bit_msg)
@@ -93,6 +112,14 @@ bool ErrorCorrection_AddCorrection(BitMessage_t* bit_msg)
       }
       bit_msg->final_length += 32;
       return Packet_Add32(bit_msg, checksum_32);
+    case CONVOLUTIONAL_1_2:
+      return addConvolutional(bit_msg, CONV_CODE_RATE_1_2);
+    case CONVOLUTIONAL_2_3:
+      return addConvolutional(bit_msg, CONV_CODE_RATE_2_3);
+    case CONVOLUTIONAL_3_4:
+      return addConvolutional(bit_msg, CONV_CODE_RATE_3_4);
+    case REED_SOLOMON:
+      return addReedSolomon(bit_msg);
     default:
       return false;
   }
@@ -113,12 +140,41 @@ bool ErrorCorrection_CheckCorrection(BitMessage_t* bit_msg, bool* error)
       return checkChecksum16(bit_msg, error);
     case CHECKSUM_32:
       return checkChecksum32(bit_msg, error);
+    case CONVOLUTIONAL_1_2:
+    case CONVOLUTIONAL_2_3:
+    case CONVOLUTIONAL_3_4:
+    case REED_SOLOMON:
+      // Already decoded to data and CRC-16 by ErrorCorrection_CorrectErrors
+      return checkCrc16(bit_msg, error);
+    default:
+      return false;
+  }
+}
+
+bool ErrorCorrection_CorrectErrors(BitMessage_t* bit_msg)
+{
+  switch (error_correction_method) {
+    case CRC_8:
+    case CRC_16:
+    case CRC_32:
+    case CHECKSUM_8:
+    case CHECKSUM_16:
+    case CHECKSUM_32:
+      return true;
+    case CONVOLUTIONAL_1_2:
+      return decodeConvolutional(bit_msg, CONV_CODE_RATE_1_2);
+    case CONVOLUTIONAL_2_3:
+      return decodeConvolutional(bit_msg, CONV_CODE_RATE_2_3);
+    case CONVOLUTIONAL_3_4:
+      return decodeConvolutional(bit_msg, CONV_CODE_RATE_3_4);
+    case REED_SOLOMON:
+      return decodeReedSolomon(bit_msg);
     default:
       return false;
   }
 }
 
-bool ErrorCorrection_CheckLength(uint16_t* length)
+bool ErrorCorrection_CheckLength(uint16_t data_bits, uint16_t* length)
 {
   switch (error_correction_method) {
     case CRC_8:
@@ -133,6 +189,18 @@ bool ErrorCorrection_CheckLength(uint16_t* length)
     case CHECKSUM_32:
       *length = 32;
       return true;
+    case CONVOLUTIONAL_1_2:
+      *length = ConvCode_EncodedLength(data_bits + CONVOLUTIONAL_CRC_BITS, CONV_CODE_RATE_1_2) - data_bits;
+      return true;
+    case CONVOLUTIONAL_2_3:
+      *length = ConvCode_EncodedLength(data_bits + CONVOLUTIONAL_CRC_BITS, CONV_CODE_RATE_2_3) - data_bits;
+      return true;
+    case CONVOLUTIONAL_3_4:
+      *length = ConvCode_EncodedLength(data_bits + CONVOLUTIONAL_CRC_BITS, CONV_CODE_RATE_3_4) - data_bits;
+      return true;
+    case REED_SOLOMON:
+      *length = 8 * (REED_SOLOMON_CRC_BYTES + reed_solomon_parity);
+      return true;
     default:
       return false;
   }
@@ -147,6 +215,13 @@ bool ErrorCorrection_RegisterParams(void)
     return false;
   }
 
+  min_u32 = MIN_RS_PARITY;
+  max_u32 = MAX_RS_PARITY;
+  if (Param_Register(PARAM_RS_PARITY, "Reed-Solomon parity bytes", PARAM_TYPE_UINT8,
+      &reed_solomon_parity, sizeof(uint8_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
   return true;
 }
 
@@ -154,124 +229,31 @@ bool ErrorCorrection_RegisterParams(void)
 
 bool calculateCrc8(BitMessage_t* bit_msg, uint8_t* crc)
 {
-  if (bit_msg == NULL || crc == NULL) {
+  if (bit_msg == NULL || crc == NULL || bit_msg->final_length < 8) {
     return false;
   }
 
-  uint8_t polynomial = 0x07;
-  *crc = 0;
-
-  uint16_t byte_count = (bit_msg->final_length - 8) / 8;
-  uint16_t remaining_bits = (bit_msg->final_length - 8) % 8;
-
-  for (uint16_t i = 0; i < byte_count; i++) {
-    *crc ^= bit_msg->data[i];
-
-    for (uint16_t j = 0; j < 8; j++) {
-      if (*crc & 0x80) {
-        *crc = (*crc << 1) ^ polynomial;
-      }
-      else {
-        *crc = *crc << 1;
-      }
-    }
-  }
-
-  if (remaining_bits > 0) {
-    uint8_t last_byte = bit_msg->data[byte_count] & (0xFF << (8 - remaining_bits));
-    *crc ^= last_byte;
-
-    for (uint8_t i = 0; i < remaining_bits; i++) {
-      if (*crc & 0x80) {
-        *crc = (*crc << 1) ^ polynomial;
-      }
-      else {
-        *crc = *crc << 1;
-      }
-    }
-  }
+  *crc = Crc_Calculate8(bit_msg->data, bit_msg->final_length - 8);
   return true;
 }
 
 bool calculateCrc16(BitMessage_t* bit_msg, uint16_t* crc)
 {
-  if (bit_msg == NULL || crc == NULL) {
+  if (bit_msg == NULL || crc == NULL || bit_msg->final_length < 16) {
     return false;
   }
 
-  uint16_t polynomial = 0x1021;
-  *crc = 0xFFFF;
-
-  uint16_t byte_count = (bit_msg->final_length - 16) / 8;
-  uint16_t remaining_bits = (bit_msg->final_length - 16) % 8;
-
-  for (uint16_t i = 0; i < byte_count; i++) {
-    *crc ^= (uint16_t) bit_msg->data[i] << 8;
-
-    for (uint16_t j = 0; j < 8; j++) {
-      if (*crc & 0x8000) {
-        *crc = (*crc << 1) ^ polynomial;
-      }
-      else {
-        *crc = *crc << 1;
-      }
-    }
-  }
-
-  if (remaining_bits > 0) {
-    uint8_t last_byte = bit_msg->data[byte_count] & (0xFF << (8 - remaining_bits));
-    *crc ^= (uint16_t)last_byte << 8;
-
-    for (uint16_t j = 0; j < remaining_bits; j++) {
-      if (*crc & 0x8000) {
-        *crc = (*crc << 1) ^ polynomial;
-      }
-      else {
-        *crc = *crc << 1;
-      }
-    }
-  }
+  *crc = Crc_Calculate16(bit_msg->data, bit_msg->final_length - 16);
   return true;
 }
 
 bool calculateCrc32(BitMessage_t* bit_msg, uint32_t* crc)
 {
-  if (bit_msg == NULL || crc == NULL) {
+  if (bit_msg == NULL || crc == NULL || bit_msg->final_length < 32) {
     return false;
   }
 
-  uint32_t polynomial = 0x04C11DB7;
-  *crc = 0xFFFFFFFF;
-
-  uint16_t byte_count = (bit_msg->final_length - 32) / 8;
-  uint16_t remaining_bits = (bit_msg->final_length - 32) % 8;
-
-  for (uint16_t i = 0; i < byte_count; i++) {
-    *crc ^= (uint32_t) bit_msg->data[i] << 24;
-
-    for (uint16_t j = 0; j < 8; j++) {
-      if (*crc & 0x80000000) {
-        *crc = (*crc << 1) ^ polynomial;
-      }
-      else {
-        *crc = *crc << 1;
-      }
-    }
-  }
-
-  if (remaining_bits > 0) {
-    uint8_t last_byte = bit_msg->data[byte_count] & (0xFF << (8 - remaining_bits));
-    *crc ^= ((uint32_t)last_byte << 24);
-
-    for (size_t j = 0; j < remaining_bits; j++) {
-      if (*crc & 0x80000000) {
-        *crc = (*crc << 1) ^ 0x04C11DB7;
-      } else {
-        *crc = *crc << 1;
-      }
-    }
-  }
-  *crc = ~*crc;
+  *crc = Crc_Calculate32(bit_msg->data, bit_msg->final_length - 32);
   return true;
 }
 
@@ -465,3 +447,97 @@ bool checkChecksum32(BitMessage_t* bit_msg, bool* error)
   *error = actual_checksum != theoretical_checksum;
   return true;
 }
+
+// The header stays as it is so the receiver can read the length before the
+// rest arrives. The CRC still covers it.
+bool addConvolutional(BitMessage_t* bit_msg, ConvCodeRate_t rate)
+{
+  uint16_t data_end = bit_msg->preamble_length + bit_msg->data_len_bits;
+  if (bit_msg->bit_count > data_end) {
+    return false;
+  }
+
+  // Data shorter than its length field is sent padded with the zeros past it
+  bit_msg->bit_count = data_end;
+  if (Packet_Add16(bit_msg, Crc_Calculate16(bit_msg->data, data_end)) == false) {
+    return false;
+  }
+
+  uint16_t position = bit_msg->preamble_length;
+  uint16_t uncoded_length = bit_msg->data_len_bits + CONVOLUTIONAL_CRC_BITS;
+  if (Packet_GetBits(bit_msg, &position, uncoded_length, uncoded_bits) == false ||
+      ConvCode_Encode(uncoded_bits, uncoded_length, rate, coded_bits) == false) {
+    return false;
+  }
+
+  bit_msg->bit_count = bit_msg->preamble_length;
+  if (Packet_AddBits(bit_msg, coded_bits, ConvCode_EncodedLength(uncoded_length, rate)) == false) {
+    return false;
+  }
+  return bit_msg->bit_count == bit_msg->final_length;
+}
+
+bool decodeConvolutional(BitMessage_t* bit_msg, ConvCodeRate_t rate)
+{
+  uint16_t uncoded_length = bit_msg->data_len_bits + CONVOLUTIONAL_CRC_BITS;
+  uint16_t coded_length = ConvCode_EncodedLength(uncoded_length, rate);
+  if (bit_msg->bit_count < bit_msg->preamble_length + coded_length || bit_msg->llr == NULL) {
+    return false;
+  }
+
+  if (ConvCode_Decode(&bit_msg->llr[bit_msg->preamble_length], uncoded_length, rate, uncoded_bits) == false) {
+    return false;
+  }
+
+  bit_msg->bit_count = bit_msg->preamble_length;
+  if (Packet_AddBits(bit_msg, uncoded_bits, uncoded_length) == false) {
+    return false;
+  }
+  bit_msg->final_length = bit_msg->bit_count;
+  return true;
+}
+
+bool addReedSolomon(BitMessage_t* bit_msg)
+{
+  uint16_t data_end = bit_msg->preamble_length + bit_msg->data_len_bits;
+  if (bit_msg->bit_count > data_end) {
+    return false;
+  }
+
+  bit_msg->bit_count = data_end;
+  if (Packet_Add16(bit_msg, Crc_Calculate16(bit_msg->data, data_end)) == false) {
+    return false;
+  }
+
+  // The header leaves the bytes unaligned in the packet
+  uint16_t position = bit_msg->preamble_length;
+  uint16_t num_data = bit_msg->data_len_bits / 8 + REED_SOLOMON_CRC_BYTES;
+  if (Packet_GetBits(bit_msg, &position, 8 * num_data, uncoded_bits) == false ||
+      ReedSolomon_Encode(uncoded_bits, num_data, reed_solomon_parity, coded_bits) == false ||
+      Packet_AddBits(bit_msg, coded_bits, 8 * reed_solomon_parity) == false) {
+    return false;
+  }
+  return bit_msg->bit_count == bit_msg->final_length;
+}
+
+bool decodeReedSolomon(BitMessage_t* bit_msg)
+{
+  uint16_t num_data = bit_msg->data_len_bits / 8 + REED_SOLOMON_CRC_BYTES;
+  uint16_t position = bit_msg->preamble_length;
+  if (Packet_GetBits(bit_msg, &position, 8 * (num_data + reed_solomon_parity), uncoded_bits) == false) {
+    return false;
+  }
+
+  // Too many errors to correct is left to the CRC to report
+  uint8_t num_corrected;
+  if (ReedSolomon_Decode(uncoded_bits, num_data + reed_solomon_parity, reed_solomon_parity,
+      &num_corrected) == true && num_corrected > 0) {
+    bit_msg->bit_count = bit_msg->preamble_length;
+    if (Packet_AddBits(bit_msg, uncoded_bits, 8 * num_data) == false) {
+      return false;
+    }
+  }
+  bit_msg->bit_count = bit_msg->preamble_length + 8 * num_data;
+  bit_msg->final_length = bit_msg->bit_count;
+  return true;
+}
@@ -9,9 +9,11 @@
 
 #include "mess_adc.h"
 #include "mess_feedback.h"
-#include "usb_comm.h"
+#include "mess_goertzel.h"
 #include "dac_waveform.h"
+#include "sample_ring.h"
 #include <stdbool.h>
+#include <math.h>
 
 /* Private typedef -----------------------------------------------------------*/
 
@@ -19,7 +21,15 @@
 
 /* Private define ------------------------------------------------------------*/
 
-#define PRINT_CHUNK_SIZE    50
+// The feedback ADC is triggered with the DAC, so its samples come at
+// DAC_SAMPLE_RATE. Tone measurement windows slide over the end of the
+// capture, which covers the test tone and the silence after it until the ADC
+// was stopped. At that rate the tone alone nearly fills the ring, so the span
+// is whatever the ring still holds.
+#define MEASURE_LENGTH      8192
+#define MEASURE_STRIDE      1024
+#define TONE_SPAN           (FEEDBACK_TEST_DURATION_MS * DAC_SAMPLE_RATE / 1000 + 2 * ADC_BUFFER_SIZE)
+#define MEASURE_SPAN        ((TONE_SPAN < PROCESSING_BUFFER_SIZE) ? TONE_SPAN : PROCESSING_BUFFER_SIZE)
 
 /* Private macro -------------------------------------------------------------*/
 
@@ -29,8 +39,9 @@
 
 static uint16_t feedback_buffer[PROCESSING_BUFFER_SIZE];
 
-static volatile uint16_t feedback_buffer_start_index = 0;
-static volatile uint16_t feedback_buffer_end_index = 0;
+static SampleRing_t feedback_ring;
+
+static GoertzelBank_t tone_bank;
 
 /* Private function prototypes -----------------------------------------------*/
 
@@ -40,8 +51,9 @@ static volatile uint16_t feedback_buffer_end_index = 0;
 
 bool Feedback_Init()
 {
-  feedback_buffer_start_index = 0;
-  feedback_buffer_end_index = 0;
+  if (SampleRing_Init(&feedback_ring, feedback_buffer, PROCESSING_BUFFER_SIZE, ADC_WRITE_AHEAD) == false) {
+    return false;
+  }
   if (ADC_RegisterFeedbackBuffer(feedback_buffer) == false) return false;
 
   return true;
@@ -49,30 +61,49 @@ bool Feedback_Init()
 
 void Feedback_IncrementEndIndex()
 {
-  feedback_buffer_end_index = (feedback_buffer_end_index + ADC_BUFFER_SIZE / 2) % PROCESSING_BUFFER_SIZE;
+  SampleRing_Commit(&feedback_ring, ADC_BUFFER_SIZE / 2);
 }
 
-void Feedback_DumpData()
+void Feedback_Reset()
 {
-  char print_buffer[PRINT_CHUNK_SIZE * 7 + 1]; // Accommodates max uint16 length + \r\n + 1
-  uint16_t print_index = 0;
-  CDC_Transmit_HS((uint8_t*) "\b\b\r\n\r\n", 6);
-  const uint16_t data_len = DAC_SAMPLE_RATE / 1000 * FEEDBACK_TEST_DURATION_MS;
-  if (xSemaphoreTake(usbSemaphoreHandle, portMAX_DELAY) == pdTRUE) {
-    for (uint16_t i = 0; i < data_len; i += PRINT_CHUNK_SIZE) {
-      print_index = 0;
-
-      for (uint16_t j = 0; j < PRINT_CHUNK_SIZE && (i + j) < data_len; j++) {
-        print_index += sprintf(&print_buffer[print_index], "%u\r\n", feedback_buffer[i + j]);
-      }
-
-      CDC_Transmit_HS((uint8_t*) print_buffer, print_index);
-      osDelay(10);
+  SampleRing_Reset(&feedback_ring);
+}
+
+bool Feedback_MeasureTone(uint32_t freq_hz, float* amplitude)
+{
+  if (amplitude == NULL) {
+    return false;
+  }
+
+  // A capture longer than the ring keeps its latest window
+  SampleRing_Resync(&feedback_ring);
+  uint32_t available = SampleRing_Available(&feedback_ring);
+  uint32_t span = (available < MEASURE_SPAN) ? available : MEASURE_SPAN;
+  if (span < MEASURE_LENGTH) {
+    return false;
+  }
+
+  if (Goertzel_InitBank(&tone_bank, &freq_hz, 1, DAC_SAMPLE_RATE) == false) {
+    return false;
+  }
+
+  // The window that lies wholly inside the tone has the most energy. Each has
+  // its mean removed, as the leakage of the ADC offset would otherwise swamp
+  // weak tones
+  const uint32_t first_index = SampleRing_GetReadIndex(&feedback_ring) + available - span;
+  float best = 0.0f;
+  for (uint32_t offset = 0; offset + MEASURE_LENGTH <= span; offset += MEASURE_STRIDE) {
+    float energy;
+    if (Goertzel_ComputeWithoutMean(&tone_bank, 0, 1, feedback_buffer, PROCESSING_BUFFER_SIZE,
+                                    (uint16_t) (first_index + offset), MEASURE_LENGTH, &energy) == false) {
+      return false;
+    }
+    if (energy > best) {
+      best = energy;
     }
   }
-  xSemaphoreGive(usbSemaphoreHandle);
-  memset(feedback_buffer, 0, PROCESSING_BUFFER_SIZE * sizeof(uint16_t));
-  feedback_buffer_end_index = 0;
+  *amplitude = 2.0f * sqrtf(fmaxf(best, 0.0f)) / MEASURE_LENGTH;
+  return true;
 }
 
 /* Private function definitions ----------------------------------------------*/
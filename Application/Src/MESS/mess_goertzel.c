@@ -0,0 +1,192 @@
+/*
+ * mess_goertzel.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "mess_goertzel.h"
+#include <math.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool computeBank(const GoertzelBank_t* bank, uint16_t first_tone, uint16_t num_tones,
+                        const uint16_t* buffer, uint16_t buf_len, uint16_t start_index, uint16_t length,
+                        float offset, float* energies);
+static void filterLanes(const uint16_t* samples, uint16_t length, float offset, const float* coeffs,
+                        float* q1, float* q2);
+static void filterPair(const uint16_t* samples, uint16_t length, float offset, const float* coeffs,
+                       float* q1, float* q2);
+
+/* Exported function definitions ---------------------------------------------*/
+
+bool Goertzel_InitBank(GoertzelBank_t* bank, const uint32_t* frequencies, uint16_t num_tones,
+                       uint32_t sample_rate)
+{
+  if (bank == NULL || frequencies == NULL || num_tones == 0 || num_tones > GOERTZEL_MAX_TONES) {
+    return false;
+  }
+  if (sample_rate == 0) {
+    return false;
+  }
+
+  memset(bank, 0, sizeof(GoertzelBank_t));
+  bank->num_tones = num_tones;
+  for (uint16_t i = 0; i < num_tones; i++) {
+    float omega = 2.0f * (float) M_PI * (float) frequencies[i] / (float) sample_rate;
+    bank->frequencies[i] = frequencies[i];
+    bank->coeffs[i] = 2.0f * cosf(omega);
+  }
+  return true;
+}
+
+bool Goertzel_Compute(const GoertzelBank_t* bank, uint16_t first_tone, uint16_t num_tones,
+                      const uint16_t* buffer, uint16_t buf_len, uint16_t start_index, uint16_t length,
+                      float* energies)
+{
+  return computeBank(bank, first_tone, num_tones, buffer, buf_len, start_index, length, 0.0f, energies);
+}
+
+bool Goertzel_ComputeWithoutMean(const GoertzelBank_t* bank, uint16_t first_tone, uint16_t num_tones,
+                                 const uint16_t* buffer, uint16_t buf_len, uint16_t start_index,
+                                 uint16_t length, float* energies)
+{
+  if (buffer == NULL || length == 0 || buf_len == 0 || (buf_len & (buf_len - 1)) != 0) {
+    return false;
+  }
+
+  uint32_t sum = 0;
+  for (uint16_t i = 0; i < length; i++) {
+    sum += buffer[(start_index + i) & (buf_len - 1)];
+  }
+  return computeBank(bank, first_tone, num_tones, buffer, buf_len, start_index, length,
+                     (float) sum / length, energies);
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// Filters the block with offset taken off every sample
+static bool computeBank(const GoertzelBank_t* bank, uint16_t first_tone, uint16_t num_tones,
+                        const uint16_t* buffer, uint16_t buf_len, uint16_t start_index, uint16_t length,
+                        float offset, float* energies)
+{
+  if (bank == NULL || buffer == NULL || energies == NULL) {
+    return false;
+  }
+  if (num_tones == 0 || first_tone + num_tones > bank->num_tones) {
+    return false;
+  }
+  if (buf_len == 0 || (buf_len & (buf_len - 1)) != 0 || length > buf_len) {
+    return false;
+  }
+
+  start_index &= buf_len - 1;
+  // Fast path when the block is contiguous, otherwise the tail of the ring
+  // then its head
+  uint16_t first_length = (start_index + length <= buf_len) ? length : buf_len - start_index;
+  uint16_t second_length = length - first_length;
+
+  for (uint16_t tone = 0; tone < num_tones; tone += GOERTZEL_LANES) {
+    float coeffs[GOERTZEL_LANES];
+    float q1[GOERTZEL_LANES] = {0};
+    float q2[GOERTZEL_LANES] = {0};
+
+    // Unused lanes run with a zero coefficient and are discarded
+    for (uint8_t k = 0; k < GOERTZEL_LANES; k++) {
+      uint16_t index = first_tone + tone + k;
+      coeffs[k] = (tone + k < num_tones) ? bank->coeffs[index] : 0.0f;
+    }
+
+    // A pair of tones, as in plain FSK or one FHBFSK hop, does not pay for
+    // the unused lanes
+    if (num_tones - tone <= 2) {
+      filterPair(&buffer[start_index], first_length, offset, coeffs, q1, q2);
+      if (second_length > 0) {
+        filterPair(buffer, second_length, offset, coeffs, q1, q2);
+      }
+    }
+    else {
+      filterLanes(&buffer[start_index], first_length, offset, coeffs, q1, q2);
+      if (second_length > 0) {
+        filterLanes(buffer, second_length, offset, coeffs, q1, q2);
+      }
+    }
+
+    for (uint8_t k = 0; k < GOERTZEL_LANES && tone + k < num_tones; k++) {
+      energies[tone + k] = q1[k] * q1[k] + q2[k] * q2[k] - coeffs[k] * q1[k] * q2[k];
+    }
+  }
+  return true;
+}
+
+// Runs GOERTZEL_LANES independent recurrences over the same samples. The
+// lanes have no dependency on each other so they keep the FPU pipeline full
+// and map onto SIMD registers where the target has them.
+static void filterLanes(const uint16_t* samples, uint16_t length, float offset, const float* coeffs,
+                        float* q1, float* q2)
+{
+  float c[GOERTZEL_LANES];
+  float s1[GOERTZEL_LANES];
+  float s2[GOERTZEL_LANES];
+  for (uint8_t k = 0; k < GOERTZEL_LANES; k++) {
+    c[k] = coeffs[k];
+    s1[k] = q1[k];
+    s2[k] = q2[k];
+  }
+
+  for (uint16_t n = 0; n < length; n++) {
+    const float x = (float) samples[n] - offset;
+    for (uint8_t k = 0; k < GOERTZEL_LANES; k++) {
+      float s0 = c[k] * s1[k] - s2[k] + x;
+      s2[k] = s1[k];
+      s1[k] = s0;
+    }
+  }
+
+  for (uint8_t k = 0; k < GOERTZEL_LANES; k++) {
+    q1[k] = s1[k];
+    q2[k] = s2[k];
+  }
+}
+
+static void filterPair(const uint16_t* samples, uint16_t length, float offset, const float* coeffs,
+                       float* q1, float* q2)
+{
+  float c0 = coeffs[0], c1 = coeffs[1];
+  float s1_0 = q1[0], s2_0 = q2[0];
+  float s1_1 = q1[1], s2_1 = q2[1];
+
+  for (uint16_t n = 0; n < length; n++) {
+    const float x = (float) samples[n] - offset;
+    float s0_0 = c0 * s1_0 - s2_0 + x;
+    float s0_1 = c1 * s1_1 - s2_1 + x;
+    s2_0 = s1_0;
+    s1_0 = s0_0;
+    s2_1 = s1_1;
+    s1_1 = s0_1;
+  }
+
+  q1[0] = s1_0;
+  q2[0] = s2_0;
+  q1[1] = s1_1;
+  q2[1] = s2_1;
+}
@@ -12,14 +12,20 @@
 #include "mess_demodulate.h"
 #include "mess_packet.h"
 #include "mess_main.h"
+#include "mess_modulate.h"
 #include "cfg_defaults.h"
 #include "cfg_parameters.h"
 #include "usb_comm.h"
+#include "sample_ring.h"
+#include "bit_stream.h"
+#include "golay.h"
+#include "compress.h"
 #include "cmsis_os.h"
 #include "arm_math.h"
 #include "arm_const_structs.h"
 #include <stdbool.h>
 #include <string.h>
+#include <math.h>
 
 /* Private typedef -----------------------------------------------------------*/
 
@@ -33,6 +39,13 @@ typedef struct {
   uint16_t start_index;
 } FFTInfo_t;
 
+typedef struct {
+  float real;
+  float imag;
+  float cos_w;
+  float sin_w;
+} SlidingBin_t;
+
 /* Private define ------------------------------------------------------------*/
 
 #define REDUCED_SENSITIVITY
@@ -50,6 +63,20 @@ typedef struct {
 #define FREQUENCY_INDEX_0         16  // 30 kHz
 #define FREQUENCY_INDEX_1         17  // 31.875 kHz
 
+#define SLIDING_NUM_BINS          2
+#define SLIDING_RESYNC_SAMPLES    4096  // Slides before the bins are recomputed to bound float drift
+
+#define CFAR_NUM_BINS             2
+#define CFAR_GUARD_CELLS          FFT_OVERLAP // Cells overlapping the cell under test
+#define CFAR_CONFIRM_CELLS        2
+#define CFAR_RESYNC_CELLS         4096        // Updates before the noise sums are recomputed
+
+#define MATCHED_FILTER_SIZE       2048
+#define CHIRP_STEP_SAMPLES        (CHIRP_STEP_DURATION_US * (ADC_SAMPLING_RATE / 1000) / 1000)
+#define CHIRP_LENGTH              (CHIRP_PREAMBLE_STEPS * CHIRP_STEP_SAMPLES)
+#define MATCHED_FILTER_HOP        (MATCHED_FILTER_SIZE - CHIRP_LENGTH + 1) // Lags without circular wrap per block
+#define MATCHED_FILTER_GUARD      64  // Lags held back so a peak's main lobe is not split across blocks
+
 #define LEN_10_THRESH             6.0f
 #define LEN_5_THRESH              8.0f
 #define LEN_3_THRESH              16.0f
@@ -75,8 +102,7 @@ static DemodulationInfo_t analysis_blocks[MAX_ANALYSIS_BUFFER_SIZE];
 
 static uint16_t input_buffer[PROCESSING_BUFFER_SIZE];
 
-static volatile uint16_t buffer_start_index = 0;
-static volatile uint16_t buffer_end_index = 0;
+static SampleRing_t input_ring;
 
 static volatile uint16_t analysis_count1 = 0;
 static volatile uint16_t analysis_count2 = 0;
@@ -84,6 +110,9 @@ static volatile uint16_t analysis_count2 = 0;
 static volatile uint8_t analysis_start_index = 0;
 static volatile uint8_t analysis_length = 0;
 static uint16_t bit_index = 0;
+static uint32_t header_rejects = 0;
+static uint32_t symbol_clock_fraction = 0; // Sample fraction carried into the next block, Q16
+static uint32_t queued_samples = 0;        // Samples of blocks segmented but not yet demodulated
 
 static float fft_input_buffer[FFT_SIZE];
 static float fft_output_buffer[FFT_SIZE];
@@ -96,6 +125,33 @@ static uint16_t fft_analysis_length = 0;
 
 static arm_rfft_fast_instance_f32 fft_handle;
 
+static SlidingBin_t sliding_bins[SLIDING_NUM_BINS];
+static uint32_t sliding_sum = 0;       // Sum of the samples in the window
+static uint32_t sliding_sum_sq = 0;    // Sum of the squared samples in the window
+static uint16_t sliding_start_index = 0;
+static uint16_t sliding_slide_count = 0;
+static bool sliding_valid = false;
+
+static uint8_t cfar_reference_cells = DEFAULT_CFAR_REFERENCE_CELLS;
+static uint8_t cfar_pfa_exponent = DEFAULT_CFAR_PFA_EXPONENT;
+static float cfar_noise_sum[CFAR_NUM_BINS];  // Sum of each bin over the reference cells
+static uint8_t cfar_window_cells = 0;        // Reference cells currently in the sums
+static uint8_t cfar_window_size = 0;         // Reference cells the sums were started with
+static uint8_t cfar_hit_count = 0;           // Consecutive cells over the threshold
+static uint16_t cfar_update_count = 0;
+
+static float chirp_reference[MATCHED_FILTER_SIZE]; // Conjugated spectrum of the chirp
+static float chirp_reference_energy = 0.0f;
+static uint32_t chirp_reference_start = 0;
+static uint32_t chirp_reference_end = 0;
+static float mf_time_buffer[MATCHED_FILTER_SIZE];
+static float mf_freq_buffer[MATCHED_FILTER_SIZE];
+static float mf_output_buffer[MATCHED_FILTER_SIZE];
+static arm_rfft_fast_instance_f32 mf_fft_handle;
+static float chirp_threshold = DEFAULT_CHIRP_THRESHOLD;
+static float sync_quality = 0.0f;
+static uint8_t decompressed[PACKET_DATA_MAX_LENGTH_BYTES];
+
 //static volatile uint32_t len_1_hits = 0;
 //static volatile uint32_t len_3_hits = 0;
 static volatile uint32_t len_6_hits = 0;
@@ -106,20 +162,37 @@ static MsgStartFunctions_t message_start_function = DEFAULT_MSG_START_FCN;
 /* Private function prototypes -----------------------------------------------*/
 
 static uint16_t getBufferLength();
+static void resetDetectorHistory();
 static bool messageStartWithThreshold();
 static bool messageStartWithFrequency();
+static bool messageStartWithSlidingGoertzel();
+static void slidingGoertzelReset(const uint16_t start_index);
+static void slidingGoertzelAdvance(const uint16_t start_index);
+static bool computeFftAnalysis();
+static bool messageStartWithCfar();
+static void cfarResetNoise();
+static float cfarCell(const uint16_t position, const uint8_t bin);
+static bool messageStartWithChirp();
+static void generateChirpReference();
+static uint16_t correlateChirp(const uint16_t start_index, float* quality);
+static bool checkStartConditions();
 static float indexToFrequency(uint16_t index);
 static uint16_t frequencyToIndex(float frequency);
 static bool checkFftConditions(const uint16_t check_length, const float multiplier);
 static uint16_t findStartPosition(const uint16_t analysis_index, const uint16_t check_length);
+static bool correctCodeword(BitMessage_t* bit_msg, uint16_t position, uint16_t* data);
+static bool rejectHeader(BitMessage_t* bit_msg);
 
 /* Exported function definitions ---------------------------------------------*/
 
 bool Input_Init()
 {
-  buffer_start_index = 0;
-  buffer_end_index = 0;
+  if (SampleRing_Init(&input_ring, input_buffer, PROCESSING_BUFFER_SIZE, ADC_WRITE_AHEAD) == false) {
+    return false;
+  }
   bit_index = 0;
+  symbol_clock_fraction = 0;
+  queued_samples = 0;
   for (uint8_t i = 0; i < MAX_ANALYSIS_BUFFER_SIZE; i++) {
     analysis_blocks[i].analysis_done = true;
   }
@@ -129,15 +202,59 @@ bool Input_Init()
 
   fft_handle.fftLenRFFT = FFT_SIZE;
 
+  const uint16_t sliding_indices[SLIDING_NUM_BINS] = {FREQUENCY_INDEX_0, FREQUENCY_INDEX_1};
+  for (uint8_t i = 0; i < SLIDING_NUM_BINS; i++) {
+    float omega = 2.0f * PI * sliding_indices[i] / FFT_SIZE;
+    sliding_bins[i].cos_w = arm_cos_f32(omega);
+    sliding_bins[i].sin_w = arm_sin_f32(omega);
+  }
+  sliding_valid = false;
+
   arm_status ret = arm_rfft_64_fast_init_f32(&fft_handle);
+  if (ret != ARM_MATH_SUCCESS) {
+    return false;
+  }
+
+  ret = arm_rfft_fast_init_f32(&mf_fft_handle, MATCHED_FILTER_SIZE);
+  if (ret != ARM_MATH_SUCCESS) {
+    return false;
+  }
+  generateChirpReference();
 
-  return ret == ARM_MATH_SUCCESS;
+  return true;
 }
 
-//TODO: add check for overflowing buffer
 void Input_IncrementEndIndex()
 {
-  buffer_end_index = (buffer_end_index + ADC_BUFFER_SIZE / 2) % PROCESSING_BUFFER_SIZE;
+  SampleRing_Commit(&input_ring, ADC_BUFFER_SIZE / 2);
+}
+
+bool Input_CheckOverrun()
+{
+  if (SampleRing_Resync(&input_ring) == false) {
+    return false;
+  }
+  // Windows and blocks already taken from before the gap no longer line up
+  // with the data
+  resetDetectorHistory();
+  analysis_length = 0;
+  queued_samples = 0;
+  return true;
+}
+
+uint32_t Input_GetOverruns()
+{
+  return SampleRing_GetOverruns(&input_ring);
+}
+
+uint32_t Input_GetLostSamples()
+{
+  return SampleRing_GetLostSamples(&input_ring);
+}
+
+uint32_t Input_GetHeaderRejects()
+{
+  return header_rejects;
 }
 
 bool Input_DetectMessageStart()
@@ -149,16 +266,33 @@ bool Input_DetectMessageStart()
     case MSG_START_FREQUENCY:
       return messageStartWithFrequency();
       break;
+    case MSG_START_SLIDING_GOERTZEL:
+      return messageStartWithSlidingGoertzel();
+      break;
+    case MSG_START_CHIRP:
+      return messageStartWithChirp();
+      break;
+    case MSG_START_CFAR:
+      return messageStartWithCfar();
+      break;
     default:
       return messageStartWithFrequency();
   }
 }
 
-// Segments blocks and adds them to array of blocks to be processed
+// Segments blocks and adds them to array of blocks to be processed. Their
+// samples stay in the ring until Input_ProcessBlocks is done with them, so an
+// overrun of a block still waiting is counted.
 bool Input_SegmentBlocks()
 {
-  uint32_t analysis_buffer_length = ADC_SAMPLING_RATE / baud_rate;
-  while (getBufferLength() >= analysis_buffer_length) {
+  // A symbol need not last a whole number of samples, so the blocks take the
+  // whole part and carry the fraction into the next one
+  const uint32_t symbol_samples_q16 = (uint32_t) lround(65536.0 * ADC_SAMPLING_RATE / Modulate_GetSymbolRate());
+  while (true) {
+    uint32_t analysis_buffer_length = (symbol_clock_fraction + symbol_samples_q16) >> 16;
+    if (getBufferLength() - queued_samples < analysis_buffer_length) {
+      break;
+    }
 
     analysis_count1++;
 
@@ -166,26 +300,25 @@ bool Input_SegmentBlocks()
     analysis_blocks[analysis_index].data_buf = input_buffer;
     analysis_blocks[analysis_index].buf_len = PROCESSING_BUFFER_SIZE;
     analysis_blocks[analysis_index].data_len = analysis_buffer_length;
-    analysis_blocks[analysis_index].data_start_index = buffer_start_index;
+    analysis_blocks[analysis_index].data_start_index =
+        (SampleRing_GetReadIndex(&input_ring) + queued_samples) & (PROCESSING_BUFFER_SIZE - 1);
     analysis_blocks[analysis_index].bit_index = bit_index++;
     analysis_blocks[analysis_index].decoded_bit = false;
     analysis_blocks[analysis_index].analysis_done = false;
 
     analysis_length++;
+    queued_samples += analysis_buffer_length;
+    symbol_clock_fraction = (symbol_clock_fraction + symbol_samples_q16) & 0xFFFF;
 
     if (analysis_length >= MAX_ANALYSIS_BUFFER_SIZE) {
       return false; // overflow of analysis buffers
     }
-
-    buffer_start_index = (buffer_start_index + analysis_buffer_length) % PROCESSING_BUFFER_SIZE;
   }
   return true;
 }
 
-// looks for an analysis block that have not been analyzed
-// TODO: Address possibility for overflow in eval_info
-// The eval_info arrays need bounds checking against bit_msg->bit_count
-// to prevent buffer overrun when processing long messages
+// looks for an analysis block that have not been analyzed. Only the first
+// EVAL_MESSAGE_LENGTH bits are recorded in eval_info
 bool Input_ProcessBlocks(BitMessage_t* bit_msg, EvalMessageInfo_t* eval_info)
 {
   if (bit_msg == NULL || eval_info == NULL) {
@@ -197,16 +330,27 @@ bool Input_ProcessBlocks(BitMessage_t* bit_msg, EvalMessageInfo_t* eval_info)
 
   while (analysis_length != 0) {
     analysis_count2++;
-    if (Demodulate_Perform(&analysis_blocks[analysis_start_index]) == false) {
+    DemodulationInfo_t* block = &analysis_blocks[analysis_start_index];
+    if (Demodulate_Perform(block) == false) {
       return false;
     }
-    if (Packet_AddBit(bit_msg, analysis_blocks[analysis_start_index].decoded_bit) == false) {
-      return false;
+    SampleRing_Advance(&input_ring, block->data_len);
+    queued_samples -= block->data_len;
+    for (uint8_t i = 0; i < block->num_bits; i++) {
+      // Padding in the last symbol of a full length packet has nowhere to go
+      if (bit_msg->bit_count >= PACKET_MAX_LENGTH_BITS && i > 0) {
+        break;
+      }
+      if (Packet_AddSoftBit(bit_msg, block->bits[i] != 0, block->llr[i]) == false) {
+        return false;
+      }
+      if (bit_msg->bit_count <= EVAL_MESSAGE_LENGTH) {
+        eval_info->energy_f0[bit_msg->bit_count - 1] = block->energy_f0;
+        eval_info->energy_f1[bit_msg->bit_count - 1] = block->energy_f1;
+        eval_info->f0[bit_msg->bit_count - 1] = block->f0;
+        eval_info->f1[bit_msg->bit_count - 1] = block->f1;
+      }
     }
-    eval_info->energy_f0[bit_msg->bit_count - 1] = analysis_blocks[analysis_start_index].energy_f0;
-    eval_info->energy_f1[bit_msg->bit_count - 1] = analysis_blocks[analysis_start_index].energy_f1;
-    eval_info->f0[bit_msg->bit_count - 1] = analysis_blocks[analysis_start_index].f0;
-    eval_info->f1[bit_msg->bit_count - 1] = analysis_blocks[analysis_start_index].f1;
 
     analysis_start_index = (analysis_start_index + 1) % MAX_ANALYSIS_BUFFER_SIZE;
     if (analysis_length == 0) {
@@ -232,6 +376,10 @@ bool Input_DecodeBits(BitMessage_t* bit_msg, bool evaluation_mode)
 
   if (bit_msg->preamble_received == false) { // Still looking for preamble
     if (bit_msg->bit_count >= PACKET_PREAMBLE_LENGTH_BITS) {
+      uint16_t fields;
+      if (correctCodeword(bit_msg, 0, &fields) == false) {
+        return rejectHeader(bit_msg);
+      }
       // Keeps track of where in the preamble we are
       uint16_t bit_index = 0;
       // The first set of bytes in the message correspond to the sender's id
@@ -240,24 +388,22 @@ bool Input_DecodeBits(BitMessage_t* bit_msg, bool evaluation_mode)
         return false;
       }
       // The second set of bytes in the message correspond to the data type
+      uint8_t type_field;
       if (Packet_Get8BitChunk(bit_msg, &bit_index, PACKET_MESSAGE_TYPE_BITS,
-          &bit_msg->contents_data_type) == false) {
+          &type_field) == false) {
         return false;
       }
+      bit_msg->contents_data_type = (MessageData_t) (type_field & ~PACKET_COMPRESSED_FLAG);
+      bit_msg->compressed = (type_field & PACKET_COMPRESSED_FLAG) != 0;
       uint8_t packet_length;
       // The third set of bytes in the message correspond to the data length
       if (Packet_Get8BitChunk(bit_msg, &bit_index, PACKET_LENGTH_BITS,
           &packet_length) == false) {
         return false;
       }
-      bit_msg->data_len_bits = 8 << packet_length;
-      bit_msg->final_length = 8 << packet_length;
-      bit_msg->final_length += PACKET_PREAMBLE_LENGTH_BITS;
-      uint16_t error_bits_length;
-      if (ErrorCorrection_CheckLength(&error_bits_length) == false) {
-        return false;
-      }
-      bit_msg->final_length += error_bits_length;
+      bool byte_exact = (Packet_GetFormat() == PACKET_FORMAT_BYTE_EXACT);
+      bit_msg->data_len_bits = (byte_exact == true) ? 8 * (packet_length + 1) : 8 << packet_length;
+      bit_msg->preamble_length = PACKET_PREAMBLE_LENGTH_BITS;
       // The fourth set of bytes in the message correspond to the stationary flag
       if (Packet_Get8BitChunk(bit_msg, &bit_index, PACKET_STATIONARY_BITS,
           (uint8_t*) &bit_msg->stationary_flag) == false) {
@@ -265,10 +411,30 @@ bool Input_DecodeBits(BitMessage_t* bit_msg, bool evaluation_mode)
       }
 
       // Asserts that the amount of bits read == the amount of bits in the preamble
-      if (bit_index != PACKET_PREAMBLE_LENGTH_BITS) {
+      if (bit_index != PACKET_HEADER_FIELD_BITS) {
         return false;
       }
 
+      // Longer byte-exact payloads have their byte count in a codeword of
+      // its own after the header
+      if (byte_exact == true && packet_length == PACKET_EXTENDED_LENGTH) {
+        if (bit_msg->bit_count < PACKET_MAX_PREAMBLE_LENGTH_BITS) {
+          return true;
+        }
+        uint16_t extension;
+        if (correctCodeword(bit_msg, PACKET_PREAMBLE_LENGTH_BITS, &extension) == false ||
+            extension >= PACKET_DATA_MAX_LENGTH_BYTES) {
+          return rejectHeader(bit_msg);
+        }
+        bit_msg->data_len_bits = 8 * (extension + 1);
+        bit_msg->preamble_length = PACKET_MAX_PREAMBLE_LENGTH_BITS;
+      }
+
+      uint16_t error_bits_length;
+      if (ErrorCorrection_CheckLength(bit_msg->data_len_bits, &error_bits_length) == false) {
+        return false;
+      }
+      bit_msg->final_length = bit_msg->preamble_length + bit_msg->data_len_bits + error_bits_length;
       bit_msg->preamble_received = true;
     }
   }
@@ -284,28 +450,56 @@ bool Input_DecodeMessage(BitMessage_t* input_bit_msg, Message_t* msg)
   // data_len_bytes is restricted to be a multiple of 8
   uint16_t len_bytes = input_bit_msg->data_len_bits / 8;
 
-  uint16_t start_position = PACKET_PREAMBLE_LENGTH_BITS;
+  uint16_t start_position = input_bit_msg->preamble_length;
 
-  for (uint16_t i = 0; i < len_bytes; i++) {
-    if (Packet_Get8(input_bit_msg, &start_position, msg->data + i) == false) {
-      return false;
-    }
+  if (Packet_GetBits(input_bit_msg, &start_position, len_bytes * 8, msg->data) == false) {
+    return false;
   }
+  if (input_bit_msg->compressed == false) {
+    return true;
+  }
+
+  // A stream that won't decompress is passed on as received, as an error
+  uint16_t decompressed_bytes;
+  if (Compress_Decode(msg->data, len_bytes, decompressed, sizeof(decompressed),
+      &decompressed_bytes) == false) {
+    msg->error_correction_error = true;
+    return true;
+  }
+  memcpy(msg->data, decompressed, decompressed_bytes);
+  msg->length_bits = 8 * decompressed_bytes;
   return true;
 }
 
 void Input_Reset()
 {
-  buffer_start_index = 0;
-  buffer_end_index = 0;
+  SampleRing_Reset(&input_ring);
+  queued_samples = 0;
   analysis_start_index = 0;
   analysis_length = 0;
-  fft_analysis_index = 0;
-  fft_analysis_length = 0;
+  resetDetectorHistory();
   bit_index = 0;
+  symbol_clock_fraction = 0;
   memset(input_buffer, 0, PROCESSING_BUFFER_SIZE * sizeof(uint16_t));
 }
 
+void Input_Resume()
+{
+  // Blocks past the end of the message are dropped along with their samples
+  SampleRing_Advance(&input_ring, queued_samples);
+  queued_samples = 0;
+  analysis_start_index = 0;
+  analysis_length = 0;
+  resetDetectorHistory();
+  bit_index = 0;
+  symbol_clock_fraction = 0;
+}
+
+float Input_GetSyncQuality()
+{
+  return sync_quality;
+}
+
 void Input_PrintNoise()
 {
   char print_buffer[PRINT_CHUNK_SIZE * 7 + 1]; // Accommodates max uint16 length + \r\n + 1
@@ -336,6 +530,27 @@ bool Input_RegisterParams()
     return false;
   }
 
+  min = MIN_CFAR_REFERENCE_CELLS;
+  max = MAX_CFAR_REFERENCE_CELLS;
+  if (Param_Register(PARAM_CFAR_REFERENCE_CELLS, "CFAR reference cells", PARAM_TYPE_UINT8,
+                     &cfar_reference_cells, sizeof(uint8_t), &min, &max) == false) {
+    return false;
+  }
+
+  min = MIN_CFAR_PFA_EXPONENT;
+  max = MAX_CFAR_PFA_EXPONENT;
+  if (Param_Register(PARAM_CFAR_PFA_EXPONENT, "CFAR false alarm exponent", PARAM_TYPE_UINT8,
+                     &cfar_pfa_exponent, sizeof(uint8_t), &min, &max) == false) {
+    return false;
+  }
+
+  float min_f = MIN_CHIRP_THRESHOLD;
+  float max_f = MAX_CHIRP_THRESHOLD;
+  if (Param_Register(PARAM_CHIRP_THRESHOLD, "chirp threshold", PARAM_TYPE_FLOAT,
+                     &chirp_threshold, sizeof(float), &min_f, &max_f) == false) {
+    return false;
+  }
+
   return true;
 }
 
@@ -344,48 +559,56 @@ bool Input_RegisterParams()
 
 static uint16_t getBufferLength()
 {
-  uint16_t buffer_length;
+  return (uint16_t) SampleRing_Available(&input_ring);
+}
 
-  if (buffer_end_index >= buffer_start_index) {
-    buffer_length = buffer_end_index - buffer_start_index;
-  }
-  else {
-    buffer_length = PROCESSING_BUFFER_SIZE - (buffer_start_index - buffer_end_index);
-  }
-  return buffer_length;
+static void resetDetectorHistory()
+{
+  fft_analysis_index = 0;
+  fft_analysis_length = 0;
+  sliding_valid = false;
+  cfarResetNoise();
 }
 
 bool messageStartWithThreshold()
 {
-  uint16_t end_index = buffer_end_index;
-  if (buffer_start_index == buffer_end_index) return false; // no new data to process
+  uint16_t length = getBufferLength();
+  if (length == 0) return false; // no new data to process
 
-  static const uint16_t mask = PROCESSING_BUFFER_SIZE - 1;
-
-  while (buffer_start_index != end_index) {
-    if (input_buffer[buffer_start_index] > AMPLITUDE_THRESHOLD) {
+  for (uint16_t i = 0; i < length; i++) {
+    if (input_buffer[SampleRing_GetReadIndex(&input_ring)] > AMPLITUDE_THRESHOLD) {
       return true;
     }
-    buffer_start_index = (buffer_start_index + 1) & mask;
+    SampleRing_Advance(&input_ring, 1);
   }
 
   return false;
 }
 
 bool messageStartWithFrequency()
+{
+  if (computeFftAnalysis() == false) return false;
+
+  return checkStartConditions();
+}
+
+// Runs the overlapping FFTs over all new data and appends the results to the
+// fft_analysis history. Returns false if there was not enough data or the
+// history overflowed.
+static bool computeFftAnalysis()
 {
   static const uint16_t buffer_mask = PROCESSING_BUFFER_SIZE - 1;
   static const uint16_t analysis_mask = FFT_ANALYSIS_BUFF_SIZE - 1;
-  uint16_t end_index = buffer_end_index;
 
-  uint16_t difference = (end_index - buffer_start_index) & buffer_mask;
+  uint16_t difference = getBufferLength();
 
   if (difference < FFT_SIZE) return false;
 
   do {
+    uint16_t start_index = SampleRing_GetReadIndex(&input_ring);
     // Prepare buffer
     for (uint16_t i = 0; i < FFT_SIZE; i++) {
-      fft_input_buffer[i] = (float) input_buffer[(buffer_start_index + i) & buffer_mask];
+      fft_input_buffer[i] = (float) input_buffer[(start_index + i) & buffer_mask];
     }
 
     arm_rfft_fast_f32(&fft_handle, fft_input_buffer, fft_output_buffer, 0);
@@ -400,7 +623,7 @@ bool messageStartWithFrequency()
       fft_mag_sq_buffer[i] = real * real + imag * imag;
     }
 
-    fft_analysis[fft_analysis_index].start_index = buffer_start_index;
+    fft_analysis[fft_analysis_index].start_index = start_index;
     fft_analysis[fft_analysis_index].length = FFT_SIZE;
     // skip the dc component to avoid overwhelming
     arm_mean_f32(&fft_mag_sq_buffer[1], FFT_SIZE / 2 - 1, &fft_analysis[fft_analysis_index].average);
@@ -414,18 +637,377 @@ bool messageStartWithFrequency()
     fft_analysis_index = (fft_analysis_index + 1) & analysis_mask;
     fft_analysis_length += 1;
 
-    buffer_start_index = (buffer_start_index + FFT_SIZE / FFT_OVERLAP) & buffer_mask;
+    SampleRing_Advance(&input_ring, FFT_SIZE / FFT_OVERLAP);
+    if (fft_analysis_length >= FFT_ANALYSIS_BUFF_SIZE) {
+      // TODO: log error
+      return false;
+    }
+
+    difference = getBufferLength();
+
+  } while (difference > FFT_SIZE);
+
+  return true;
+}
+
+// Computes the same analysis as messageStartWithFrequency() but only for the
+// bins the start conditions look at. The bins are slid one sample at a time
+// with X(n + 1) = (X(n) - x[n] + x[n + N]) * e^(j2pik/N) and the average comes
+// from the window energy by Parseval's theorem instead of the full spectrum.
+bool messageStartWithSlidingGoertzel()
+{
+  static const uint16_t analysis_mask = FFT_ANALYSIS_BUFF_SIZE - 1;
+
+  uint16_t difference = getBufferLength();
+
+  if (difference < FFT_SIZE) return false;
+
+  do {
+    uint16_t start_index = SampleRing_GetReadIndex(&input_ring);
+    slidingGoertzelAdvance(start_index);
+
+    FFTInfo_t* info = &fft_analysis[fft_analysis_index];
+    info->start_index = start_index;
+    info->length = FFT_SIZE;
+    info->frequency0_amplitude = sliding_bins[0].real * sliding_bins[0].real +
+                                 sliding_bins[0].imag * sliding_bins[0].imag;
+    info->frequency1_amplitude = sliding_bins[1].real * sliding_bins[1].real +
+                                 sliding_bins[1].imag * sliding_bins[1].imag;
+
+    // Energy of all non-DC bins is N * sum(x^2) - sum(x)^2, half of which lies
+    // in the bins 1 to N/2 - 1 averaged by the FFT method
+    uint64_t ac_energy = (uint64_t) FFT_SIZE * sliding_sum_sq -
+                         (uint64_t) sliding_sum * sliding_sum;
+    info->average = (float) ac_energy / (2.0f * (FFT_SIZE / 2 - 1));
+
+    // Only the tracked bins are known so the maximum is taken over them
+    if (info->frequency0_amplitude > info->frequency1_amplitude) {
+      info->maximum = info->frequency0_amplitude;
+      info->max_index = FREQUENCY_INDEX_0 - 1;
+    }
+    else {
+      info->maximum = info->frequency1_amplitude;
+      info->max_index = FREQUENCY_INDEX_1 - 1;
+    }
+
+    fft_analysis_index = (fft_analysis_index + 1) & analysis_mask;
+    fft_analysis_length += 1;
+
+    SampleRing_Advance(&input_ring, FFT_SIZE / FFT_OVERLAP);
     if (fft_analysis_length >= FFT_ANALYSIS_BUFF_SIZE) {
       // TODO: log error
       return false;
     }
 
-    difference = (end_index - buffer_start_index) & buffer_mask;
+    difference = getBufferLength();
 
   } while (difference > FFT_SIZE);
 
-  // go through the fft_analysis array to see if the condition is met
+  return checkStartConditions();
+}
+
+// Computes the tracked bins and window sums directly for the window starting
+// at start_index using the Goertzel algorithm
+static void slidingGoertzelReset(const uint16_t start_index)
+{
+  static const uint16_t buffer_mask = PROCESSING_BUFFER_SIZE - 1;
+
+  sliding_sum = 0;
+  sliding_sum_sq = 0;
+  for (uint16_t i = 0; i < FFT_SIZE; i++) {
+    uint32_t sample = input_buffer[(start_index + i) & buffer_mask];
+    sliding_sum += sample;
+    sliding_sum_sq += sample * sample;
+  }
+
+  for (uint8_t bin = 0; bin < SLIDING_NUM_BINS; bin++) {
+    float coeff = 2.0f * sliding_bins[bin].cos_w;
+    float q1 = 0.0f;
+    float q2 = 0.0f;
+    for (uint16_t i = 0; i < FFT_SIZE; i++) {
+      float q0 = coeff * q1 - q2 + (float) input_buffer[(start_index + i) & buffer_mask];
+      q2 = q1;
+      q1 = q0;
+    }
+    // X(k) = e^(jw) * q1 - q2 for w = 2pik/N
+    sliding_bins[bin].real = sliding_bins[bin].cos_w * q1 - q2;
+    sliding_bins[bin].imag = sliding_bins[bin].sin_w * q1;
+  }
+
+  sliding_start_index = start_index;
+  sliding_slide_count = 0;
+  sliding_valid = true;
+}
+
+// Slides the window forward until it starts at start_index
+static void slidingGoertzelAdvance(const uint16_t start_index)
+{
+  static const uint16_t buffer_mask = PROCESSING_BUFFER_SIZE - 1;
+  uint16_t distance = (start_index - sliding_start_index) & buffer_mask;
+
+  // Recomputing is cheaper than sliding further than a window
+  if (sliding_valid == false || distance > FFT_SIZE ||
+      sliding_slide_count >= SLIDING_RESYNC_SAMPLES) {
+    slidingGoertzelReset(start_index);
+    return;
+  }
+
+  for (uint16_t i = 0; i < distance; i++) {
+    uint32_t leaving = input_buffer[sliding_start_index];
+    uint32_t entering = input_buffer[(sliding_start_index + FFT_SIZE) & buffer_mask];
+
+    sliding_sum += entering - leaving;
+    sliding_sum_sq += entering * entering - leaving * leaving;
+
+    float delta = (float) entering - (float) leaving;
+    for (uint8_t bin = 0; bin < SLIDING_NUM_BINS; bin++) {
+      float real = sliding_bins[bin].real + delta;
+      float imag = sliding_bins[bin].imag;
+      sliding_bins[bin].real = sliding_bins[bin].cos_w * real - sliding_bins[bin].sin_w * imag;
+      sliding_bins[bin].imag = sliding_bins[bin].sin_w * real + sliding_bins[bin].cos_w * imag;
+    }
+
+    sliding_start_index = (sliding_start_index + 1) & buffer_mask;
+  }
+  sliding_slide_count += distance;
+}
+
+// Cell-averaging CFAR over the fft_analysis history. The noise in each
+// tracked bin is the average of the reference cells that precede the cell
+// under test, skipping the guard cells that overlap it. A cell is over the
+// threshold when it exceeds alpha times this average, with alpha chosen for a
+// false alarm probability of 10^-cfar_pfa_exponent per cell and bin.
+static bool messageStartWithCfar()
+{
+  if (cfar_window_size != cfar_reference_cells) {
+    cfarResetNoise();
+  }
+
+  uint16_t first_new = fft_analysis_length;
+  if (computeFftAnalysis() == false) {
+    // A full history would fail the same way on every call, so the noise
+    // estimate starts over from the input after it
+    if (fft_analysis_length >= FFT_ANALYSIS_BUFF_SIZE) {
+      fft_analysis_length = 0;
+      cfarResetNoise();
+    }
+    return false;
+  }
+
+  // Overlapping cells are correlated so fewer independent cells are averaged
+  const float effective_cells = (float) cfar_window_size / FFT_OVERLAP;
+  const float alpha = effective_cells *
+                      (powf(10.0f, cfar_pfa_exponent / effective_cells) - 1.0f);
+
+  for (uint16_t position = first_new; position < fft_analysis_length; position++) {
+    // Slide the reference window up to the guard cells of this cell
+    if (position >= CFAR_GUARD_CELLS + 1) {
+      uint16_t entering = position - CFAR_GUARD_CELLS - 1;
+      for (uint8_t bin = 0; bin < CFAR_NUM_BINS; bin++) {
+        cfar_noise_sum[bin] += cfarCell(entering, bin);
+      }
+      if (cfar_window_cells < cfar_window_size) {
+        cfar_window_cells++;
+      }
+      else {
+        for (uint8_t bin = 0; bin < CFAR_NUM_BINS; bin++) {
+          cfar_noise_sum[bin] -= cfarCell(entering - cfar_window_size, bin);
+        }
+      }
+
+      if (++cfar_update_count >= CFAR_RESYNC_CELLS && cfar_window_cells == cfar_window_size) {
+        for (uint8_t bin = 0; bin < CFAR_NUM_BINS; bin++) {
+          cfar_noise_sum[bin] = 0.0f;
+          for (uint8_t i = 0; i < cfar_window_size; i++) {
+            cfar_noise_sum[bin] += cfarCell(entering - i, bin);
+          }
+        }
+        cfar_update_count = 0;
+      }
+    }
+
+    if (cfar_window_cells < cfar_window_size) {
+      continue;
+    }
+
+    bool over_threshold = false;
+    for (uint8_t bin = 0; bin < CFAR_NUM_BINS; bin++) {
+      float noise = cfar_noise_sum[bin] / cfar_window_size;
+      if (cfarCell(position, bin) > alpha * noise) {
+        over_threshold = true;
+      }
+    }
+
+    if (over_threshold == false) {
+      cfar_hit_count = 0;
+      continue;
+    }
+    if (++cfar_hit_count >= CFAR_CONFIRM_CELLS) {
+      static const uint16_t analysis_mask = FFT_ANALYSIS_BUFF_SIZE - 1;
+      uint16_t first_hit = position - CFAR_CONFIRM_CELLS + 1;
+      uint16_t index = (fft_analysis_index - fft_analysis_length + first_hit) & analysis_mask;
+      SampleRing_SeekIndex(&input_ring, findStartPosition(index, CFAR_CONFIRM_CELLS));
+      return true;
+    }
+  }
+
+  // Only the cells still needed by the reference window are kept
+  uint16_t history = CFAR_GUARD_CELLS + 1 + cfar_window_size + CFAR_CONFIRM_CELLS;
+  if (fft_analysis_length > history) {
+    fft_analysis_length = history;
+  }
+  return false;
+}
+
+static void cfarResetNoise()
+{
+  for (uint8_t bin = 0; bin < CFAR_NUM_BINS; bin++) {
+    cfar_noise_sum[bin] = 0.0f;
+  }
+  cfar_window_cells = 0;
+  cfar_window_size = cfar_reference_cells;
+  cfar_hit_count = 0;
+  cfar_update_count = 0;
+}
 
+// Returns the power of a tracked bin for a cell position in the fft_analysis history
+static float cfarCell(const uint16_t position, const uint8_t bin)
+{
+  static const uint16_t analysis_mask = FFT_ANALYSIS_BUFF_SIZE - 1;
+  uint16_t index = (fft_analysis_index - fft_analysis_length + position) & analysis_mask;
+  return (bin == 0) ? fft_analysis[index].frequency0_amplitude :
+                      fft_analysis[index].frequency1_amplitude;
+}
+
+// Correlates the input against the chirp preamble with overlap-save FFT
+// blocks. Each block covers MATCHED_FILTER_HOP lags and overlaps the next by
+// the chirp length so every lag is computed once without circular wrap. On
+// detection the start index is placed on the first sample after the chirp.
+static bool messageStartWithChirp()
+{
+  if (chirp_reference_start != chirp_start_freq || chirp_reference_end != chirp_end_freq) {
+    generateChirpReference();
+  }
+
+  uint16_t difference = getBufferLength();
+
+  while (difference >= MATCHED_FILTER_SIZE) {
+    float quality;
+    uint16_t peak_lag = correlateChirp(SampleRing_GetReadIndex(&input_ring), &quality);
+
+    if (quality < chirp_threshold) {
+      SampleRing_Advance(&input_ring, MATCHED_FILTER_HOP);
+    }
+    else if (peak_lag >= MATCHED_FILTER_HOP - MATCHED_FILTER_GUARD) {
+      // The true peak may be in the next block so move the block onto this one
+      SampleRing_Advance(&input_ring, peak_lag - MATCHED_FILTER_GUARD);
+    }
+    else {
+      sync_quality = quality;
+      SampleRing_Advance(&input_ring, peak_lag + CHIRP_LENGTH);
+      return true;
+    }
+
+    difference = getBufferLength();
+  }
+
+  return false;
+}
+
+// Builds the conjugated spectrum of the chirp as it is sampled by the ADC
+static void generateChirpReference()
+{
+  memset(mf_time_buffer, 0, MATCHED_FILTER_SIZE * sizeof(float));
+
+  // The DAC keeps its phase continuous across steps so the reference does too
+  float phase = 0.0f;
+  uint16_t sample_index = 0;
+  chirp_reference_energy = 0.0f;
+  for (uint16_t step = 0; step < CHIRP_PREAMBLE_STEPS; step++) {
+    float omega = 2.0f * PI * Modulate_GetChirpFrequency(step) / ADC_SAMPLING_RATE;
+    for (uint16_t i = 0; i < CHIRP_STEP_SAMPLES; i++) {
+      float value = arm_cos_f32(phase);
+      mf_time_buffer[sample_index++] = value;
+      chirp_reference_energy += value * value;
+      phase += omega;
+      if (phase > 2.0f * PI) {
+        phase -= 2.0f * PI;
+      }
+    }
+  }
+
+  arm_rfft_fast_f32(&mf_fft_handle, mf_time_buffer, chirp_reference, 0);
+
+  // Dropping DC and Nyquist removes the ADC offset from the correlation
+  chirp_reference[0] = 0.0f;
+  chirp_reference[1] = 0.0f;
+  arm_cmplx_conj_f32(&chirp_reference[2], &chirp_reference[2], MATCHED_FILTER_SIZE / 2 - 1);
+
+  chirp_reference_start = chirp_start_freq;
+  chirp_reference_end = chirp_end_freq;
+}
+
+// Correlates one block starting at start_index and returns the lag of the
+// largest correlation envelope. The quality is the normalized correlation at
+// that lag, 1 for a noiseless chirp and around 1/sqrt(CHIRP_LENGTH) for noise.
+static uint16_t correlateChirp(const uint16_t start_index, float* quality)
+{
+  static const uint16_t buffer_mask = PROCESSING_BUFFER_SIZE - 1;
+
+  for (uint16_t i = 0; i < MATCHED_FILTER_SIZE; i++) {
+    mf_time_buffer[i] = (float) input_buffer[(start_index + i) & buffer_mask];
+  }
+  arm_rfft_fast_f32(&mf_fft_handle, mf_time_buffer, mf_freq_buffer, 0);
+
+  mf_freq_buffer[0] = 0.0f;
+  mf_freq_buffer[1] = 0.0f;
+  arm_cmplx_mult_cmplx_f32(&mf_freq_buffer[2], &chirp_reference[2], &mf_freq_buffer[2],
+                           MATCHED_FILTER_SIZE / 2 - 1);
+
+  // In phase part of the correlation
+  memcpy(mf_time_buffer, mf_freq_buffer, MATCHED_FILTER_SIZE * sizeof(float));
+  arm_rfft_fast_f32(&mf_fft_handle, mf_time_buffer, mf_output_buffer, 1);
+
+  // Quadrature part from the Hilbert transform, -j on the positive frequencies
+  for (uint16_t k = 1; k < MATCHED_FILTER_SIZE / 2; k++) {
+    float real = mf_freq_buffer[2 * k];
+    mf_freq_buffer[2 * k] = mf_freq_buffer[2 * k + 1];
+    mf_freq_buffer[2 * k + 1] = -real;
+  }
+  arm_rfft_fast_f32(&mf_fft_handle, mf_freq_buffer, mf_time_buffer, 1);
+
+  // Squared envelope over the lags that did not wrap
+  for (uint16_t i = 0; i < MATCHED_FILTER_HOP; i++) {
+    mf_output_buffer[i] = mf_output_buffer[i] * mf_output_buffer[i] +
+                          mf_time_buffer[i] * mf_time_buffer[i];
+  }
+  float peak;
+  uint32_t peak_lag;
+  arm_max_f32(mf_output_buffer, MATCHED_FILTER_HOP, &peak, &peak_lag);
+
+  // Energy of the input under the chirp at the peak without its offset
+  uint32_t sum = 0;
+  uint64_t sum_sq = 0;
+  for (uint16_t i = 0; i < CHIRP_LENGTH; i++) {
+    uint32_t sample = input_buffer[(start_index + peak_lag + i) & buffer_mask];
+    sum += sample;
+    sum_sq += sample * sample;
+  }
+  float input_energy = (float) (CHIRP_LENGTH * sum_sq - (uint64_t) sum * sum) / CHIRP_LENGTH;
+
+  if (input_energy <= 0.0f) {
+    *quality = 0.0f;
+  }
+  else {
+    float ratio = peak / (chirp_reference_energy * input_energy);
+    arm_sqrt_f32(ratio, quality);
+  }
+  return (uint16_t) peak_lag;
+}
+
+// Goes through the fft_analysis array to see if the start condition is met
+static bool checkStartConditions()
+{
   // TODO later add individual start indices for each
 
   if (fft_analysis_length < 1) return false;
@@ -479,7 +1061,7 @@ bool checkFftConditions(const uint16_t check_length, const float multiplier)
         (fft_analysis[index].frequency1_amplitude > multiplier)) {
       check_count++;
       if (check_count >= check_length) {
-        buffer_start_index = findStartPosition((index - check_length + 1) & analysis_mask, check_length);;
+        SampleRing_SeekIndex(&input_ring, findStartPosition((index - check_length + 1) & analysis_mask, check_length));
         return true;
       }
     } else {
@@ -518,3 +1100,34 @@ static uint16_t findStartPosition(const uint16_t analysis_index, const uint16_t
     return (fft_analysis[analysis_index].start_index + FFT_SIZE / 2) & buffer_mask;
   }
 }
+
+// Puts the corrected Golay codeword at position back in the message, false
+// if it has more bits in error than the code corrects
+static bool correctCodeword(BitMessage_t* bit_msg, uint16_t position, uint16_t* data)
+{
+  uint16_t start = position;
+  uint8_t received[3];
+  if (Packet_GetBits(bit_msg, &position, GOLAY_CODEWORD_BITS, received) == false) {
+    return false;
+  }
+
+  uint32_t codeword = ((uint32_t) received[0] << 16) | ((uint32_t) received[1] << 8) | received[2];
+  uint8_t num_corrected;
+  if (Golay_Decode(codeword, data, &num_corrected) == false) {
+    return false;
+  }
+  if (num_corrected > 0) {
+    codeword = Golay_Encode(*data);
+    uint8_t corrected[3] = {codeword >> 16, codeword >> 8, codeword};
+    BitStream_Write(bit_msg->data, start, corrected, GOLAY_CODEWORD_BITS);
+  }
+  return true;
+}
+
+// Ends the search for a header the receiver can't trust
+static bool rejectHeader(BitMessage_t* bit_msg)
+{
+  bit_msg->header_rejected = true;
+  header_rejects++;
+  return true;
+}
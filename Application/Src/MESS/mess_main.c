@@ -19,6 +19,7 @@
 #include "mess_input.h"
 #include "mess_feedback.h"
 #include "mess_evaluate.h"
+#include "mess_calibration.h"
 
 #include "sys_error.h"
 
@@ -32,6 +33,7 @@
 #include "main.h"
 #include <stdbool.h>
 #include <string.h>
+#include <math.h>
 
 /* Private typedef -----------------------------------------------------------*/
 
@@ -44,6 +46,7 @@ typedef enum {
 
 /* Private define ------------------------------------------------------------*/
 
+#define EVENT_TIMEOUT_MS        100   // Longest the task sleeps should an event be missed
 
 
 /* Private macro -------------------------------------------------------------*/
@@ -63,6 +66,10 @@ uint32_t fc = DEFAULT_FC;
 uint8_t fhbfsk_num_tones = DEFAULT_FHBFSK_NUM_TONES;
 uint8_t fhbfsk_freq_spacing = DEFAULT_FHBFSK_FREQ_SPACING;
 uint8_t fhbfsk_dwell_time = DEFAULT_FHBFSK_DWELL_TIME;
+uint8_t mfsk_bits_per_symbol = DEFAULT_MFSK_BITS;
+bool chirp_preamble = DEFAULT_CHIRP_PREAMBLE;
+uint32_t chirp_start_freq = DEFAULT_CHIRP_START_FREQ;
+uint32_t chirp_end_freq = DEFAULT_CHIRP_END_FREQ;
 
 static bool evaluation_mode = DEFAULT_EVAL_MODE_STATE;
 static uint8_t evaluation_message = DEFAULT_EVAL_MESSAGE;
@@ -70,8 +77,14 @@ static uint8_t evaluation_message = DEFAULT_EVAL_MESSAGE;
 static ProcessingState_t MESS_TaskState = LISTENING;
 
 static BitMessage_t input_bit_msg;
+static int8_t input_llr[PACKET_MAX_LENGTH_BITS]; // Reliabilities of the bits of input_bit_msg
 
-bool in_feedback = false;
+static bool calibrating = false;
+
+static osThreadId_t mess_thread = NULL;
+
+static bool burst_mode = DEFAULT_BURST_MODE;
+static uint32_t burst_gap_ms = DEFAULT_BURST_GAP_MS;
 
 
 /* Private function prototypes -----------------------------------------------*/
@@ -80,18 +93,21 @@ static void switchState(ProcessingState_t newState);
 static void switchTrTransmit();
 static void switchTrReceive();
 static MessageFlags_t checkFlags();
+static void waitForEvents();
 static bool registerMessParams();
 static bool registerMessMainParams();
+static bool startCalibrationPoint();
+static void finishCalibrationPoint();
+static void collectBurst(MessageType_t type, BitMessage_t* bit_msg);
 
 /* Exported function definitions ---------------------------------------------*/
 
 void MESS_StartTask(void* argument)
 {
   (void)(argument);
+  mess_thread = osThreadGetId();
   osEventFlagsClear(print_event_handle, 0xFFFFFFFF);
   Message_t tx_msg;
-  WaveformStep_t message_sequence[PACKET_MAX_LENGTH_BITS];
-  uint16_t message_length = 0;
   EvalMessageInfo_t eval_info;
 
   if (Param_RegisterTask(MESS_TASK, "MESS") == false) {
@@ -117,21 +133,26 @@ void MESS_StartTask(void* argument)
   Feedback_Init();
   Evaluate_Init();
   DAC_InitWaveformGenerator();
+  // Also starts the input ADC. Restarting it here would reset the ADC copy
+  // index without resetting the input buffer indices and desynchronize them
   switchState(LISTENING);
-  // MESS_TaskState = LISTENING;
 
   osDelay(10);
-  ADC_StartInput();
   for (;;) {
+    waitForEvents();
     switch (MESS_TaskState) {
       case DRIVING_TRANSDUCER:
         // Currently driving transducer so listen to transducer feedback network
         if (DAC_IsRunning() == false) {
           osDelay(1); // Lets the ADC finish in the case of feedback network
           HAL_TIM_Base_Stop(&htim6);
-          if (in_feedback == true) {
-            Feedback_DumpData();
-            in_feedback = false;
+          if (calibrating == true) {
+            finishCalibrationPoint();
+            if (startCalibrationPoint() == true) {
+              break;
+            }
+            calibrating = false;
+            Calibration_FinishSweep(); // A failed sweep keeps the previous table
           }
           switchState(LISTENING);
         }
@@ -153,9 +174,9 @@ void MESS_StartTask(void* argument)
             break;
           case MESS_FREQ_RESP:
             osEventFlagsClear(print_event_handle, MESS_FREQ_RESP);
-            Modulate_TestFrequencyResponse();
-            in_feedback = true;
-            switchState(DRIVING_TRANSDUCER);
+            if (Calibration_StartSweep() == true) {
+              startCalibrationPoint();
+            }
             break;
           default:
             break;
@@ -167,23 +188,19 @@ void MESS_StartTask(void* argument)
             // TODO: log error
             break;
           }
-          message_length = bit_msg.bit_count;
-          // convert to frequencies in message_sequence
-          if (Modulate_ConvertToFrequency(&bit_msg, message_sequence) == false) {
+          Modulate_ClearBurst();
+          if (Modulate_AddToBurst(&bit_msg) == false) {
             // TODO: log error
             break;
           }
-
-          if (Modulate_ApplyAmplitude(message_sequence, message_length) == false) {
-            // TODO: log error
-            break;
+          if (burst_mode == true) {
+            collectBurst(tx_msg.type, &bit_msg);
           }
-
-          if (Modulate_ApplyDuration(message_sequence, message_length) == false) {
+          // The waveform is generated as the DAC outputs it
+          if (Modulate_SetBurstSource(burst_gap_ms) == false) {
             // TODO: log error
             break;
           }
-          DAC_SetWaveformSequence(message_sequence, message_length);
           switch (tx_msg.type) {
             case MSG_TRANSMIT_TRANSDUCER:
               switchState(DRIVING_TRANSDUCER);
@@ -197,6 +214,9 @@ void MESS_StartTask(void* argument)
           }
         }
 
+        if (Input_CheckOverrun() == true) {
+          Error_Routine(ERROR_MESS_OVERRUN);
+        }
         if (Input_DetectMessageStart() == true) {
           switchState(PROCESSING);
           break;
@@ -208,6 +228,12 @@ void MESS_StartTask(void* argument)
             (input_bit_msg.bit_count >= input_bit_msg.final_length) &&
             (input_bit_msg.preamble_received == true);
 
+        if (Input_CheckOverrun() == true) {
+          // Part of the message was overwritten before it was demodulated
+          Error_Routine(ERROR_MESS_OVERRUN);
+          switchState(LISTENING);
+          break;
+        }
         if (Input_SegmentBlocks() == false) {
           Error_Routine(ERROR_MESS_PROCESSING);
           break;
@@ -220,6 +246,11 @@ void MESS_StartTask(void* argument)
           Error_Routine(ERROR_MESS_PROCESSING);
           break;
         }
+        if (input_bit_msg.header_rejected == true) {
+          // Nothing after the header can be placed without its length
+          switchState(LISTENING);
+          break;
+        }
         if (evaluation_mode == true) {
           if (input_bit_msg.bit_count >= EVAL_MESSAGE_LENGTH) {
             Message_t rx_msg;
@@ -244,17 +275,28 @@ void MESS_StartTask(void* argument)
             rx_msg.data_type = input_bit_msg.contents_data_type;
             rx_msg.eval_info = &eval_info;
             rx_msg.sender_id = input_bit_msg.sender_id;
+            rx_msg.error_correction_error = false;
+            if (Packet_Deinterleave(&input_bit_msg) == false) {
+              Error_Routine(ERROR_MESS_PROCESSING);
+              break;
+            }
+            if (ErrorCorrection_CorrectErrors(&input_bit_msg) == false) {
+              Error_Routine(ERROR_MESS_PROCESSING);
+              break;
+            }
             // decode message
             if (Input_DecodeMessage(&input_bit_msg, &rx_msg) == false) {
               Error_Routine(ERROR_MESS_PROCESSING);
               break;
             }
 
-            if (ErrorCorrection_CheckCorrection(&input_bit_msg,
-                &rx_msg.error_correction_error) == false) {
+            bool correction_error;
+            if (ErrorCorrection_CheckCorrection(&input_bit_msg, &correction_error) == false) {
               Error_Routine(ERROR_MESS_PROCESSING);
               break;
             }
+            // Keeps a payload that failed to decompress marked as an error
+            rx_msg.error_correction_error |= correction_error;
             // send it via queue
             MESS_AddMessageToRxQ(&rx_msg);
             switchState(LISTENING);
@@ -264,7 +306,6 @@ void MESS_StartTask(void* argument)
       default:
         break;
     }
-    osDelay(1);
   }
 }
 
@@ -297,8 +338,13 @@ BaseType_t MESS_AddMessageToTxQ(Message_t* msg)
     return pdFAIL;
   }
 
-  return xQueueSend(tx_queue, msg, 5);
+  BaseType_t ret = xQueueSend(tx_queue, msg, 5);
+  if (ret == pdPASS) {
+    MESS_NotifyTask(MESS_TX_QUEUED);
+  }
+  return ret;
 }
+
 BaseType_t MESS_GetMessageFromRxQ(Message_t* msg)
 {
   if (rx_queue == NULL || msg == NULL) {
@@ -321,15 +367,24 @@ BaseType_t MESS_AddMessageToRxQ(Message_t* msg)
   return xQueueSend(rx_queue, msg, 5);
 }
 
-void MESS_RoundBaud(float* baud)
+void MESS_NotifyTask(uint32_t events)
 {
-  float length_multiple = DAC_BUFFER_SIZE / 2; // Length of sequence must be a multiple of half the DAC buffer size
-  float length_multiple_us = length_multiple * DAC_SAMPLE_RATE / 1000000.0f; // Converts symbol length multiple into micro seconds
+  if (mess_thread == NULL) {
+    return;
+  }
+  osThreadFlagsSet(mess_thread, events);
+}
 
-  float baud_duration_us = (1000000.0f / *baud);
+void DAC_WaveformCompleteCallback(void)
+{
+  MESS_NotifyTask(MESS_DAC_COMPLETE);
+}
 
-  float baud_multiple_durations = roundf(baud_duration_us / length_multiple_us);
-  *baud = 1000000.0f / (baud_multiple_durations * length_multiple_us);
+void MESS_RoundBaud(float* baud)
+{
+  // Symbols no longer need to fill whole DAC half buffers, a whole number of
+  // hertz keeps the M-FSK and FHBFSK tone spacings exact
+  *baud = roundf(*baud);
 }
 
 /* Private function definitions ----------------------------------------------*/
@@ -337,6 +392,7 @@ void MESS_RoundBaud(float* baud)
 static void switchState(ProcessingState_t newState)
 {
   // First deactivate and clear all adcs, dacs, and all buffers except for the input buffer when transitioning from listening to processing
+  ProcessingState_t old_state = MESS_TaskState;
   MESS_TaskState = CHANGING;
   switch (newState) {
     case DRIVING_TRANSDUCER:
@@ -355,6 +411,13 @@ static void switchState(ProcessingState_t newState)
       MESS_TaskState = DRIVING_TRANSDUCER;
       break;
     case LISTENING:
+      if (burst_mode == true && old_state == PROCESSING) {
+        // Never stopped receiving, the next message of a burst may already
+        // be arriving so nothing is thrown away
+        Input_Resume();
+        MESS_TaskState = LISTENING;
+        break;
+      }
       DAC_StopWaveformOutput();
       HAL_TIM_Base_Stop(&htim6);
       HAL_DAC_Stop(&hdac1, DAC_CHANNEL_1);
@@ -368,12 +431,13 @@ static void switchState(ProcessingState_t newState)
       MESS_TaskState = LISTENING;
       break;
     case PROCESSING:
-      Packet_PrepareRx(&input_bit_msg);
+      Packet_PrepareRx(&input_bit_msg, input_llr);
       MESS_TaskState = PROCESSING;
       break;
     default:
       break;
   }
+  MESS_NotifyTask(MESS_STATE_CHANGED);
 }
 
 static void switchTrTransmit()
@@ -386,6 +450,21 @@ static void switchTrReceive()
   HAL_GPIO_WritePin(GPIOD, TR_CTRL_Pin, GPIO_PIN_SET);
 }
 
+// Blocks until there is something for the current state to do. Requests
+// from other tasks are only serviced while listening so they are left out
+// otherwise, where they stay pending until the task listens again. The flags
+// are cleared as the wait returns, before the work is done, so events during
+// it wake the task again. Each state checks for its work itself, so the
+// timeout only bounds how long a missed event can stall it.
+static void waitForEvents()
+{
+  uint32_t events = MESS_TASK_EVENTS;
+  if (MESS_TaskState == LISTENING) {
+    events |= MESS_REQUEST_EVENTS;
+  }
+  osThreadFlagsWait(events, osFlagsWaitAny, EVENT_TIMEOUT_MS);
+}
+
 static MessageFlags_t checkFlags()
 {
   uint32_t flags;
@@ -458,9 +537,60 @@ static bool registerMessParams()
     return false;
   } 
 
+  if (Calibration_RegisterParams() == false) {
+    return false;
+  }
+
+  return true;
+}
+
+// Drives the test tone of the next point of the calibration sweep
+static bool startCalibrationPoint()
+{
+  uint32_t freq_hz;
+  if (Calibration_GetSweepFrequency(&freq_hz) == false) {
+    return false;
+  }
+  Modulate_SetTestFrequency(freq_hz);
+  Modulate_TestFrequencyResponse();
+  calibrating = true;
+  switchState(DRIVING_TRANSDUCER);
   return true;
 }
 
+// A point that could not be measured is recorded without signal, which fails
+// the sweep
+static void finishCalibrationPoint()
+{
+  uint32_t freq_hz;
+  float amplitude = 0.0f;
+  if (Calibration_GetSweepFrequency(&freq_hz) == true) {
+    if (Feedback_MeasureTone(freq_hz, &amplitude) == false) {
+      amplitude = 0.0f;
+    }
+    Calibration_RecordPoint(amplitude);
+  }
+}
+
+// Moves the queued messages that go out the same way as the first into the
+// burst, stopping at one that does not so the order is kept
+static void collectBurst(MessageType_t type, BitMessage_t* bit_msg)
+{
+  Message_t msg;
+  while (xQueuePeek(tx_queue, &msg, 0) == pdPASS && msg.type == type) {
+    if (MESS_GetMessageFromTxQ(&msg) != pdPASS) {
+      return;
+    }
+    if (Packet_PrepareTx(&msg, bit_msg) == false) {
+      // TODO: log error
+      continue;
+    }
+    if (Modulate_AddToBurst(bit_msg) == false) {
+      return;
+    }
+  }
+}
+
 static bool registerMessMainParams()
 {
   float min_f = MIN_BAUD_RATE;
@@ -516,6 +646,45 @@ static bool registerMessMainParams()
     return false;
   }
 
+  min_u32 = MIN_MFSK_BITS;
+  max_u32 = MAX_MFSK_BITS;
+  if (Param_Register(PARAM_MFSK_BITS, "M-FSK bits per symbol", PARAM_TYPE_UINT8,
+                     &mfsk_bits_per_symbol, sizeof(uint8_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
+  min_u32 = (uint32_t) MIN_CHIRP_PREAMBLE;
+  max_u32 = (uint32_t) MAX_CHIRP_PREAMBLE;
+  if (Param_Register(PARAM_CHIRP_PREAMBLE, "chirp preamble", PARAM_TYPE_UINT8,
+                     &chirp_preamble, sizeof(uint8_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
+  min_u32 = MIN_FSK_FREQUENCY;
+  max_u32 = MAX_FSK_FREQUENCY;
+  if (Param_Register(PARAM_CHIRP_START_FREQ, "chirp start frequency", PARAM_TYPE_UINT32,
+                     &chirp_start_freq, sizeof(uint32_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+  if (Param_Register(PARAM_CHIRP_END_FREQ, "chirp end frequency", PARAM_TYPE_UINT32,
+                     &chirp_end_freq, sizeof(uint32_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
+  min_u32 = (uint32_t) MIN_BURST_MODE;
+  max_u32 = (uint32_t) MAX_BURST_MODE;
+  if (Param_Register(PARAM_BURST_MODE, "burst mode", PARAM_TYPE_UINT8,
+                     &burst_mode, sizeof(uint8_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
+  min_u32 = MIN_BURST_GAP_MS;
+  max_u32 = MAX_BURST_GAP_MS;
+  if (Param_Register(PARAM_BURST_GAP, "burst gap", PARAM_TYPE_UINT32,
+                     &burst_gap_ms, sizeof(uint32_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
   min_u32 = (uint32_t) MIN_EVAL_MODE_STATE;
   max_u32 = (uint32_t) MAX_EVAL_MODE_STATE;
   if (Param_Register(PARAM_EVAL_MODE_ON, "evaluation mode", PARAM_TYPE_UINT8,
@@ -11,18 +11,27 @@
 #include "mess_adc.h"
 #include "cmsis_os.h"
 #include "mess_packet.h"
+#include "mess_modulate.h"
 #include "mess_feedback.h"
+#include "mess_ofdm.h"
+#include "mess_calibration.h"
 #include "cfg_parameters.h"
 #include "cfg_defaults.h"
 #include "stm32h7xx_hal.h"
+#include <math.h>
+#include <string.h>
 
 /* Private typedef -----------------------------------------------------------*/
 
-
+// Only what the DAC interrupt reads of each message of a burst
+typedef struct {
+  uint8_t data[PACKET_MAX_LENGTH_BYTES];
+  uint16_t bit_count;
+} BurstMessage_t;
 
 /* Private define ------------------------------------------------------------*/
 
-
+#define OFDM_CHIRP_STEP_SAMPLES   (CHIRP_STEP_DURATION_US * (ADC_SAMPLING_RATE / 1000) / 1000)
 
 /* Private macro -------------------------------------------------------------*/
 
@@ -31,49 +40,109 @@
 /* Private variables ---------------------------------------------------------*/
 
 static float output_amplitude = DEFAULT_OUTPUT_AMPLITUDE;
+static float gfsk_bt = DEFAULT_GFSK_BT;
 
 static WaveformStep_t test_sequence[2];
 
 static uint32_t test_freq = 30000;
 
+// Messages of the burst being sent, the one being sent and the position in
+// it, read from the DAC interrupt as each step or symbol is needed
+static BurstMessage_t tx_burst[MODULATE_MAX_BURST_MESSAGES];
+static uint8_t tx_burst_length = 0;
+static uint8_t tx_burst_index = 0;
+static uint32_t tx_gap_us = 0;
+static bool tx_in_gap = false;
+static uint32_t tx_gap_samples = 0;   // Left of the OFDM gap
+static WaveformStep_t tx_last_step;
+static BitMessage_t tx_message;
+static uint16_t tx_position = 0;
+static uint16_t tx_chirp_steps = 0;
+static uint16_t tx_num_symbols = 0;
+static uint64_t tx_period_q16 = 0; // Symbol period in micro seconds, Q16
+static float ofdm_chirp_phase = 0.0f;
+static uint8_t ofdm_bits[OFDM_BITS_PER_SYMBOL];
+static float ofdm_samples[OFDM_SYMBOL_LENGTH];
+
 /* Private function prototypes -----------------------------------------------*/
 
-bool convertToFrequencyFsk(BitMessage_t* bit_msg, WaveformStep_t* message_sequence);
-bool convertToFrequencyFhbfsk(BitMessage_t* bit_msg, WaveformStep_t* message_sequence);
+static bool messageStepSource(WaveformStep_t* step);
+static bool getMessageStep(uint16_t position, WaveformStep_t* step);
+static void loadBurstMessage(uint8_t index);
+static float getToneAmplitude(uint32_t freq_hz);
+static uint16_t ofdmSource(const float** samples);
+static bool getSymbolBits(uint16_t first_bit, uint8_t num_bits, uint16_t* symbol);
 uint32_t getFskFrequency(bool bit);
 
 /* Exported function definitions ---------------------------------------------*/
 
-bool Modulate_ConvertToFrequency(BitMessage_t* bit_msg, WaveformStep_t* message_sequence)
+bool Modulate_SetMessageSource(BitMessage_t* bit_msg)
 {
-  switch (mod_demod_method) {
-    case MOD_DEMOD_FSK:
-      return convertToFrequencyFsk(bit_msg, message_sequence);
-      break;
-    case MOD_DEMOD_FHBFSK:
-      return convertToFrequencyFhbfsk(bit_msg, message_sequence);
-      break;
-    default:
-      break;
+  Modulate_ClearBurst();
+  if (Modulate_AddToBurst(bit_msg) == false) {
+    return false;
   }
-  return true;
+  return Modulate_SetBurstSource(0);
+}
+
+void Modulate_ClearBurst(void)
+{
+  tx_burst_length = 0;
 }
 
-bool Modulate_ApplyAmplitude(WaveformStep_t* message_sequence, uint16_t len)
+bool Modulate_AddToBurst(BitMessage_t* bit_msg)
 {
-  float amplitude = output_amplitude;
-  for (uint16_t i = 0; i < len; i++) {
-    message_sequence[i].relative_amplitude = amplitude;
+  if (bit_msg == NULL || tx_burst_length >= MODULATE_MAX_BURST_MESSAGES) {
+    return false;
   }
+
+  memcpy(tx_burst[tx_burst_length].data, bit_msg->data, PACKET_MAX_LENGTH_BYTES);
+  tx_burst[tx_burst_length].bit_count = bit_msg->bit_count;
+  tx_burst_length++;
   return true;
 }
 
-bool Modulate_ApplyDuration(WaveformStep_t* message_sequence, uint16_t len)
+bool Modulate_SetBurstSource(uint32_t gap_ms)
 {
-  for (uint16_t i = 0; i < len; i++) {
-    message_sequence[i].duration_us = (uint32_t) roundf(1000000.0f / baud_rate);
+  if (tx_burst_length == 0) {
+    return false;
   }
-  return true;
+
+  tx_gap_us = gap_ms * 1000;
+  tx_chirp_steps = (chirp_preamble == true) ? CHIRP_PREAMBLE_STEPS : 0;
+  loadBurstMessage(0);
+
+  if (mod_demod_method == MOD_DEMOD_OFDM) {
+    uint16_t first_bin;
+    if (Ofdm_GetFirstBin(&first_bin) == false) {
+      return false;
+    }
+    return DAC_SetSampleSource(ofdmSource, ADC_SAMPLING_RATE, output_amplitude);
+  }
+
+  if (mod_demod_method == MOD_DEMOD_MFSK) {
+    uint16_t num_tones = 1 << mfsk_bits_per_symbol;
+    if (Modulate_GetMfskToneFrequency(0) < MIN_FSK_FREQUENCY ||
+        Modulate_GetMfskToneFrequency(num_tones - 1) > MAX_FSK_FREQUENCY) {
+      return false; // The tone set does not fit in the transducer band
+    }
+  }
+
+  // Symbols can end anywhere in a DAC half buffer so the period only needs
+  // to round to whole micro seconds at each boundary
+  tx_period_q16 = (uint64_t) llround(65536.0 * 1000000.0 / baud_rate);
+  if (tx_period_q16 < (1 << 16)) {
+    return false;
+  }
+  return DAC_SetStepSource(messageStepSource, gfsk_bt);
+}
+
+uint32_t Modulate_GetChirpFrequency(uint16_t step_index)
+{
+  // Each step sits in the middle of its share of the sweep
+  int32_t sweep = (int32_t) chirp_end_freq - (int32_t) chirp_start_freq;
+  int32_t offset = sweep * (2 * step_index + 1) / (2 * CHIRP_PREAMBLE_STEPS);
+  return (uint32_t) ((int32_t) chirp_start_freq + offset);
 }
 
 float Modulate_GetTransducerAmplitude(void)
@@ -92,6 +161,7 @@ bool Modulate_StartTransducerOutput()
   ADC_StopAll();
   DAC_StopWaveformOutput();
   osDelay(1);
+  Feedback_Reset();
   if (ADC_StartFeedback() == false) {
     return false;
   }
@@ -130,15 +200,102 @@ void Modulate_TestFrequencyResponse()
 }
 
 uint32_t Modulate_GetFhbfskFrequency(bool bit, uint16_t bit_index)
+{
+  return Modulate_GetFhbfskToneFrequency(Modulate_GetFhbfskToneIndex(bit, bit_index));
+}
+
+uint16_t Modulate_GetFhbfskToneIndex(bool bit, uint16_t bit_index)
+{
+  uint16_t frequency_index = 2 * ((bit_index / fhbfsk_dwell_time) % fhbfsk_num_tones);
+  frequency_index += bit;
+  return frequency_index;
+}
+
+uint32_t Modulate_GetFhbfskToneFrequency(uint16_t tone_index)
 {
   uint32_t frequency_separation = fhbfsk_freq_spacing * baud_rate;
 
   uint32_t start_freq = fc - frequency_separation * (2 * fhbfsk_num_tones - 1) / 2;
   start_freq = (start_freq / frequency_separation) * frequency_separation;
 
-  uint32_t frequency_index = 2 * ((bit_index / fhbfsk_dwell_time) % fhbfsk_num_tones);
-  frequency_index += bit;
-  return start_freq + frequency_separation * frequency_index;
+  return start_freq + frequency_separation * tone_index;
+}
+
+uint8_t Modulate_GetBitsPerSymbol(void)
+{
+  switch (mod_demod_method) {
+    case MOD_DEMOD_MFSK:
+      return mfsk_bits_per_symbol;
+    case MOD_DEMOD_DQPSK:
+      return 2;
+    case MOD_DEMOD_OFDM:
+      return OFDM_BITS_PER_SYMBOL;
+    default:
+      return 1;
+  }
+}
+
+uint16_t Modulate_GetSymbolCount(uint16_t bit_count)
+{
+  uint8_t bits_per_symbol = Modulate_GetBitsPerSymbol();
+  uint16_t num_symbols = (bit_count + bits_per_symbol - 1) / bits_per_symbol;
+  if (Modulate_IsDifferential() == true) {
+    num_symbols += DPSK_REFERENCE_SYMBOLS;
+  }
+  else if (mod_demod_method == MOD_DEMOD_OFDM) {
+    num_symbols += OFDM_TRAINING_SYMBOLS;
+  }
+  return num_symbols;
+}
+
+float Modulate_GetSymbolRate(void)
+{
+  if (mod_demod_method == MOD_DEMOD_OFDM) {
+    return (float) ADC_SAMPLING_RATE / OFDM_SYMBOL_LENGTH;
+  }
+  return baud_rate;
+}
+
+bool Modulate_IsDifferential(void)
+{
+  return mod_demod_method == MOD_DEMOD_DBPSK || mod_demod_method == MOD_DEMOD_DQPSK;
+}
+
+uint8_t Modulate_GetDpskPhaseQuarters(uint8_t symbol)
+{
+  // Gray coded so that the nearest wrong phase only flips one bit
+  if (mod_demod_method == MOD_DEMOD_DBPSK) {
+    return (symbol & 1) * 2;
+  }
+  return (symbol & 3) ^ ((symbol & 3) >> 1);
+}
+
+uint16_t Modulate_GetMfskToneIndex(uint16_t symbol)
+{
+  // Inverse of the Gray code in Modulate_GetMfskSymbol
+  uint16_t tone_index = symbol;
+  for (uint16_t shift = symbol >> 1; shift != 0; shift >>= 1) {
+    tone_index ^= shift;
+  }
+  return tone_index;
+}
+
+uint16_t Modulate_GetMfskSymbol(uint16_t tone_index)
+{
+  return tone_index ^ (tone_index >> 1);
+}
+
+uint32_t Modulate_GetMfskToneFrequency(uint16_t tone_index)
+{
+  uint32_t frequency_separation = baud_rate;
+  uint16_t num_tones = 1 << mfsk_bits_per_symbol;
+
+  // Whole cycles per symbol keep the tones orthogonal, rounding to the nearest
+  // multiple keeps the set centred
+  uint32_t start_freq = fc - frequency_separation * (num_tones - 1) / 2;
+  start_freq = ((start_freq + frequency_separation / 2) / frequency_separation) * frequency_separation;
+
+  return start_freq + frequency_separation * tone_index;
 }
 
 bool Modulate_RegisterParams()
@@ -150,32 +307,206 @@ bool Modulate_RegisterParams()
     return false;
   }
 
+  min = MIN_GFSK_BT;
+  max = MAX_GFSK_BT;
+  if (Param_Register(PARAM_GFSK_BT, "GFSK bandwidth-time product", PARAM_TYPE_FLOAT,
+                     &gfsk_bt, sizeof(float), &min, &max) == false) {
+    return false;
+  }
+
   return true;
 }
 
 
 /* Private function definitions ----------------------------------------------*/
 
-bool convertToFrequencyFsk(BitMessage_t* bit_msg, WaveformStep_t* message_sequence)
+// Chirp steps, then one step per symbol, for each message of the burst
+static bool messageStepSource(WaveformStep_t* step)
 {
-  for (uint16_t i = 0; i < bit_msg->bit_count; i++) {
-    bool bit;
-    if (Packet_GetBit(bit_msg, i, &bit) == false) {
+  if (tx_position >= tx_chirp_steps + tx_num_symbols) {
+    if (tx_burst_index + 1 >= tx_burst_length) {
       return false;
     }
-    message_sequence[i].freq_hz = getFskFrequency(bit);
+    // The gap is silent. Its first half holds the tone of the last step and
+    // its second half the tone of the next message's first step, so any
+    // frequency shaping happens where nothing is sent.
+    if (tx_gap_us != 0 && tx_in_gap == false) {
+      *step = tx_last_step;
+      step->relative_amplitude = 0.0f;
+      step->duration_us = tx_gap_us / 2;
+      step->phase_offset = 0;
+      tx_in_gap = true;
+      return true;
+    }
+    loadBurstMessage(tx_burst_index + 1);
+    if (tx_gap_us != 0) {
+      if (getMessageStep(0, step) == false) {
+        return false;
+      }
+      step->relative_amplitude = 0.0f;
+      step->duration_us = tx_gap_us - tx_gap_us / 2;
+      step->phase_offset = 0;
+      return true;
+    }
   }
+
+  if (getMessageStep(tx_position, step) == false) {
+    return false;
+  }
+  tx_last_step = *step;
+  tx_position++;
   return true;
 }
 
-bool convertToFrequencyFhbfsk(BitMessage_t* bit_msg, WaveformStep_t* message_sequence)
+static bool getMessageStep(uint16_t position, WaveformStep_t* step)
+{
+  memset(step, 0, sizeof(WaveformStep_t)); // Only the PSK methods jump the carrier phase
+  if (position < tx_chirp_steps) {
+    // Left unshaped so it matches the receiver's reference
+    step->freq_hz = Modulate_GetChirpFrequency(position);
+    step->carrier_hz = step->freq_hz;
+    step->duration_us = CHIRP_STEP_DURATION_US;
+    step->relative_amplitude = getToneAmplitude(step->freq_hz);
+    return true;
+  }
+
+  uint16_t index = position - tx_chirp_steps;
+  uint8_t bits_per_symbol = Modulate_GetBitsPerSymbol();
+  uint16_t symbol;
+  // Rounding each boundary rather than each duration keeps a long message
+  // from drifting against the receiver's symbol clock
+  step->duration_us = (uint32_t) ((((index + 1) * tx_period_q16 + 0x8000) >> 16) -
+                                  ((index * tx_period_q16 + 0x8000) >> 16));
+  switch (mod_demod_method) {
+    case MOD_DEMOD_FSK:
+      if (getSymbolBits(index, 1, &symbol) == false) {
+        return false;
+      }
+      step->freq_hz = getFskFrequency(symbol != 0);
+      step->carrier_hz = fsk_f0;
+      break;
+    case MOD_DEMOD_FHBFSK:
+      if (getSymbolBits(index, 1, &symbol) == false) {
+        return false;
+      }
+      // Each hop switches carrier, only the bit within it is shaped
+      step->freq_hz = Modulate_GetFhbfskFrequency(symbol != 0, index);
+      step->carrier_hz = Modulate_GetFhbfskFrequency(false, index);
+      break;
+    case MOD_DEMOD_MFSK:
+      if (getSymbolBits(index * bits_per_symbol, bits_per_symbol, &symbol) == false) {
+        return false;
+      }
+      step->freq_hz = Modulate_GetMfskToneFrequency(Modulate_GetMfskToneIndex(symbol));
+      step->carrier_hz = Modulate_GetMfskToneFrequency(0);
+      break;
+    // The carrier stays on fc and each symbol jumps its phase from the
+    // previous symbol, the reference symbol gives the first one something to
+    // be compared to
+    case MOD_DEMOD_DBPSK:
+    case MOD_DEMOD_DQPSK:
+      step->freq_hz = fc;
+      step->carrier_hz = fc;
+      if (index >= DPSK_REFERENCE_SYMBOLS) {
+        uint16_t first_bit = (index - DPSK_REFERENCE_SYMBOLS) * bits_per_symbol;
+        if (getSymbolBits(first_bit, bits_per_symbol, &symbol) == false) {
+          return false;
+        }
+        step->phase_offset = (uint32_t) Modulate_GetDpskPhaseQuarters(symbol) << 30;
+      }
+      break;
+    default:
+      return false;
+  }
+  step->relative_amplitude = getToneAmplitude(step->freq_hz);
+  return true;
+}
+
+// Makes a message of the burst the one being sent, from its start
+static void loadBurstMessage(uint8_t index)
+{
+  tx_burst_index = index;
+  memcpy(tx_message.data, tx_burst[index].data, PACKET_MAX_LENGTH_BYTES);
+  tx_message.bit_count = tx_burst[index].bit_count;
+  tx_position = 0;
+  tx_num_symbols = Modulate_GetSymbolCount(tx_message.bit_count);
+  tx_in_gap = false;
+  tx_gap_samples = (uint32_t) ((uint64_t) tx_gap_us * ADC_SAMPLING_RATE / 1000000);
+  ofdm_chirp_phase = 0.0f;
+}
+
+// Pre-equalizes the transducer response with the calibration table, never
+// past the largest output amplitude allowed
+static float getToneAmplitude(uint32_t freq_hz)
+{
+  float amplitude = output_amplitude * Calibration_GetGain(freq_hz);
+  return (amplitude > MAX_OUTPUT_AMPLITUDE) ? MAX_OUTPUT_AMPLITUDE : amplitude;
+}
+
+// Chirp steps, then the training symbols, then the data, each made when the
+// DAC has used up the one before. The messages of a burst are separated by
+// silence.
+static uint16_t ofdmSource(const float** samples)
+{
+  if (tx_position >= tx_chirp_steps + tx_num_symbols) {
+    if (tx_burst_index + 1 >= tx_burst_length) {
+      return 0;
+    }
+    if (tx_gap_samples != 0) {
+      uint16_t length = (tx_gap_samples < OFDM_SYMBOL_LENGTH) ? tx_gap_samples : OFDM_SYMBOL_LENGTH;
+      memset(ofdm_samples, 0, length * sizeof(float));
+      tx_gap_samples -= length;
+      *samples = ofdm_samples;
+      return length;
+    }
+    loadBurstMessage(tx_burst_index + 1);
+  }
+
+  if (tx_position < tx_chirp_steps) {
+    // Continuous phase from one step to the next like the DAC sequencer
+    float phase_increment = 2.0f * (float) M_PI * Modulate_GetChirpFrequency(tx_position) / ADC_SAMPLING_RATE;
+    for (uint16_t n = 0; n < OFDM_CHIRP_STEP_SAMPLES; n++) {
+      ofdm_samples[n] = sinf(ofdm_chirp_phase);
+      ofdm_chirp_phase = remainderf(ofdm_chirp_phase + phase_increment, 2.0f * (float) M_PI);
+    }
+    tx_position++;
+    *samples = ofdm_samples;
+    return OFDM_CHIRP_STEP_SAMPLES;
+  }
+
+  uint16_t symbol = tx_position - tx_chirp_steps;
+  bool training = symbol < OFDM_TRAINING_SYMBOLS;
+  if (training == false) {
+    uint16_t first_bit = (symbol - OFDM_TRAINING_SYMBOLS) * OFDM_BITS_PER_SYMBOL;
+    for (uint16_t i = 0; i < OFDM_BITS_PER_SYMBOL; i++) {
+      uint16_t bit;
+      if (getSymbolBits(first_bit + i, 1, &bit) == false) {
+        return 0;
+      }
+      ofdm_bits[i] = bit;
+    }
+  }
+  if (Ofdm_ModulateSymbol(ofdm_bits, training, ofdm_samples) == false) {
+    return 0;
+  }
+  tx_position++;
+  *samples = ofdm_samples;
+  return OFDM_SYMBOL_LENGTH;
+}
+
+// Reads num_bits bits of the message into a symbol, first bit in the most
+// significant position. Bits past the end of the message pad the last symbol
+// with 0.
+static bool getSymbolBits(uint16_t first_bit, uint8_t num_bits, uint16_t* symbol)
 {
-  for (uint16_t i = 0; i < bit_msg->bit_count; i++) {
-    bool bit;
-    if (Packet_GetBit(bit_msg, i, &bit) == false) {
+  *symbol = 0;
+  for (uint8_t i = 0; i < num_bits; i++) {
+    bool bit = false;
+    uint16_t bit_index = first_bit + i;
+    if (bit_index < tx_message.bit_count && Packet_GetBit(&tx_message, bit_index, &bit) == false) {
       return false;
     }
-    message_sequence[i].freq_hz = Modulate_GetFhbfskFrequency(bit, i);
+    *symbol = (*symbol << 1) | bit;
   }
   return true;
 }
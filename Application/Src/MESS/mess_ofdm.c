@@ -0,0 +1,255 @@
+/*
+ * mess_ofdm.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "mess_ofdm.h"
+#include "mess_adc.h"
+#include "mess_main.h"
+#include "mess_calibration.h"
+#include "cfg_defaults.h"
+#include "arm_math.h"
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define OFDM_RMS_LEVEL              0.3f  // Leaves about 10 dB for the peaks before they clip
+#define OFDM_NOISE_AVERAGE_SYMBOLS  8     // Data symbols the noise estimate averages over
+#define OFDM_PATTERN_SEED           0xACE1u
+
+#define INV_SQRT2                   0.70710678f
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static arm_rfft_fast_instance_f32 fft_handle;
+static bool ofdm_ready = false;
+static int8_t carrier_pattern[OFDM_NUM_CARRIERS]; // Training and pilot values
+
+// The transmitter runs from the DAC interrupt so it never shares buffers with
+// the receiver
+static float tx_spectrum[OFDM_FFT_SIZE];
+static float tx_time[OFDM_FFT_SIZE];
+static float rx_time[OFDM_FFT_SIZE];
+static float rx_spectrum[OFDM_FFT_SIZE];
+
+static float channel_real[OFDM_NUM_CARRIERS];
+static float channel_imag[OFDM_NUM_CARRIERS];
+static float noise_energy_mean = 0.0f;
+static uint16_t noise_average_symbols = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool initOfdm(void);
+static bool isPilot(uint16_t carrier);
+
+/* Exported function definitions ---------------------------------------------*/
+
+bool Ofdm_GetFirstBin(uint16_t* first_bin)
+{
+  if (first_bin == NULL) {
+    return false;
+  }
+
+  int32_t centre_bin = (int32_t) lroundf((float) fc * OFDM_FFT_SIZE / ADC_SAMPLING_RATE);
+  int32_t first = centre_bin - OFDM_NUM_CARRIERS / 2;
+  int32_t last = first + OFDM_NUM_CARRIERS - 1;
+  if (first * ADC_SAMPLING_RATE < MIN_FSK_FREQUENCY * OFDM_FFT_SIZE ||
+      last * ADC_SAMPLING_RATE > MAX_FSK_FREQUENCY * OFDM_FFT_SIZE) {
+    return false;
+  }
+  *first_bin = (uint16_t) first;
+  return true;
+}
+
+bool Ofdm_ModulateSymbol(const uint8_t* bits, bool training, float* samples)
+{
+  uint16_t first_bin;
+  if (samples == NULL || (training == false && bits == NULL)) {
+    return false;
+  }
+  if (initOfdm() == false || Ofdm_GetFirstBin(&first_bin) == false) {
+    return false;
+  }
+
+  memset(tx_spectrum, 0, sizeof(tx_spectrum));
+  uint16_t bit_index = 0;
+  for (uint16_t c = 0; c < OFDM_NUM_CARRIERS; c++) {
+    uint16_t bin = first_bin + c;
+    // Pre-equalized like the tones of the other methods, the receiver's
+    // channel estimate takes in the gain with the rest of the channel
+    float gain = Calibration_GetGain((uint32_t) bin * ADC_SAMPLING_RATE / OFDM_FFT_SIZE);
+    if (training == true || isPilot(c) == true) {
+      tx_spectrum[2 * bin] = gain * carrier_pattern[c];
+    }
+    else {
+      tx_spectrum[2 * bin] = (bits[bit_index] != 0) ? -gain * INV_SQRT2 : gain * INV_SQRT2;
+      tx_spectrum[2 * bin + 1] = (bits[bit_index + 1] != 0) ? -gain * INV_SQRT2 : gain * INV_SQRT2;
+      bit_index += 2;
+    }
+  }
+  arm_rfft_fast_f32(&fft_handle, tx_spectrum, tx_time, 1);
+
+  // Unit carriers come out of the inverse FFT with an RMS of sqrt(2 M) / N
+  const float scale = OFDM_RMS_LEVEL * OFDM_FFT_SIZE / sqrtf(2.0f * OFDM_NUM_CARRIERS);
+  for (uint16_t n = 0; n < OFDM_SYMBOL_LENGTH; n++) {
+    float value = scale * tx_time[(n + OFDM_FFT_SIZE - OFDM_CP_LENGTH) & (OFDM_FFT_SIZE - 1)];
+    samples[n] = fminf(fmaxf(value, -1.0f), 1.0f);
+  }
+  return true;
+}
+
+bool Ofdm_DemodulateSymbol(const uint16_t* buffer, uint16_t buf_len, uint16_t start_index, bool training,
+                           uint8_t* bits, float* llr, float* signal_energy, float* noise_energy)
+{
+  uint16_t first_bin;
+  if (buffer == NULL || signal_energy == NULL || noise_energy == NULL) {
+    return false;
+  }
+  if (training == false && (bits == NULL || llr == NULL)) {
+    return false;
+  }
+  if (buf_len < OFDM_FFT_SIZE || (buf_len & (buf_len - 1)) != 0) {
+    return false;
+  }
+  if (initOfdm() == false || Ofdm_GetFirstBin(&first_bin) == false) {
+    return false;
+  }
+
+  uint16_t mask = buf_len - 1;
+  for (uint16_t n = 0; n < OFDM_FFT_SIZE; n++) {
+    rx_time[n] = (float) buffer[(start_index + n) & mask];
+  }
+  arm_rfft_fast_f32(&fft_handle, rx_time, rx_spectrum, 0);
+  const float* y_real = &rx_spectrum[2 * first_bin];
+  const float* y_imag = &rx_spectrum[2 * first_bin + 1];
+
+  // Every carrier of a training symbol is known, which gives the channel
+  // whatever the delay of the window into the symbol
+  if (training == true) {
+    float energy = 0.0f;
+    for (uint16_t c = 0; c < OFDM_NUM_CARRIERS; c++) {
+      channel_real[c] = y_real[2 * c] * carrier_pattern[c];
+      channel_imag[c] = y_imag[2 * c] * carrier_pattern[c];
+      energy += channel_real[c] * channel_real[c] + channel_imag[c] * channel_imag[c];
+    }
+    noise_energy_mean = 0.0f;
+    noise_average_symbols = 0;
+    *signal_energy = energy / OFDM_NUM_CARRIERS;
+    *noise_energy = noise_energy_mean;
+    return true;
+  }
+
+  // Change of the channel at each pilot since the training symbol
+  float ratio_real[OFDM_NUM_PILOTS];
+  float ratio_imag[OFDM_NUM_PILOTS];
+  for (uint16_t p = 0; p < OFDM_NUM_PILOTS; p++) {
+    uint16_t c = p * OFDM_PILOT_SPACING;
+    float h_real = channel_real[c];
+    float h_imag = channel_imag[c];
+    float h_energy = h_real * h_real + h_imag * h_imag;
+    if (h_energy <= FLT_MIN) {
+      ratio_real[p] = 1.0f;
+      ratio_imag[p] = 0.0f;
+      continue;
+    }
+    float pilot_real = y_real[2 * c] * carrier_pattern[c];
+    float pilot_imag = y_imag[2 * c] * carrier_pattern[c];
+    ratio_real[p] = (pilot_real * h_real + pilot_imag * h_imag) / h_energy;
+    ratio_imag[p] = (pilot_imag * h_real - pilot_real * h_imag) / h_energy;
+  }
+
+  float channel_energy = 0.0f;
+  float error_energy = 0.0f;
+  float metric_real[OFDM_NUM_DATA_CARRIERS];
+  float metric_imag[OFDM_NUM_DATA_CARRIERS];
+  uint16_t d = 0;
+  for (uint16_t c = 0; c < OFDM_NUM_CARRIERS; c++) {
+    if (isPilot(c) == true) {
+      continue;
+    }
+    uint16_t p = c / OFDM_PILOT_SPACING;
+    float fraction = (float) (c % OFDM_PILOT_SPACING) / OFDM_PILOT_SPACING;
+    float r_real = ratio_real[p] + fraction * (ratio_real[p + 1] - ratio_real[p]);
+    float r_imag = ratio_imag[p] + fraction * (ratio_imag[p + 1] - ratio_imag[p]);
+    float h_real = channel_real[c] * r_real - channel_imag[c] * r_imag;
+    float h_imag = channel_real[c] * r_imag + channel_imag[c] * r_real;
+
+    // Matched to the channel, the sign of each axis is the decision
+    float s_real = y_real[2 * c] * h_real + y_imag[2 * c] * h_imag;
+    float s_imag = y_imag[2 * c] * h_real - y_real[2 * c] * h_imag;
+    bits[2 * d] = (s_real < 0.0f) ? 1 : 0;
+    bits[2 * d + 1] = (s_imag < 0.0f) ? 1 : 0;
+
+    float x_real = (s_real < 0.0f) ? -INV_SQRT2 : INV_SQRT2;
+    float x_imag = (s_imag < 0.0f) ? -INV_SQRT2 : INV_SQRT2;
+    float e_real = y_real[2 * c] - (h_real * x_real - h_imag * x_imag);
+    float e_imag = y_imag[2 * c] - (h_real * x_imag + h_imag * x_real);
+    error_energy += e_real * e_real + e_imag * e_imag;
+    channel_energy += h_real * h_real + h_imag * h_imag;
+
+    metric_real[d] = s_real;
+    metric_imag[d] = s_imag;
+    d++;
+  }
+
+  // Decision directed, so the estimate runs low once decisions start failing
+  if (noise_average_symbols < OFDM_NOISE_AVERAGE_SYMBOLS) {
+    noise_average_symbols++;
+  }
+  noise_energy_mean += (error_energy / OFDM_NUM_DATA_CARRIERS - noise_energy_mean) / noise_average_symbols;
+  float noise = fmaxf(noise_energy_mean, FLT_MIN);
+
+  // Each axis is BPSK at 1/sqrt(2) of the carrier amplitude with half the
+  // noise energy
+  for (d = 0; d < OFDM_NUM_DATA_CARRIERS; d++) {
+    llr[2 * d] = -2.0f * (float) M_SQRT2 * metric_real[d] / noise;
+    llr[2 * d + 1] = -2.0f * (float) M_SQRT2 * metric_imag[d] / noise;
+  }
+  *signal_energy = channel_energy / OFDM_NUM_DATA_CARRIERS;
+  *noise_energy = noise_energy_mean;
+  return true;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static bool initOfdm(void)
+{
+  if (ofdm_ready == true) {
+    return true;
+  }
+  if (arm_rfft_fast_init_f32(&fft_handle, OFDM_FFT_SIZE) != ARM_MATH_SUCCESS) {
+    return false;
+  }
+
+  // 16-bit Galois LFSR so both ends derive the same pattern
+  uint16_t lfsr = OFDM_PATTERN_SEED;
+  for (uint16_t c = 0; c < OFDM_NUM_CARRIERS; c++) {
+    uint16_t bit = lfsr & 1;
+    lfsr >>= 1;
+    if (bit != 0) {
+      lfsr ^= 0xB400u;
+    }
+    carrier_pattern[c] = (bit != 0) ? -1 : 1;
+  }
+  ofdm_ready = true;
+  return true;
+}
+
+static bool isPilot(uint16_t carrier)
+{
+  return (carrier % OFDM_PILOT_SPACING) == 0;
+}
@@ -11,8 +11,13 @@
 #include "mess_error_correction.h"
 #include "cfg_defaults.h"
 #include "cfg_parameters.h"
+#include "bit_stream.h"
+#include "golay.h"
+#include "interleaver.h"
+#include "compress.h"
 #include <stdbool.h>
 #include <string.h>
+#include <math.h>
 
 /* Private typedef -----------------------------------------------------------*/
 
@@ -30,12 +35,24 @@
 
 static uint8_t modem_id = DEFAULT_ID;
 static bool is_stationary = DEFAULT_STATIONARY_FLAG;
+static PacketFormat_t packet_format = DEFAULT_PACKET_FORMAT;
+static uint8_t interleaver_depth = DEFAULT_INTERLEAVER_DEPTH;
+static uint8_t compressed_types = DEFAULT_COMPRESSED_TYPES;
+
+// Sent in place of the message when compressing it shortens the packet
+static Message_t compressed_msg;
+
+// Copy of the block being reordered, the interleaver can't work in place
+static uint8_t interleave_bits[PACKET_MAX_LENGTH_BYTES];
+static int8_t interleave_llr[PACKET_MAX_LENGTH_BITS];
 
 /* Private function prototypes -----------------------------------------------*/
 
 bool addPreamble(BitMessage_t* bit_msg, Message_t* msg);
 bool addMessage(BitMessage_t* bit_msg, Message_t* msg);
 void initPacket(BitMessage_t* bit_msg);
+bool interleavePacket(BitMessage_t* bit_msg);
+bool compressMessage(Message_t* msg);
 bool addChunk(BitMessage_t* bit_msg, uint8_t chunk, uint8_t chunk_size);
 bool addData(BitMessage_t* bit_msg, void* data, uint8_t num_bits);
 bool getData(BitMessage_t* bit_msg, uint16_t* start_position, uint8_t num_bits, void* data);
@@ -50,6 +67,11 @@ bool Packet_PrepareTx(Message_t* msg, BitMessage_t* bit_msg)
 
   initPacket(bit_msg);
 
+  if (compressMessage(msg) == true) {
+    msg = &compressed_msg;
+    bit_msg->compressed = true;
+  }
+
   // Add preamble to bit packet
   if (msg->data_type != EVAL) {
     if (addPreamble(bit_msg, msg) == false) {
@@ -67,24 +89,47 @@ bool Packet_PrepareTx(Message_t* msg, BitMessage_t* bit_msg)
     if (ErrorCorrection_AddCorrection(bit_msg) == false) {
       return false;
     }
+    if (interleavePacket(bit_msg) == false) {
+      return false;
+    }
   }
   return true;
 }
 
-bool Packet_PrepareRx(BitMessage_t* bit_msg)
+bool Packet_PrepareRx(BitMessage_t* bit_msg, int8_t* llr)
 {
   initPacket(bit_msg);
+  if (llr != NULL) {
+    memset(llr, 0, PACKET_MAX_LENGTH_BITS * sizeof(int8_t));
+  }
+  bit_msg->llr = llr;
 
   return true;
 }
 
 bool Packet_AddBit(BitMessage_t* bit_msg, bool bit)
+{
+  const float hard_llr = PACKET_LLR_MAX / PACKET_LLR_SCALE;
+  return Packet_AddSoftBit(bit_msg, bit, (bit == true) ? hard_llr : -hard_llr);
+}
+
+bool Packet_AddSoftBit(BitMessage_t* bit_msg, bool bit, float llr)
 {
   if (bit_msg->bit_count >= PACKET_MAX_LENGTH_BITS) {
     return false;
   }
 
-  uint8_t byte_index = bit_msg->bit_count / 8;
+  if (bit_msg->llr != NULL) {
+    float steps = roundf(llr * PACKET_LLR_SCALE);
+    if (steps > PACKET_LLR_MAX) {
+      steps = PACKET_LLR_MAX;
+    } else if (steps < -PACKET_LLR_MAX) {
+      steps = -PACKET_LLR_MAX;
+    }
+    bit_msg->llr[bit_msg->bit_count] = (int8_t) steps;
+  }
+
+  uint16_t byte_index = bit_msg->bit_count / 8;
   uint8_t bit_position = bit_msg-> bit_count % 8;
 
   if (bit == true) {
@@ -111,12 +156,51 @@ bool Packet_GetBit(BitMessage_t* bit_msg, uint16_t position, bool* bit)
   return true;
 }
 
+bool Packet_AddBits(BitMessage_t* bit_msg, const uint8_t* data, uint16_t num_bits)
+{
+  if (bit_msg->bit_count + num_bits > PACKET_MAX_LENGTH_BITS) {
+    return false;
+  }
+
+  BitStream_Write(bit_msg->data, bit_msg->bit_count, data, num_bits);
+  // Bits put back into a received message, such as decoded data, are certain
+  if (bit_msg->llr != NULL) {
+    int8_t* llr = &bit_msg->llr[bit_msg->bit_count];
+    for (uint16_t i = 0; i < num_bits; i++) {
+      llr[i] = ((data[i / 8] << (i % 8)) & 0x80) ? PACKET_LLR_MAX : -PACKET_LLR_MAX;
+    }
+  }
+  bit_msg->bit_count += num_bits;
+  return true;
+}
+
+bool Packet_GetBits(BitMessage_t* bit_msg, uint16_t* start_position, uint16_t num_bits, uint8_t* data)
+{
+  if (*start_position + num_bits > bit_msg->bit_count) {
+    return false;
+  }
+
+  BitStream_Read(bit_msg->data, *start_position, data, num_bits);
+  *start_position += num_bits;
+  return true;
+}
+
+bool Packet_GetLlr(BitMessage_t* bit_msg, uint16_t position, int8_t* llr)
+{
+  if (position >= bit_msg->bit_count || bit_msg->llr == NULL) {
+    return false;
+  }
+
+  *llr = bit_msg->llr[position];
+  return true;
+}
+
 bool Packet_Get8BitChunk(BitMessage_t* bit_msg, uint16_t* start_position, uint8_t chunk_length, uint8_t* ret)
 {
   if (*start_position + chunk_length > bit_msg->bit_count) {
     return false;
   }
-  uint8_t start_byte = *start_position / 8;
+  uint16_t start_byte = *start_position / 8;
   uint16_t raw_chunk;
   memcpy(&raw_chunk, &bit_msg->data[start_byte], sizeof(uint16_t));
 
@@ -165,6 +249,10 @@ bool Packet_Get32(BitMessage_t* bit_msg, uint16_t* start_position, uint32_t* dat
 
 uint16_t Packet_MinimumSize(uint16_t str_len)
 {
+  if (packet_format == PACKET_FORMAT_BYTE_EXACT) {
+    return (str_len > 0) ? str_len : 1;
+  }
+
   size_t packet_size = 1;
 
   // Keep doubling the packet size until it's large enough
@@ -175,6 +263,35 @@ uint16_t Packet_MinimumSize(uint16_t str_len)
   return packet_size;
 }
 
+PacketFormat_t Packet_GetFormat(void)
+{
+  return packet_format;
+}
+
+bool Packet_Deinterleave(BitMessage_t* bit_msg)
+{
+  if (bit_msg->final_length < bit_msg->preamble_length) {
+    return false;
+  }
+  if (interleaver_depth == 1) {
+    return true;
+  }
+
+  // The preamble is a whole number of bytes
+  uint16_t num_bits = bit_msg->final_length - bit_msg->preamble_length;
+  uint8_t* bits = &bit_msg->data[bit_msg->preamble_length / 8];
+  memcpy(interleave_bits, bits, (num_bits + 7) / 8);
+  if (Interleaver_Deinterleave(interleave_bits, bits, num_bits, interleaver_depth) == false) {
+    return false;
+  }
+  if (bit_msg->llr == NULL) {
+    return true;
+  }
+  int8_t* llr = &bit_msg->llr[bit_msg->preamble_length];
+  memcpy(interleave_llr, llr, num_bits);
+  return Interleaver_DeinterleaveLlr(interleave_llr, llr, num_bits, interleaver_depth);
+}
+
 bool Packet_RegisterParams()
 {
   uint32_t min_u32 = MIN_ID;
@@ -191,6 +308,27 @@ bool Packet_RegisterParams()
     return false;
   }
 
+  min_u32 = MIN_PACKET_FORMAT;
+  max_u32 = MAX_PACKET_FORMAT;
+  if (Param_Register(PARAM_PACKET_FORMAT, "packet format", PARAM_TYPE_UINT8,
+      &packet_format, sizeof(uint8_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
+  min_u32 = MIN_INTERLEAVER_DEPTH;
+  max_u32 = MAX_INTERLEAVER_DEPTH;
+  if (Param_Register(PARAM_INTERLEAVER_DEPTH, "interleaver depth", PARAM_TYPE_UINT8,
+      &interleaver_depth, sizeof(uint8_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
+  min_u32 = MIN_COMPRESSED_TYPES;
+  max_u32 = MAX_COMPRESSED_TYPES;
+  if (Param_Register(PARAM_COMPRESSED_TYPES, "compressed data types", PARAM_TYPE_UINT8,
+      &compressed_types, sizeof(uint8_t), &min_u32, &max_u32) == false) {
+    return false;
+  }
+
   return true;
 }
 
@@ -199,15 +337,62 @@ bool Packet_RegisterParams()
 void initPacket(BitMessage_t* bit_msg)
 {
   memset(bit_msg->data, 0, sizeof(bit_msg->data));
+  bit_msg->llr = NULL;
   bit_msg->bit_count = 0;
   bit_msg->sender_id = 255;
   bit_msg->contents_data_type = UNKNOWN;
   bit_msg->final_length = 0;
+  bit_msg->preamble_length = 0;
   bit_msg->stationary_flag = false;
+  bit_msg->compressed = false;
   bit_msg->preamble_received = false;
+  bit_msg->header_rejected = false;
   bit_msg->fully_received = false;
 }
 
+// Fills compressed_msg if the data type is enabled and its padded payload
+// comes out shorter than the original one
+bool compressMessage(Message_t* msg)
+{
+  if (msg->data_type >= UNKNOWN || (compressed_types & (1 << msg->data_type)) == 0) {
+    return false;
+  }
+
+  uint16_t length_bytes = (msg->length_bits + 7) / 8;
+  uint16_t compressed_bytes;
+  if (length_bytes == 0 || Compress_Encode(msg->data, length_bytes, compressed_msg.data,
+      sizeof(compressed_msg.data), &compressed_bytes) == false) {
+    return false;
+  }
+  uint16_t padded_bytes = Packet_MinimumSize(compressed_bytes);
+  if (padded_bytes >= Packet_MinimumSize(length_bytes)) {
+    return false;
+  }
+
+  memset(&compressed_msg.data[compressed_bytes], 0, padded_bytes - compressed_bytes);
+  compressed_msg.type = msg->type;
+  compressed_msg.length_bits = 8 * padded_bytes;
+  compressed_msg.timestamp = msg->timestamp;
+  compressed_msg.data_type = msg->data_type;
+  compressed_msg.sender_id = msg->sender_id;
+  compressed_msg.error_correction_error = false;
+  compressed_msg.eval_info = msg->eval_info;
+  return true;
+}
+
+// Only the bits are reordered, the transmitter has no use for their ratios
+bool interleavePacket(BitMessage_t* bit_msg)
+{
+  if (interleaver_depth == 1) {
+    return true;
+  }
+
+  uint16_t num_bits = bit_msg->bit_count - bit_msg->preamble_length;
+  uint8_t* bits = &bit_msg->data[bit_msg->preamble_length / 8];
+  memcpy(interleave_bits, bits, (num_bits + 7) / 8);
+  return Interleaver_Interleave(interleave_bits, bits, num_bits, interleaver_depth);
+}
+
 bool addPreamble(BitMessage_t* bit_msg, Message_t* msg)
 {
   if (msg->length_bits > PACKET_DATA_MAX_LENGTH_BITS) {
@@ -218,25 +403,35 @@ bool addPreamble(BitMessage_t* bit_msg, Message_t* msg)
     return false;
   }
 
-  if (addChunk(bit_msg, msg->data_type, PACKET_MESSAGE_TYPE_BITS) == false) {
+  uint8_t type_field = msg->data_type | ((bit_msg->compressed == true) ? PACKET_COMPRESSED_FLAG : 0);
+  if (addChunk(bit_msg, type_field, PACKET_MESSAGE_TYPE_BITS) == false) {
     return false;
   }
 
   uint8_t length_index = 0;
   uint16_t length_accomodated = 8;
 
-  while (length_accomodated < msg->length_bits) {
-    length_index++;
-    length_accomodated = length_accomodated << 1;
+  if (packet_format == PACKET_FORMAT_BYTE_EXACT) {
+    // Short payloads fit the length field, longer ones need the extension
+    uint16_t length_bytes = (msg->length_bits > 8) ? (msg->length_bits + 7) / 8 : 1;
+    length_index = (length_bytes <= PACKET_SHORT_MAX_BYTES) ? length_bytes - 1 : PACKET_EXTENDED_LENGTH;
+    length_accomodated = 8 * length_bytes;
+  }
+  else {
+    while (length_accomodated < msg->length_bits) {
+      length_index++;
+      length_accomodated = length_accomodated << 1;
+    }
   }
 
   if (addChunk(bit_msg, length_index, PACKET_LENGTH_BITS) == false) {
     return false;
   }
 
+  bit_msg->data_len_bits = length_accomodated;
   bit_msg->final_length += length_accomodated;
   uint16_t error_length;
-  if (ErrorCorrection_CheckLength(&error_length) == false) {
+  if (ErrorCorrection_CheckLength(length_accomodated, &error_length) == false) {
     return false;
   }
   bit_msg->final_length += error_length;
@@ -245,7 +440,31 @@ bool addPreamble(BitMessage_t* bit_msg, Message_t* msg)
     return false;
   }
 
-  bit_msg->final_length += PACKET_PREAMBLE_LENGTH_BITS;
+  // Lets the receiver correct the fields, or reject them before waiting on
+  // a length that was never sent
+  uint16_t position = 0;
+  uint8_t fields[2];
+  if (Packet_GetBits(bit_msg, &position, PACKET_HEADER_FIELD_BITS, fields) == false) {
+    return false;
+  }
+  uint32_t codeword = Golay_Encode(((uint16_t) fields[0] << 4) | (fields[1] >> 4));
+  if (addChunk(bit_msg, (codeword >> 4) & 0xFF, 8) == false ||
+      addChunk(bit_msg, codeword & 0x0F, PACKET_HEADER_PARITY_BITS - 8) == false) {
+    return false;
+  }
+  bit_msg->preamble_length = PACKET_PREAMBLE_LENGTH_BITS;
+
+  if (packet_format == PACKET_FORMAT_BYTE_EXACT && length_index == PACKET_EXTENDED_LENGTH) {
+    uint32_t extension = Golay_Encode(length_accomodated / 8 - 1);
+    if (addChunk(bit_msg, (extension >> 16) & 0xFF, 8) == false ||
+        addChunk(bit_msg, (extension >> 8) & 0xFF, 8) == false ||
+        addChunk(bit_msg, extension & 0xFF, 8) == false) {
+      return false;
+    }
+    bit_msg->preamble_length += PACKET_LENGTH_EXTENSION_BITS;
+  }
+
+  bit_msg->final_length += bit_msg->preamble_length;
 
   return true;
 }
@@ -256,14 +475,7 @@ bool addMessage(BitMessage_t* bit_msg, Message_t* msg)
     return false;
   }
 
-  for (uint16_t i = 0; i < msg->length_bits; i++) {
-    uint16_t byte_index = i / 8;
-    uint16_t bit_index = i % 8;
-    bool bit = (msg->data[byte_index] & (1 << (7 - bit_index))) != 0;
-    if (Packet_AddBit(bit_msg, bit) == false)
-      return false;
-  }
-  return true;
+  return Packet_AddBits(bit_msg, msg->data, msg->length_bits);
 }
 
 bool addChunk(BitMessage_t* bit_msg, uint8_t chunk, uint8_t chunk_size)
@@ -272,13 +484,9 @@ bool addChunk(BitMessage_t* bit_msg, uint8_t chunk, uint8_t chunk_size)
     return false;
   }
 
-  for (uint8_t i = 8 - chunk_size; i < 8; i++) {
-    bool bit = (chunk & (1 << (7 - i))) != 0;
-    if (Packet_AddBit(bit_msg, bit) == false) {
-      return false;
-    }
-  }
-  return true;
+  // The low chunk_size bits, moved up to the MSB where the bit string starts
+  uint8_t bits = (uint8_t) (chunk << (8 - chunk_size));
+  return Packet_AddBits(bit_msg, &bits, chunk_size);
 }
 
 bool addData(BitMessage_t* bit_msg, void* data, uint8_t num_bits)
@@ -291,15 +499,7 @@ bool addData(BitMessage_t* bit_msg, void* data, uint8_t num_bits)
     return false;
   }
 
-  for (uint8_t i = 0; i < num_bits; i++) {
-    uint8_t byte_index = i / 8;
-    uint8_t bit_index = i % 8;
-    bool bit = (*(((uint8_t*) data) + byte_index) & (1 << (7 - bit_index))) != 0;
-    if (Packet_AddBit(bit_msg, bit) == false) {
-      return false;
-    }
-  }
-  return true;
+  return Packet_AddBits(bit_msg, (const uint8_t*) data, num_bits);
 }
 
 bool getData(BitMessage_t* bit_msg, uint16_t* start_position, uint8_t num_bits, void* data)
@@ -312,20 +512,6 @@ bool getData(BitMessage_t* bit_msg, uint16_t* start_position, uint8_t num_bits,
     return false;
   }
 
-  for (uint8_t i = 0; i < num_bits; i++) {
-    uint8_t byte_index = i / 8;
-    uint8_t bit_index = i % 8;
-    bool bit;
-    if (Packet_GetBit(bit_msg, *start_position + i, &bit) == false) {
-      return false;
-    }
-    if (bit == true) {
-      *(((uint8_t*) data) + byte_index) |= (1 << (7 - bit_index));
-    } else {
-      *(((uint8_t*) data) + byte_index) &= ~(1 << (7 - bit_index));
-    }
-  }
-  *start_position += num_bits;
-  return true;
+  return Packet_GetBits(bit_msg, start_position, num_bits, (uint8_t*) data);
 }
 // TODO: Add the error correction codes to the messages. Implement error correction functions to find crcs and checksums
@@ -40,6 +40,7 @@ void Error_Routine(ErrorCodes_t error_code)
     case ERROR_MESS_INIT:
     case ERROR_SYS_INIT:
     case ERROR_MESS_PROCESSING:
+    case ERROR_MESS_OVERRUN:
       WS_SetColour(0, 255, 0, 0);
       break;
     default:
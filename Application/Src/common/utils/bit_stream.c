@@ -0,0 +1,126 @@
+/*
+ * bit_stream.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "bit_stream.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+
+
+/* Private function prototypes -----------------------------------------------*/
+
+static uint32_t loadBe32(const uint8_t* bytes);
+static void storeBe32(uint8_t* bytes, uint32_t word);
+
+/* Exported function definitions ---------------------------------------------*/
+
+void BitStream_Write(uint8_t* dest, uint32_t dest_bit, const uint8_t* src, uint32_t num_bits)
+{
+  uint8_t* out = &dest[dest_bit / 8];
+  uint8_t offset = dest_bit % 8;
+  uint32_t num_bytes = num_bits / 8;
+  uint8_t last_bits = num_bits % 8;
+
+  if (offset == 0) {
+    memcpy(out, src, num_bytes);
+    if (last_bits != 0) {
+      uint8_t mask = (uint8_t) (0xFF << (8 - last_bits));
+      out[num_bytes] = (out[num_bytes] & ~mask) | (src[num_bytes] & mask);
+    }
+    return;
+  }
+
+  // The bits already in the first byte are carried in front of the source
+  // and each output word takes the top of the carry and source together
+  uint32_t carry = *out >> (8 - offset);
+  uint32_t i = 0;
+  for (; i + 4 <= num_bytes; i += 4) {
+    uint32_t word = loadBe32(&src[i]);
+    storeBe32(out, (uint32_t) ((((uint64_t) carry << 32) | word) >> offset));
+    carry = word & ((1u << offset) - 1);
+    out += 4;
+  }
+  for (; i < num_bytes; i++) {
+    *out++ = (uint8_t) (((carry << 8) | src[i]) >> offset);
+    carry = src[i] & ((1u << offset) - 1);
+  }
+
+  // offset carried bits and last_bits source bits are left, followed by bits
+  // of dest that must be kept
+  uint8_t pending = offset + last_bits;
+  uint16_t bits = (uint16_t) (carry << (16 - offset));
+  if (last_bits != 0) {
+    bits |= (uint16_t) (src[num_bytes] & (0xFF << (8 - last_bits))) << (8 - offset);
+  }
+  uint16_t mask = (uint16_t) (0xFFFF << (16 - pending));
+  out[0] = (out[0] & ~(mask >> 8)) | (bits >> 8);
+  if (pending > 8) {
+    out[1] = (out[1] & ~mask) | (bits & 0xFF);
+  }
+}
+
+void BitStream_Read(const uint8_t* src, uint32_t src_bit, uint8_t* dest, uint32_t num_bits)
+{
+  const uint8_t* in = &src[src_bit / 8];
+  uint8_t offset = src_bit % 8;
+  uint32_t num_bytes = num_bits / 8;
+  uint8_t last_bits = num_bits % 8;
+
+  if (offset == 0) {
+    memcpy(dest, in, num_bytes);
+  }
+  else {
+    // Every whole output byte straddles two input bytes, both inside the
+    // bits being read
+    uint32_t i = 0;
+    for (; i + 4 <= num_bytes; i += 4) {
+      uint32_t word = loadBe32(&in[i]);
+      storeBe32(&dest[i], (word << offset) | (in[i + 4] >> (8 - offset)));
+    }
+    for (; i < num_bytes; i++) {
+      dest[i] = (uint8_t) ((in[i] << offset) | (in[i + 1] >> (8 - offset)));
+    }
+  }
+
+  if (last_bits != 0) {
+    uint8_t bits = (uint8_t) (in[num_bytes] << offset);
+    if (offset + last_bits > 8) {
+      bits |= in[num_bytes + 1] >> (8 - offset);
+    }
+    dest[num_bytes] = bits & (uint8_t) (0xFF << (8 - last_bits));
+  }
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static uint32_t loadBe32(const uint8_t* bytes)
+{
+  return (uint32_t) bytes[0] << 24 | (uint32_t) bytes[1] << 16 | (uint32_t) bytes[2] << 8 | bytes[3];
+}
+
+static void storeBe32(uint8_t* bytes, uint32_t word)
+{
+  bytes[0] = (uint8_t) (word >> 24);
+  bytes[1] = (uint8_t) (word >> 16);
+  bytes[2] = (uint8_t) (word >> 8);
+  bytes[3] = (uint8_t) word;
+}
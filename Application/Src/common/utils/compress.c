@@ -0,0 +1,248 @@
+/*
+ * compress.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "compress.h"
+#include <stddef.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+typedef struct {
+  uint8_t* data;
+  uint32_t bit;
+  uint32_t max_bits;
+} BitWriter_t;
+
+typedef struct {
+  const uint8_t* data;
+  uint32_t bit;
+  uint32_t num_bits;
+} BitReader_t;
+
+/* Private define ------------------------------------------------------------*/
+
+#define WINDOW_SIZE             (1u << COMPRESS_OFFSET_BITS)
+#define LITERAL_FLAG            1
+#define NO_POSITION             (-1)
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+// Text the compressor can match before it has any of its own. Only the last
+// WINDOW_SIZE bytes before a position are in reach, so the most common
+// fragments go at the end where they stay in reach longest.
+static const char dictionary[] =
+  "$GPGGA,$GPRMC,heading=,speed=,range=,salinity=,pressure=,current=,"
+  "voltage=,warning,ERROR,FAIL,error=,false,true,node=,seq=,ack,"
+  "lat=,lon=,time=,t=,depth=,temp=,bat=,status=OK,id=0.00,1.0,";
+
+#define DICTIONARY_SIZE         (sizeof(dictionary) - 1)
+
+_Static_assert(DICTIONARY_SIZE < WINDOW_SIZE,
+               "The dictionary must leave room in the window for the data");
+
+// Index of the window for the encoder, as in heatshrink. Each position links
+// back to the one before it holding the same byte, so only those are tried.
+static int16_t previous_position[DICTIONARY_SIZE + COMPRESS_MAX_LENGTH];
+static int16_t last_position[256];
+
+/* Private function prototypes -----------------------------------------------*/
+
+static inline uint8_t windowByte(const uint8_t* data, uint16_t position);
+static inline void indexPosition(const uint8_t* input, uint16_t position);
+static uint8_t matchLength(const uint8_t* input, uint16_t length, uint16_t index, uint16_t source);
+static bool putBits(BitWriter_t* writer, uint16_t value, uint8_t num_bits);
+static bool getBits(BitReader_t* reader, uint8_t num_bits, uint16_t* value);
+
+/* Exported function definitions ---------------------------------------------*/
+
+bool Compress_Encode(const uint8_t* input, uint16_t length, uint8_t* output, uint16_t max_output,
+                     uint16_t* output_length)
+{
+  if (input == NULL || output == NULL || output_length == NULL || length == 0 ||
+      length > COMPRESS_MAX_LENGTH || max_output == 0) {
+    return false;
+  }
+
+  output[0] = (uint8_t) (length - 1);
+  BitWriter_t writer = {.data = output, .bit = 8, .max_bits = 8u * max_output};
+
+  // Positions count from the start of the dictionary, the data follows it
+  for (uint16_t i = 0; i < 256; i++) {
+    last_position[i] = NO_POSITION;
+  }
+  for (uint16_t position = 0; position < DICTIONARY_SIZE; position++) {
+    indexPosition(input, position);
+  }
+
+  uint16_t index = 0;
+  while (index < length) {
+    uint16_t position = DICTIONARY_SIZE + index;
+    int16_t oldest = (position > WINDOW_SIZE) ? (int16_t) (position - WINDOW_SIZE) : 0;
+    uint8_t best_length = 0;
+    uint16_t best_source = 0;
+    for (int16_t source = last_position[input[index]]; source >= oldest;
+         source = previous_position[source]) {
+      // Only a source matching the byte after the best match so far can beat it
+      if (best_length > 0 && windowByte(input, source + best_length) != input[index + best_length]) {
+        continue;
+      }
+      uint8_t match = matchLength(input, length, index, source);
+      if (match > best_length) {
+        best_length = match;
+        best_source = source;
+        if (match == COMPRESS_MAX_MATCH || index + match == length) {
+          break;
+        }
+      }
+    }
+
+    bool written;
+    if (best_length >= COMPRESS_MIN_MATCH) {
+      written = putBits(&writer, !LITERAL_FLAG, 1) &&
+                putBits(&writer, position - best_source - 1, COMPRESS_OFFSET_BITS) &&
+                putBits(&writer, best_length - COMPRESS_MIN_MATCH, COMPRESS_LENGTH_BITS);
+    }
+    else {
+      best_length = 1;
+      written = putBits(&writer, LITERAL_FLAG, 1) && putBits(&writer, input[index], 8);
+    }
+    if (written == false) {
+      return false;
+    }
+    for (uint8_t i = 0; i < best_length; i++) {
+      indexPosition(input, DICTIONARY_SIZE + index++);
+    }
+  }
+
+  // Clears the padding of a partial last byte
+  if (writer.bit % 8 != 0) {
+    output[writer.bit / 8] &= (uint8_t) (0xFF << (8 - writer.bit % 8));
+  }
+  *output_length = (uint16_t) ((writer.bit + 7) / 8);
+  return true;
+}
+
+bool Compress_Decode(const uint8_t* input, uint16_t input_length, uint8_t* output, uint16_t max_output,
+                     uint16_t* output_length)
+{
+  if (input == NULL || output == NULL || output_length == NULL || input_length == 0) {
+    return false;
+  }
+
+  uint16_t length = (uint16_t) input[0] + 1;
+  if (length > max_output) {
+    return false;
+  }
+  BitReader_t reader = {.data = input, .bit = 8, .num_bits = 8u * input_length};
+
+  uint16_t index = 0;
+  while (index < length) {
+    uint16_t flag;
+    if (getBits(&reader, 1, &flag) == false) {
+      return false;
+    }
+
+    if (flag == LITERAL_FLAG) {
+      uint16_t literal;
+      if (getBits(&reader, 8, &literal) == false) {
+        return false;
+      }
+      output[index++] = (uint8_t) literal;
+      continue;
+    }
+
+    uint16_t offset;
+    uint16_t match;
+    if (getBits(&reader, COMPRESS_OFFSET_BITS, &offset) == false ||
+        getBits(&reader, COMPRESS_LENGTH_BITS, &match) == false) {
+      return false;
+    }
+    uint16_t position = DICTIONARY_SIZE + index;
+    offset += 1;
+    match += COMPRESS_MIN_MATCH;
+    if (offset > position || index + match > length) {
+      return false;
+    }
+
+    // Byte by byte, as a match can overlap the bytes it produces
+    uint16_t source = position - offset;
+    for (uint8_t i = 0; i < match; i++) {
+      output[index++] = windowByte(output, source++);
+    }
+  }
+
+  *output_length = length;
+  return true;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static inline uint8_t windowByte(const uint8_t* data, uint16_t position)
+{
+  if (position < DICTIONARY_SIZE) {
+    return (uint8_t) dictionary[position];
+  }
+  return data[position - DICTIONARY_SIZE];
+}
+
+static inline void indexPosition(const uint8_t* input, uint16_t position)
+{
+  uint8_t byte = windowByte(input, position);
+  previous_position[position] = last_position[byte];
+  last_position[byte] = (int16_t) position;
+}
+
+// Bytes from source matching the input from index on. The source may run
+// into the input being matched, the decoder will have produced it by then.
+static uint8_t matchLength(const uint8_t* input, uint16_t length, uint16_t index, uint16_t source)
+{
+  uint8_t match = 0;
+  while (match < COMPRESS_MAX_MATCH && index + match < length &&
+         windowByte(input, source + match) == input[index + match]) {
+    match++;
+  }
+  return match;
+}
+
+static bool putBits(BitWriter_t* writer, uint16_t value, uint8_t num_bits)
+{
+  if (writer->bit + num_bits > writer->max_bits) {
+    return false;
+  }
+
+  for (uint8_t i = num_bits; i-- > 0; ) {
+    uint8_t mask = 0x80 >> (writer->bit % 8);
+    if (((value >> i) & 1) != 0) {
+      writer->data[writer->bit / 8] |= mask;
+    }
+    else {
+      writer->data[writer->bit / 8] &= ~mask;
+    }
+    writer->bit++;
+  }
+  return true;
+}
+
+static bool getBits(BitReader_t* reader, uint8_t num_bits, uint16_t* value)
+{
+  if (reader->bit + num_bits > reader->num_bits) {
+    return false;
+  }
+
+  uint16_t bits = 0;
+  for (uint8_t i = 0; i < num_bits; i++) {
+    bits = (bits << 1) | ((reader->data[reader->bit / 8] >> (7 - reader->bit % 8)) & 1);
+    reader->bit++;
+  }
+  *value = bits;
+  return true;
+}
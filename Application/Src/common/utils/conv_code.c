@@ -0,0 +1,193 @@
+/*
+ * conv_code.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "conv_code.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+// Which of the two outputs of each step are sent, bit t of each mask for
+// step t of the period
+typedef struct {
+  uint8_t period;
+  uint8_t keep_first;
+  uint8_t keep_second;
+} Puncturing_t;
+
+/* Private define ------------------------------------------------------------*/
+
+#define NUM_STATES          (1 << CONV_CODE_TAIL_BITS)
+#define STATE_MASK          (NUM_STATES - 1)
+
+// The newest bit is the LSB of the 7 bit register, so the masks are the
+// octal generators with their bits reversed. 133 is sent first, as in
+// IEEE 802.11a. Both generators tap the newest and oldest bits, so the
+// outputs of the two branches into a state and of the two branches out of
+// one are complements of each other.
+#define GENERATOR_FIRST     0x6D  // 133 octal
+#define GENERATOR_SECOND    0x4F  // 171 octal
+
+#define UNREACHABLE_METRIC  (INT32_MIN / 2)
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static const Puncturing_t puncturing[NUM_CONV_CODE_RATES] = {
+  [CONV_CODE_RATE_1_2] = {.period = 1, .keep_first = 0x1, .keep_second = 0x1},
+  [CONV_CODE_RATE_2_3] = {.period = 2, .keep_first = 0x3, .keep_second = 0x1},
+  [CONV_CODE_RATE_3_4] = {.period = 3, .keep_first = 0x3, .keep_second = 0x5}
+};
+
+// Bit n of each word set where the survivor into state n came from the
+// upper half of the states
+static uint64_t decisions[CONV_CODE_MAX_INPUT_BITS + CONV_CODE_TAIL_BITS];
+
+/* Private function prototypes -----------------------------------------------*/
+
+static uint8_t branchOutput(uint8_t reg);
+static uint8_t parity(uint8_t value);
+
+/* Exported function definitions ---------------------------------------------*/
+
+uint16_t ConvCode_EncodedLength(uint16_t num_bits, ConvCodeRate_t rate)
+{
+  if (rate >= NUM_CONV_CODE_RATES) {
+    return 0;
+  }
+  const Puncturing_t* p = &puncturing[rate];
+  uint32_t steps = (uint32_t) num_bits + CONV_CODE_TAIL_BITS;
+  uint32_t kept_per_period = __builtin_popcount(p->keep_first) + __builtin_popcount(p->keep_second);
+  uint32_t length = steps / p->period * kept_per_period;
+  for (uint8_t t = 0; t < steps % p->period; t++) {
+    length += ((p->keep_first >> t) & 1) + ((p->keep_second >> t) & 1);
+  }
+  return (uint16_t) length;
+}
+
+bool ConvCode_Encode(const uint8_t* data, uint16_t num_bits, ConvCodeRate_t rate, uint8_t* coded)
+{
+  if (rate >= NUM_CONV_CODE_RATES) {
+    return false;
+  }
+  const Puncturing_t* p = &puncturing[rate];
+  memset(coded, 0, (ConvCode_EncodedLength(num_bits, rate) + 7) / 8);
+
+  uint8_t state = 0;
+  uint8_t phase = 0;
+  uint32_t out = 0;
+  for (uint32_t t = 0; t < (uint32_t) num_bits + CONV_CODE_TAIL_BITS; t++) {
+    uint8_t bit = (t < num_bits) ? (data[t / 8] >> (7 - t % 8)) & 1 : 0;
+    uint8_t reg = (uint8_t) ((state << 1) | bit);
+    uint8_t output = branchOutput(reg);
+    if ((p->keep_first >> phase) & 1) {
+      coded[out / 8] |= (output >> 1) << (7 - out % 8);
+      out++;
+    }
+    if ((p->keep_second >> phase) & 1) {
+      coded[out / 8] |= (output & 1) << (7 - out % 8);
+      out++;
+    }
+    state = reg & STATE_MASK;
+    phase = (phase + 1 == p->period) ? 0 : phase + 1;
+  }
+  return true;
+}
+
+bool ConvCode_Decode(const int8_t* llr, uint16_t num_bits, ConvCodeRate_t rate, uint8_t* data)
+{
+  if (rate >= NUM_CONV_CODE_RATES || num_bits > CONV_CODE_MAX_INPUT_BITS) {
+    return false;
+  }
+  const Puncturing_t* p = &puncturing[rate];
+
+  // Output of the branch from state i to state 2i, the first of each
+  // butterfly; the other three are it or its complement
+  uint8_t butterfly_output[NUM_STATES / 2];
+  for (uint8_t i = 0; i < NUM_STATES / 2; i++) {
+    butterfly_output[i] = branchOutput(2 * i);
+  }
+
+  int32_t metrics[2][NUM_STATES];
+  for (uint8_t s = 0; s < NUM_STATES; s++) {
+    metrics[0][s] = (s == 0) ? 0 : UNREACHABLE_METRIC;
+  }
+
+  const uint32_t steps = (uint32_t) num_bits + CONV_CODE_TAIL_BITS;
+  uint8_t phase = 0;
+  uint32_t in = 0;
+  for (uint32_t t = 0; t < steps; t++) {
+    // Correlation of the received ratios with each output pair, a punctured
+    // bit counting as neither
+    int32_t first = ((p->keep_first >> phase) & 1) ? llr[in++] : 0;
+    int32_t second = ((p->keep_second >> phase) & 1) ? llr[in++] : 0;
+    phase = (phase + 1 == p->period) ? 0 : phase + 1;
+    const int32_t branch_metric[4] = {-first - second, -first + second, first - second, first + second};
+
+    const int32_t* old_metrics = metrics[t & 1];
+    int32_t* new_metrics = metrics[(t + 1) & 1];
+    uint64_t decision = 0;
+    for (uint8_t i = 0; i < NUM_STATES / 2; i++) {
+      int32_t bm = branch_metric[butterfly_output[i]];
+      int32_t lower = old_metrics[i];
+      int32_t upper = old_metrics[i + NUM_STATES / 2];
+
+      int32_t from_lower = lower + bm;
+      int32_t from_upper = upper - bm;
+      if (from_upper > from_lower) {
+        new_metrics[2 * i] = from_upper;
+        decision |= (uint64_t) 1 << (2 * i);
+      }
+      else {
+        new_metrics[2 * i] = from_lower;
+      }
+
+      from_lower = lower - bm;
+      from_upper = upper + bm;
+      if (from_upper > from_lower) {
+        new_metrics[2 * i + 1] = from_upper;
+        decision |= (uint64_t) 1 << (2 * i + 1);
+      }
+      else {
+        new_metrics[2 * i + 1] = from_lower;
+      }
+    }
+    decisions[t] = decision;
+  }
+
+  // The tail leaves the encoder in state 0, trace the survivor back from it
+  memset(data, 0, (num_bits + 7) / 8);
+  uint8_t state = 0;
+  for (uint32_t t = steps; t-- > 0;) {
+    if (t < num_bits) {
+      data[t / 8] |= (state & 1) << (7 - t % 8);
+    }
+    uint8_t from_upper = (decisions[t] >> state) & 1;
+    state = (uint8_t) ((state >> 1) | (from_upper << (CONV_CODE_TAIL_BITS - 1)));
+  }
+  return true;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// The two outputs for a register value, the first in bit 1
+static uint8_t branchOutput(uint8_t reg)
+{
+  return (uint8_t) ((parity(reg & GENERATOR_FIRST) << 1) | parity(reg & GENERATOR_SECOND));
+}
+
+static uint8_t parity(uint8_t value)
+{
+  value ^= value >> 4;
+  value ^= value >> 2;
+  value ^= value >> 1;
+  return value & 1;
+}
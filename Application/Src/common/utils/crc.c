@@ -0,0 +1,585 @@
+/*
+ * crc.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "crc.h"
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define CRC8_POLYNOMIAL     0x07u
+#define CRC16_POLYNOMIAL    0x1021u
+#define CRC32_POLYNOMIAL    0x04C11DB7u
+
+#define CRC8_INIT           0x00u
+#define CRC16_INIT          0xFFFFu
+#define CRC32_INIT          0xFFFFFFFFu
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+// Entry i is the register after i, placed at the top of the word, has been
+// shifted through the polynomial MSB first
+#if CRC_NIBBLE_TABLES == 1
+
+static const uint8_t crc8_table[16] = {
+  0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D
+};
+
+static const uint16_t crc16_table[16] = {
+  0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+  0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu
+};
+
+static const uint32_t crc32_table[16] = {
+  0x00000000u, 0x04C11DB7u, 0x09823B6Eu, 0x0D4326D9u, 0x130476DCu, 0x17C56B6Bu, 0x1A864DB2u, 0x1E475005u,
+  0x2608EDB8u, 0x22C9F00Fu, 0x2F8AD6D6u, 0x2B4BCB61u, 0x350C9B64u, 0x31CD86D3u, 0x3C8EA00Au, 0x384FBDBDu
+};
+
+#else
+
+static const uint8_t crc8_table[256] = {
+  0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+  0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
+  0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+  0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
+  0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
+  0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+  0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
+  0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
+  0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+  0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
+  0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
+  0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+  0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
+  0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
+  0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+  0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
+};
+
+static const uint16_t crc16_table[256] = {
+  0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+  0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+  0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+  0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+  0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+  0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+  0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+  0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+  0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+  0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+  0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+  0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+  0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+  0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+  0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+  0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+  0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+  0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+  0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+  0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+  0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+  0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+  0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+  0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+  0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+  0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+  0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+  0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+  0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+  0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+  0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+  0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+};
+
+// Table k is a byte followed by k zero bytes, so the bytes of one slice can
+// all be looked up independently of each other
+static const uint32_t crc32_table[CRC32_SLICES][256] = {
+  {
+    0x00000000u, 0x04C11DB7u, 0x09823B6Eu, 0x0D4326D9u, 0x130476DCu, 0x17C56B6Bu,
+    0x1A864DB2u, 0x1E475005u, 0x2608EDB8u, 0x22C9F00Fu, 0x2F8AD6D6u, 0x2B4BCB61u,
+    0x350C9B64u, 0x31CD86D3u, 0x3C8EA00Au, 0x384FBDBDu, 0x4C11DB70u, 0x48D0C6C7u,
+    0x4593E01Eu, 0x4152FDA9u, 0x5F15ADACu, 0x5BD4B01Bu, 0x569796C2u, 0x52568B75u,
+    0x6A1936C8u, 0x6ED82B7Fu, 0x639B0DA6u, 0x675A1011u, 0x791D4014u, 0x7DDC5DA3u,
+    0x709F7B7Au, 0x745E66CDu, 0x9823B6E0u, 0x9CE2AB57u, 0x91A18D8Eu, 0x95609039u,
+    0x8B27C03Cu, 0x8FE6DD8Bu, 0x82A5FB52u, 0x8664E6E5u, 0xBE2B5B58u, 0xBAEA46EFu,
+    0xB7A96036u, 0xB3687D81u, 0xAD2F2D84u, 0xA9EE3033u, 0xA4AD16EAu, 0xA06C0B5Du,
+    0xD4326D90u, 0xD0F37027u, 0xDDB056FEu, 0xD9714B49u, 0xC7361B4Cu, 0xC3F706FBu,
+    0xCEB42022u, 0xCA753D95u, 0xF23A8028u, 0xF6FB9D9Fu, 0xFBB8BB46u, 0xFF79A6F1u,
+    0xE13EF6F4u, 0xE5FFEB43u, 0xE8BCCD9Au, 0xEC7DD02Du, 0x34867077u, 0x30476DC0u,
+    0x3D044B19u, 0x39C556AEu, 0x278206ABu, 0x23431B1Cu, 0x2E003DC5u, 0x2AC12072u,
+    0x128E9DCFu, 0x164F8078u, 0x1B0CA6A1u, 0x1FCDBB16u, 0x018AEB13u, 0x054BF6A4u,
+    0x0808D07Du, 0x0CC9CDCAu, 0x7897AB07u, 0x7C56B6B0u, 0x71159069u, 0x75D48DDEu,
+    0x6B93DDDBu, 0x6F52C06Cu, 0x6211E6B5u, 0x66D0FB02u, 0x5E9F46BFu, 0x5A5E5B08u,
+    0x571D7DD1u, 0x53DC6066u, 0x4D9B3063u, 0x495A2DD4u, 0x44190B0Du, 0x40D816BAu,
+    0xACA5C697u, 0xA864DB20u, 0xA527FDF9u, 0xA1E6E04Eu, 0xBFA1B04Bu, 0xBB60ADFCu,
+    0xB6238B25u, 0xB2E29692u, 0x8AAD2B2Fu, 0x8E6C3698u, 0x832F1041u, 0x87EE0DF6u,
+    0x99A95DF3u, 0x9D684044u, 0x902B669Du, 0x94EA7B2Au, 0xE0B41DE7u, 0xE4750050u,
+    0xE9362689u, 0xEDF73B3Eu, 0xF3B06B3Bu, 0xF771768Cu, 0xFA325055u, 0xFEF34DE2u,
+    0xC6BCF05Fu, 0xC27DEDE8u, 0xCF3ECB31u, 0xCBFFD686u, 0xD5B88683u, 0xD1799B34u,
+    0xDC3ABDEDu, 0xD8FBA05Au, 0x690CE0EEu, 0x6DCDFD59u, 0x608EDB80u, 0x644FC637u,
+    0x7A089632u, 0x7EC98B85u, 0x738AAD5Cu, 0x774BB0EBu, 0x4F040D56u, 0x4BC510E1u,
+    0x46863638u, 0x42472B8Fu, 0x5C007B8Au, 0x58C1663Du, 0x558240E4u, 0x51435D53u,
+    0x251D3B9Eu, 0x21DC2629u, 0x2C9F00F0u, 0x285E1D47u, 0x36194D42u, 0x32D850F5u,
+    0x3F9B762Cu, 0x3B5A6B9Bu, 0x0315D626u, 0x07D4CB91u, 0x0A97ED48u, 0x0E56F0FFu,
+    0x1011A0FAu, 0x14D0BD4Du, 0x19939B94u, 0x1D528623u, 0xF12F560Eu, 0xF5EE4BB9u,
+    0xF8AD6D60u, 0xFC6C70D7u, 0xE22B20D2u, 0xE6EA3D65u, 0xEBA91BBCu, 0xEF68060Bu,
+    0xD727BBB6u, 0xD3E6A601u, 0xDEA580D8u, 0xDA649D6Fu, 0xC423CD6Au, 0xC0E2D0DDu,
+    0xCDA1F604u, 0xC960EBB3u, 0xBD3E8D7Eu, 0xB9FF90C9u, 0xB4BCB610u, 0xB07DABA7u,
+    0xAE3AFBA2u, 0xAAFBE615u, 0xA7B8C0CCu, 0xA379DD7Bu, 0x9B3660C6u, 0x9FF77D71u,
+    0x92B45BA8u, 0x9675461Fu, 0x8832161Au, 0x8CF30BADu, 0x81B02D74u, 0x857130C3u,
+    0x5D8A9099u, 0x594B8D2Eu, 0x5408ABF7u, 0x50C9B640u, 0x4E8EE645u, 0x4A4FFBF2u,
+    0x470CDD2Bu, 0x43CDC09Cu, 0x7B827D21u, 0x7F436096u, 0x7200464Fu, 0x76C15BF8u,
+    0x68860BFDu, 0x6C47164Au, 0x61043093u, 0x65C52D24u, 0x119B4BE9u, 0x155A565Eu,
+    0x18197087u, 0x1CD86D30u, 0x029F3D35u, 0x065E2082u, 0x0B1D065Bu, 0x0FDC1BECu,
+    0x3793A651u, 0x3352BBE6u, 0x3E119D3Fu, 0x3AD08088u, 0x2497D08Du, 0x2056CD3Au,
+    0x2D15EBE3u, 0x29D4F654u, 0xC5A92679u, 0xC1683BCEu, 0xCC2B1D17u, 0xC8EA00A0u,
+    0xD6AD50A5u, 0xD26C4D12u, 0xDF2F6BCBu, 0xDBEE767Cu, 0xE3A1CBC1u, 0xE760D676u,
+    0xEA23F0AFu, 0xEEE2ED18u, 0xF0A5BD1Du, 0xF464A0AAu, 0xF9278673u, 0xFDE69BC4u,
+    0x89B8FD09u, 0x8D79E0BEu, 0x803AC667u, 0x84FBDBD0u, 0x9ABC8BD5u, 0x9E7D9662u,
+    0x933EB0BBu, 0x97FFAD0Cu, 0xAFB010B1u, 0xAB710D06u, 0xA6322BDFu, 0xA2F33668u,
+    0xBCB4666Du, 0xB8757BDAu, 0xB5365D03u, 0xB1F740B4u
+  }
+#if CRC32_SLICES >= 4
+  ,
+  {
+    0x00000000u, 0xD219C1DCu, 0xA0F29E0Fu, 0x72EB5FD3u, 0x452421A9u, 0x973DE075u,
+    0xE5D6BFA6u, 0x37CF7E7Au, 0x8A484352u, 0x5851828Eu, 0x2ABADD5Du, 0xF8A31C81u,
+    0xCF6C62FBu, 0x1D75A327u, 0x6F9EFCF4u, 0xBD873D28u, 0x10519B13u, 0xC2485ACFu,
+    0xB0A3051Cu, 0x62BAC4C0u, 0x5575BABAu, 0x876C7B66u, 0xF58724B5u, 0x279EE569u,
+    0x9A19D841u, 0x4800199Du, 0x3AEB464Eu, 0xE8F28792u, 0xDF3DF9E8u, 0x0D243834u,
+    0x7FCF67E7u, 0xADD6A63Bu, 0x20A33626u, 0xF2BAF7FAu, 0x8051A829u, 0x524869F5u,
+    0x6587178Fu, 0xB79ED653u, 0xC5758980u, 0x176C485Cu, 0xAAEB7574u, 0x78F2B4A8u,
+    0x0A19EB7Bu, 0xD8002AA7u, 0xEFCF54DDu, 0x3DD69501u, 0x4F3DCAD2u, 0x9D240B0Eu,
+    0x30F2AD35u, 0xE2EB6CE9u, 0x9000333Au, 0x4219F2E6u, 0x75D68C9Cu, 0xA7CF4D40u,
+    0xD5241293u, 0x073DD34Fu, 0xBABAEE67u, 0x68A32FBBu, 0x1A487068u, 0xC851B1B4u,
+    0xFF9ECFCEu, 0x2D870E12u, 0x5F6C51C1u, 0x8D75901Du, 0x41466C4Cu, 0x935FAD90u,
+    0xE1B4F243u, 0x33AD339Fu, 0x04624DE5u, 0xD67B8C39u, 0xA490D3EAu, 0x76891236u,
+    0xCB0E2F1Eu, 0x1917EEC2u, 0x6BFCB111u, 0xB9E570CDu, 0x8E2A0EB7u, 0x5C33CF6Bu,
+    0x2ED890B8u, 0xFCC15164u, 0x5117F75Fu, 0x830E3683u, 0xF1E56950u, 0x23FCA88Cu,
+    0x1433D6F6u, 0xC62A172Au, 0xB4C148F9u, 0x66D88925u, 0xDB5FB40Du, 0x094675D1u,
+    0x7BAD2A02u, 0xA9B4EBDEu, 0x9E7B95A4u, 0x4C625478u, 0x3E890BABu, 0xEC90CA77u,
+    0x61E55A6Au, 0xB3FC9BB6u, 0xC117C465u, 0x130E05B9u, 0x24C17BC3u, 0xF6D8BA1Fu,
+    0x8433E5CCu, 0x562A2410u, 0xEBAD1938u, 0x39B4D8E4u, 0x4B5F8737u, 0x994646EBu,
+    0xAE893891u, 0x7C90F94Du, 0x0E7BA69Eu, 0xDC626742u, 0x71B4C179u, 0xA3AD00A5u,
+    0xD1465F76u, 0x035F9EAAu, 0x3490E0D0u, 0xE689210Cu, 0x94627EDFu, 0x467BBF03u,
+    0xFBFC822Bu, 0x29E543F7u, 0x5B0E1C24u, 0x8917DDF8u, 0xBED8A382u, 0x6CC1625Eu,
+    0x1E2A3D8Du, 0xCC33FC51u, 0x828CD898u, 0x50951944u, 0x227E4697u, 0xF067874Bu,
+    0xC7A8F931u, 0x15B138EDu, 0x675A673Eu, 0xB543A6E2u, 0x08C49BCAu, 0xDADD5A16u,
+    0xA83605C5u, 0x7A2FC419u, 0x4DE0BA63u, 0x9FF97BBFu, 0xED12246Cu, 0x3F0BE5B0u,
+    0x92DD438Bu, 0x40C48257u, 0x322FDD84u, 0xE0361C58u, 0xD7F96222u, 0x05E0A3FEu,
+    0x770BFC2Du, 0xA5123DF1u, 0x189500D9u, 0xCA8CC105u, 0xB8679ED6u, 0x6A7E5F0Au,
+    0x5DB12170u, 0x8FA8E0ACu, 0xFD43BF7Fu, 0x2F5A7EA3u, 0xA22FEEBEu, 0x70362F62u,
+    0x02DD70B1u, 0xD0C4B16Du, 0xE70BCF17u, 0x35120ECBu, 0x47F95118u, 0x95E090C4u,
+    0x2867ADECu, 0xFA7E6C30u, 0x889533E3u, 0x5A8CF23Fu, 0x6D438C45u, 0xBF5A4D99u,
+    0xCDB1124Au, 0x1FA8D396u, 0xB27E75ADu, 0x6067B471u, 0x128CEBA2u, 0xC0952A7Eu,
+    0xF75A5404u, 0x254395D8u, 0x57A8CA0Bu, 0x85B10BD7u, 0x383636FFu, 0xEA2FF723u,
+    0x98C4A8F0u, 0x4ADD692Cu, 0x7D121756u, 0xAF0BD68Au, 0xDDE08959u, 0x0FF94885u,
+    0xC3CAB4D4u, 0x11D37508u, 0x63382ADBu, 0xB121EB07u, 0x86EE957Du, 0x54F754A1u,
+    0x261C0B72u, 0xF405CAAEu, 0x4982F786u, 0x9B9B365Au, 0xE9706989u, 0x3B69A855u,
+    0x0CA6D62Fu, 0xDEBF17F3u, 0xAC544820u, 0x7E4D89FCu, 0xD39B2FC7u, 0x0182EE1Bu,
+    0x7369B1C8u, 0xA1707014u, 0x96BF0E6Eu, 0x44A6CFB2u, 0x364D9061u, 0xE45451BDu,
+    0x59D36C95u, 0x8BCAAD49u, 0xF921F29Au, 0x2B383346u, 0x1CF74D3Cu, 0xCEEE8CE0u,
+    0xBC05D333u, 0x6E1C12EFu, 0xE36982F2u, 0x3170432Eu, 0x439B1CFDu, 0x9182DD21u,
+    0xA64DA35Bu, 0x74546287u, 0x06BF3D54u, 0xD4A6FC88u, 0x6921C1A0u, 0xBB38007Cu,
+    0xC9D35FAFu, 0x1BCA9E73u, 0x2C05E009u, 0xFE1C21D5u, 0x8CF77E06u, 0x5EEEBFDAu,
+    0xF33819E1u, 0x2121D83Du, 0x53CA87EEu, 0x81D34632u, 0xB61C3848u, 0x6405F994u,
+    0x16EEA647u, 0xC4F7679Bu, 0x79705AB3u, 0xAB699B6Fu, 0xD982C4BCu, 0x0B9B0560u,
+    0x3C547B1Au, 0xEE4DBAC6u, 0x9CA6E515u, 0x4EBF24C9u
+  },
+  {
+    0x00000000u, 0x01D8AC87u, 0x03B1590Eu, 0x0269F589u, 0x0762B21Cu, 0x06BA1E9Bu,
+    0x04D3EB12u, 0x050B4795u, 0x0EC56438u, 0x0F1DC8BFu, 0x0D743D36u, 0x0CAC91B1u,
+    0x09A7D624u, 0x087F7AA3u, 0x0A168F2Au, 0x0BCE23ADu, 0x1D8AC870u, 0x1C5264F7u,
+    0x1E3B917Eu, 0x1FE33DF9u, 0x1AE87A6Cu, 0x1B30D6EBu, 0x19592362u, 0x18818FE5u,
+    0x134FAC48u, 0x129700CFu, 0x10FEF546u, 0x112659C1u, 0x142D1E54u, 0x15F5B2D3u,
+    0x179C475Au, 0x1644EBDDu, 0x3B1590E0u, 0x3ACD3C67u, 0x38A4C9EEu, 0x397C6569u,
+    0x3C7722FCu, 0x3DAF8E7Bu, 0x3FC67BF2u, 0x3E1ED775u, 0x35D0F4D8u, 0x3408585Fu,
+    0x3661ADD6u, 0x37B90151u, 0x32B246C4u, 0x336AEA43u, 0x31031FCAu, 0x30DBB34Du,
+    0x269F5890u, 0x2747F417u, 0x252E019Eu, 0x24F6AD19u, 0x21FDEA8Cu, 0x2025460Bu,
+    0x224CB382u, 0x23941F05u, 0x285A3CA8u, 0x2982902Fu, 0x2BEB65A6u, 0x2A33C921u,
+    0x2F388EB4u, 0x2EE02233u, 0x2C89D7BAu, 0x2D517B3Du, 0x762B21C0u, 0x77F38D47u,
+    0x759A78CEu, 0x7442D449u, 0x714993DCu, 0x70913F5Bu, 0x72F8CAD2u, 0x73206655u,
+    0x78EE45F8u, 0x7936E97Fu, 0x7B5F1CF6u, 0x7A87B071u, 0x7F8CF7E4u, 0x7E545B63u,
+    0x7C3DAEEAu, 0x7DE5026Du, 0x6BA1E9B0u, 0x6A794537u, 0x6810B0BEu, 0x69C81C39u,
+    0x6CC35BACu, 0x6D1BF72Bu, 0x6F7202A2u, 0x6EAAAE25u, 0x65648D88u, 0x64BC210Fu,
+    0x66D5D486u, 0x670D7801u, 0x62063F94u, 0x63DE9313u, 0x61B7669Au, 0x606FCA1Du,
+    0x4D3EB120u, 0x4CE61DA7u, 0x4E8FE82Eu, 0x4F5744A9u, 0x4A5C033Cu, 0x4B84AFBBu,
+    0x49ED5A32u, 0x4835F6B5u, 0x43FBD518u, 0x4223799Fu, 0x404A8C16u, 0x41922091u,
+    0x44996704u, 0x4541CB83u, 0x47283E0Au, 0x46F0928Du, 0x50B47950u, 0x516CD5D7u,
+    0x5305205Eu, 0x52DD8CD9u, 0x57D6CB4Cu, 0x560E67CBu, 0x54679242u, 0x55BF3EC5u,
+    0x5E711D68u, 0x5FA9B1EFu, 0x5DC04466u, 0x5C18E8E1u, 0x5913AF74u, 0x58CB03F3u,
+    0x5AA2F67Au, 0x5B7A5AFDu, 0xEC564380u, 0xED8EEF07u, 0xEFE71A8Eu, 0xEE3FB609u,
+    0xEB34F19Cu, 0xEAEC5D1Bu, 0xE885A892u, 0xE95D0415u, 0xE29327B8u, 0xE34B8B3Fu,
+    0xE1227EB6u, 0xE0FAD231u, 0xE5F195A4u, 0xE4293923u, 0xE640CCAAu, 0xE798602Du,
+    0xF1DC8BF0u, 0xF0042777u, 0xF26DD2FEu, 0xF3B57E79u, 0xF6BE39ECu, 0xF766956Bu,
+    0xF50F60E2u, 0xF4D7CC65u, 0xFF19EFC8u, 0xFEC1434Fu, 0xFCA8B6C6u, 0xFD701A41u,
+    0xF87B5DD4u, 0xF9A3F153u, 0xFBCA04DAu, 0xFA12A85Du, 0xD743D360u, 0xD69B7FE7u,
+    0xD4F28A6Eu, 0xD52A26E9u, 0xD021617Cu, 0xD1F9CDFBu, 0xD3903872u, 0xD24894F5u,
+    0xD986B758u, 0xD85E1BDFu, 0xDA37EE56u, 0xDBEF42D1u, 0xDEE40544u, 0xDF3CA9C3u,
+    0xDD555C4Au, 0xDC8DF0CDu, 0xCAC91B10u, 0xCB11B797u, 0xC978421Eu, 0xC8A0EE99u,
+    0xCDABA90Cu, 0xCC73058Bu, 0xCE1AF002u, 0xCFC25C85u, 0xC40C7F28u, 0xC5D4D3AFu,
+    0xC7BD2626u, 0xC6658AA1u, 0xC36ECD34u, 0xC2B661B3u, 0xC0DF943Au, 0xC10738BDu,
+    0x9A7D6240u, 0x9BA5CEC7u, 0x99CC3B4Eu, 0x981497C9u, 0x9D1FD05Cu, 0x9CC77CDBu,
+    0x9EAE8952u, 0x9F7625D5u, 0x94B80678u, 0x9560AAFFu, 0x97095F76u, 0x96D1F3F1u,
+    0x93DAB464u, 0x920218E3u, 0x906BED6Au, 0x91B341EDu, 0x87F7AA30u, 0x862F06B7u,
+    0x8446F33Eu, 0x859E5FB9u, 0x8095182Cu, 0x814DB4ABu, 0x83244122u, 0x82FCEDA5u,
+    0x8932CE08u, 0x88EA628Fu, 0x8A839706u, 0x8B5B3B81u, 0x8E507C14u, 0x8F88D093u,
+    0x8DE1251Au, 0x8C39899Du, 0xA168F2A0u, 0xA0B05E27u, 0xA2D9ABAEu, 0xA3010729u,
+    0xA60A40BCu, 0xA7D2EC3Bu, 0xA5BB19B2u, 0xA463B535u, 0xAFAD9698u, 0xAE753A1Fu,
+    0xAC1CCF96u, 0xADC46311u, 0xA8CF2484u, 0xA9178803u, 0xAB7E7D8Au, 0xAAA6D10Du,
+    0xBCE23AD0u, 0xBD3A9657u, 0xBF5363DEu, 0xBE8BCF59u, 0xBB8088CCu, 0xBA58244Bu,
+    0xB831D1C2u, 0xB9E97D45u, 0xB2275EE8u, 0xB3FFF26Fu, 0xB19607E6u, 0xB04EAB61u,
+    0xB545ECF4u, 0xB49D4073u, 0xB6F4B5FAu, 0xB72C197Du
+  },
+  {
+    0x00000000u, 0xDC6D9AB7u, 0xBC1A28D9u, 0x6077B26Eu, 0x7CF54C05u, 0xA098D6B2u,
+    0xC0EF64DCu, 0x1C82FE6Bu, 0xF9EA980Au, 0x258702BDu, 0x45F0B0D3u, 0x999D2A64u,
+    0x851FD40Fu, 0x59724EB8u, 0x3905FCD6u, 0xE5686661u, 0xF7142DA3u, 0x2B79B714u,
+    0x4B0E057Au, 0x97639FCDu, 0x8BE161A6u, 0x578CFB11u, 0x37FB497Fu, 0xEB96D3C8u,
+    0x0EFEB5A9u, 0xD2932F1Eu, 0xB2E49D70u, 0x6E8907C7u, 0x720BF9ACu, 0xAE66631Bu,
+    0xCE11D175u, 0x127C4BC2u, 0xEAE946F1u, 0x3684DC46u, 0x56F36E28u, 0x8A9EF49Fu,
+    0x961C0AF4u, 0x4A719043u, 0x2A06222Du, 0xF66BB89Au, 0x1303DEFBu, 0xCF6E444Cu,
+    0xAF19F622u, 0x73746C95u, 0x6FF692FEu, 0xB39B0849u, 0xD3ECBA27u, 0x0F812090u,
+    0x1DFD6B52u, 0xC190F1E5u, 0xA1E7438Bu, 0x7D8AD93Cu, 0x61082757u, 0xBD65BDE0u,
+    0xDD120F8Eu, 0x017F9539u, 0xE417F358u, 0x387A69EFu, 0x580DDB81u, 0x84604136u,
+    0x98E2BF5Du, 0x448F25EAu, 0x24F89784u, 0xF8950D33u, 0xD1139055u, 0x0D7E0AE2u,
+    0x6D09B88Cu, 0xB164223Bu, 0xADE6DC50u, 0x718B46E7u, 0x11FCF489u, 0xCD916E3Eu,
+    0x28F9085Fu, 0xF49492E8u, 0x94E32086u, 0x488EBA31u, 0x540C445Au, 0x8861DEEDu,
+    0xE8166C83u, 0x347BF634u, 0x2607BDF6u, 0xFA6A2741u, 0x9A1D952Fu, 0x46700F98u,
+    0x5AF2F1F3u, 0x869F6B44u, 0xE6E8D92Au, 0x3A85439Du, 0xDFED25FCu, 0x0380BF4Bu,
+    0x63F70D25u, 0xBF9A9792u, 0xA31869F9u, 0x7F75F34Eu, 0x1F024120u, 0xC36FDB97u,
+    0x3BFAD6A4u, 0xE7974C13u, 0x87E0FE7Du, 0x5B8D64CAu, 0x470F9AA1u, 0x9B620016u,
+    0xFB15B278u, 0x277828CFu, 0xC2104EAEu, 0x1E7DD419u, 0x7E0A6677u, 0xA267FCC0u,
+    0xBEE502ABu, 0x6288981Cu, 0x02FF2A72u, 0xDE92B0C5u, 0xCCEEFB07u, 0x108361B0u,
+    0x70F4D3DEu, 0xAC994969u, 0xB01BB702u, 0x6C762DB5u, 0x0C019FDBu, 0xD06C056Cu,
+    0x3504630Du, 0xE969F9BAu, 0x891E4BD4u, 0x5573D163u, 0x49F12F08u, 0x959CB5BFu,
+    0xF5EB07D1u, 0x29869D66u, 0xA6E63D1Du, 0x7A8BA7AAu, 0x1AFC15C4u, 0xC6918F73u,
+    0xDA137118u, 0x067EEBAFu, 0x660959C1u, 0xBA64C376u, 0x5F0CA517u, 0x83613FA0u,
+    0xE3168DCEu, 0x3F7B1779u, 0x23F9E912u, 0xFF9473A5u, 0x9FE3C1CBu, 0x438E5B7Cu,
+    0x51F210BEu, 0x8D9F8A09u, 0xEDE83867u, 0x3185A2D0u, 0x2D075CBBu, 0xF16AC60Cu,
+    0x911D7462u, 0x4D70EED5u, 0xA81888B4u, 0x74751203u, 0x1402A06Du, 0xC86F3ADAu,
+    0xD4EDC4B1u, 0x08805E06u, 0x68F7EC68u, 0xB49A76DFu, 0x4C0F7BECu, 0x9062E15Bu,
+    0xF0155335u, 0x2C78C982u, 0x30FA37E9u, 0xEC97AD5Eu, 0x8CE01F30u, 0x508D8587u,
+    0xB5E5E3E6u, 0x69887951u, 0x09FFCB3Fu, 0xD5925188u, 0xC910AFE3u, 0x157D3554u,
+    0x750A873Au, 0xA9671D8Du, 0xBB1B564Fu, 0x6776CCF8u, 0x07017E96u, 0xDB6CE421u,
+    0xC7EE1A4Au, 0x1B8380FDu, 0x7BF43293u, 0xA799A824u, 0x42F1CE45u, 0x9E9C54F2u,
+    0xFEEBE69Cu, 0x22867C2Bu, 0x3E048240u, 0xE26918F7u, 0x821EAA99u, 0x5E73302Eu,
+    0x77F5AD48u, 0xAB9837FFu, 0xCBEF8591u, 0x17821F26u, 0x0B00E14Du, 0xD76D7BFAu,
+    0xB71AC994u, 0x6B775323u, 0x8E1F3542u, 0x5272AFF5u, 0x32051D9Bu, 0xEE68872Cu,
+    0xF2EA7947u, 0x2E87E3F0u, 0x4EF0519Eu, 0x929DCB29u, 0x80E180EBu, 0x5C8C1A5Cu,
+    0x3CFBA832u, 0xE0963285u, 0xFC14CCEEu, 0x20795659u, 0x400EE437u, 0x9C637E80u,
+    0x790B18E1u, 0xA5668256u, 0xC5113038u, 0x197CAA8Fu, 0x05FE54E4u, 0xD993CE53u,
+    0xB9E47C3Du, 0x6589E68Au, 0x9D1CEBB9u, 0x4171710Eu, 0x2106C360u, 0xFD6B59D7u,
+    0xE1E9A7BCu, 0x3D843D0Bu, 0x5DF38F65u, 0x819E15D2u, 0x64F673B3u, 0xB89BE904u,
+    0xD8EC5B6Au, 0x0481C1DDu, 0x18033FB6u, 0xC46EA501u, 0xA419176Fu, 0x78748DD8u,
+    0x6A08C61Au, 0xB6655CADu, 0xD612EEC3u, 0x0A7F7474u, 0x16FD8A1Fu, 0xCA9010A8u,
+    0xAAE7A2C6u, 0x768A3871u, 0x93E25E10u, 0x4F8FC4A7u, 0x2FF876C9u, 0xF395EC7Eu,
+    0xEF171215u, 0x337A88A2u, 0x530D3ACCu, 0x8F60A07Bu
+  }
+#endif
+#if CRC32_SLICES == 8
+  ,
+  {
+    0x00000000u, 0x490D678Du, 0x921ACF1Au, 0xDB17A897u, 0x20F48383u, 0x69F9E40Eu,
+    0xB2EE4C99u, 0xFBE32B14u, 0x41E90706u, 0x08E4608Bu, 0xD3F3C81Cu, 0x9AFEAF91u,
+    0x611D8485u, 0x2810E308u, 0xF3074B9Fu, 0xBA0A2C12u, 0x83D20E0Cu, 0xCADF6981u,
+    0x11C8C116u, 0x58C5A69Bu, 0xA3268D8Fu, 0xEA2BEA02u, 0x313C4295u, 0x78312518u,
+    0xC23B090Au, 0x8B366E87u, 0x5021C610u, 0x192CA19Du, 0xE2CF8A89u, 0xABC2ED04u,
+    0x70D54593u, 0x39D8221Eu, 0x036501AFu, 0x4A686622u, 0x917FCEB5u, 0xD872A938u,
+    0x2391822Cu, 0x6A9CE5A1u, 0xB18B4D36u, 0xF8862ABBu, 0x428C06A9u, 0x0B816124u,
+    0xD096C9B3u, 0x999BAE3Eu, 0x6278852Au, 0x2B75E2A7u, 0xF0624A30u, 0xB96F2DBDu,
+    0x80B70FA3u, 0xC9BA682Eu, 0x12ADC0B9u, 0x5BA0A734u, 0xA0438C20u, 0xE94EEBADu,
+    0x3259433Au, 0x7B5424B7u, 0xC15E08A5u, 0x88536F28u, 0x5344C7BFu, 0x1A49A032u,
+    0xE1AA8B26u, 0xA8A7ECABu, 0x73B0443Cu, 0x3ABD23B1u, 0x06CA035Eu, 0x4FC764D3u,
+    0x94D0CC44u, 0xDDDDABC9u, 0x263E80DDu, 0x6F33E750u, 0xB4244FC7u, 0xFD29284Au,
+    0x47230458u, 0x0E2E63D5u, 0xD539CB42u, 0x9C34ACCFu, 0x67D787DBu, 0x2EDAE056u,
+    0xF5CD48C1u, 0xBCC02F4Cu, 0x85180D52u, 0xCC156ADFu, 0x1702C248u, 0x5E0FA5C5u,
+    0xA5EC8ED1u, 0xECE1E95Cu, 0x37F641CBu, 0x7EFB2646u, 0xC4F10A54u, 0x8DFC6DD9u,
+    0x56EBC54Eu, 0x1FE6A2C3u, 0xE40589D7u, 0xAD08EE5Au, 0x761F46CDu, 0x3F122140u,
+    0x05AF02F1u, 0x4CA2657Cu, 0x97B5CDEBu, 0xDEB8AA66u, 0x255B8172u, 0x6C56E6FFu,
+    0xB7414E68u, 0xFE4C29E5u, 0x444605F7u, 0x0D4B627Au, 0xD65CCAEDu, 0x9F51AD60u,
+    0x64B28674u, 0x2DBFE1F9u, 0xF6A8496Eu, 0xBFA52EE3u, 0x867D0CFDu, 0xCF706B70u,
+    0x1467C3E7u, 0x5D6AA46Au, 0xA6898F7Eu, 0xEF84E8F3u, 0x34934064u, 0x7D9E27E9u,
+    0xC7940BFBu, 0x8E996C76u, 0x558EC4E1u, 0x1C83A36Cu, 0xE7608878u, 0xAE6DEFF5u,
+    0x757A4762u, 0x3C7720EFu, 0x0D9406BCu, 0x44996131u, 0x9F8EC9A6u, 0xD683AE2Bu,
+    0x2D60853Fu, 0x646DE2B2u, 0xBF7A4A25u, 0xF6772DA8u, 0x4C7D01BAu, 0x05706637u,
+    0xDE67CEA0u, 0x976AA92Du, 0x6C898239u, 0x2584E5B4u, 0xFE934D23u, 0xB79E2AAEu,
+    0x8E4608B0u, 0xC74B6F3Du, 0x1C5CC7AAu, 0x5551A027u, 0xAEB28B33u, 0xE7BFECBEu,
+    0x3CA84429u, 0x75A523A4u, 0xCFAF0FB6u, 0x86A2683Bu, 0x5DB5C0ACu, 0x14B8A721u,
+    0xEF5B8C35u, 0xA656EBB8u, 0x7D41432Fu, 0x344C24A2u, 0x0EF10713u, 0x47FC609Eu,
+    0x9CEBC809u, 0xD5E6AF84u, 0x2E058490u, 0x6708E31Du, 0xBC1F4B8Au, 0xF5122C07u,
+    0x4F180015u, 0x06156798u, 0xDD02CF0Fu, 0x940FA882u, 0x6FEC8396u, 0x26E1E41Bu,
+    0xFDF64C8Cu, 0xB4FB2B01u, 0x8D23091Fu, 0xC42E6E92u, 0x1F39C605u, 0x5634A188u,
+    0xADD78A9Cu, 0xE4DAED11u, 0x3FCD4586u, 0x76C0220Bu, 0xCCCA0E19u, 0x85C76994u,
+    0x5ED0C103u, 0x17DDA68Eu, 0xEC3E8D9Au, 0xA533EA17u, 0x7E244280u, 0x3729250Du,
+    0x0B5E05E2u, 0x4253626Fu, 0x9944CAF8u, 0xD049AD75u, 0x2BAA8661u, 0x62A7E1ECu,
+    0xB9B0497Bu, 0xF0BD2EF6u, 0x4AB702E4u, 0x03BA6569u, 0xD8ADCDFEu, 0x91A0AA73u,
+    0x6A438167u, 0x234EE6EAu, 0xF8594E7Du, 0xB15429F0u, 0x888C0BEEu, 0xC1816C63u,
+    0x1A96C4F4u, 0x539BA379u, 0xA878886Du, 0xE175EFE0u, 0x3A624777u, 0x736F20FAu,
+    0xC9650CE8u, 0x80686B65u, 0x5B7FC3F2u, 0x1272A47Fu, 0xE9918F6Bu, 0xA09CE8E6u,
+    0x7B8B4071u, 0x328627FCu, 0x083B044Du, 0x413663C0u, 0x9A21CB57u, 0xD32CACDAu,
+    0x28CF87CEu, 0x61C2E043u, 0xBAD548D4u, 0xF3D82F59u, 0x49D2034Bu, 0x00DF64C6u,
+    0xDBC8CC51u, 0x92C5ABDCu, 0x692680C8u, 0x202BE745u, 0xFB3C4FD2u, 0xB231285Fu,
+    0x8BE90A41u, 0xC2E46DCCu, 0x19F3C55Bu, 0x50FEA2D6u, 0xAB1D89C2u, 0xE210EE4Fu,
+    0x390746D8u, 0x700A2155u, 0xCA000D47u, 0x830D6ACAu, 0x581AC25Du, 0x1117A5D0u,
+    0xEAF48EC4u, 0xA3F9E949u, 0x78EE41DEu, 0x31E32653u
+  },
+  {
+    0x00000000u, 0x1B280D78u, 0x36501AF0u, 0x2D781788u, 0x6CA035E0u, 0x77883898u,
+    0x5AF02F10u, 0x41D82268u, 0xD9406BC0u, 0xC26866B8u, 0xEF107130u, 0xF4387C48u,
+    0xB5E05E20u, 0xAEC85358u, 0x83B044D0u, 0x989849A8u, 0xB641CA37u, 0xAD69C74Fu,
+    0x8011D0C7u, 0x9B39DDBFu, 0xDAE1FFD7u, 0xC1C9F2AFu, 0xECB1E527u, 0xF799E85Fu,
+    0x6F01A1F7u, 0x7429AC8Fu, 0x5951BB07u, 0x4279B67Fu, 0x03A19417u, 0x1889996Fu,
+    0x35F18EE7u, 0x2ED9839Fu, 0x684289D9u, 0x736A84A1u, 0x5E129329u, 0x453A9E51u,
+    0x04E2BC39u, 0x1FCAB141u, 0x32B2A6C9u, 0x299AABB1u, 0xB102E219u, 0xAA2AEF61u,
+    0x8752F8E9u, 0x9C7AF591u, 0xDDA2D7F9u, 0xC68ADA81u, 0xEBF2CD09u, 0xF0DAC071u,
+    0xDE0343EEu, 0xC52B4E96u, 0xE853591Eu, 0xF37B5466u, 0xB2A3760Eu, 0xA98B7B76u,
+    0x84F36CFEu, 0x9FDB6186u, 0x0743282Eu, 0x1C6B2556u, 0x311332DEu, 0x2A3B3FA6u,
+    0x6BE31DCEu, 0x70CB10B6u, 0x5DB3073Eu, 0x469B0A46u, 0xD08513B2u, 0xCBAD1ECAu,
+    0xE6D50942u, 0xFDFD043Au, 0xBC252652u, 0xA70D2B2Au, 0x8A753CA2u, 0x915D31DAu,
+    0x09C57872u, 0x12ED750Au, 0x3F956282u, 0x24BD6FFAu, 0x65654D92u, 0x7E4D40EAu,
+    0x53355762u, 0x481D5A1Au, 0x66C4D985u, 0x7DECD4FDu, 0x5094C375u, 0x4BBCCE0Du,
+    0x0A64EC65u, 0x114CE11Du, 0x3C34F695u, 0x271CFBEDu, 0xBF84B245u, 0xA4ACBF3Du,
+    0x89D4A8B5u, 0x92FCA5CDu, 0xD32487A5u, 0xC80C8ADDu, 0xE5749D55u, 0xFE5C902Du,
+    0xB8C79A6Bu, 0xA3EF9713u, 0x8E97809Bu, 0x95BF8DE3u, 0xD467AF8Bu, 0xCF4FA2F3u,
+    0xE237B57Bu, 0xF91FB803u, 0x6187F1ABu, 0x7AAFFCD3u, 0x57D7EB5Bu, 0x4CFFE623u,
+    0x0D27C44Bu, 0x160FC933u, 0x3B77DEBBu, 0x205FD3C3u, 0x0E86505Cu, 0x15AE5D24u,
+    0x38D64AACu, 0x23FE47D4u, 0x622665BCu, 0x790E68C4u, 0x54767F4Cu, 0x4F5E7234u,
+    0xD7C63B9Cu, 0xCCEE36E4u, 0xE196216Cu, 0xFABE2C14u, 0xBB660E7Cu, 0xA04E0304u,
+    0x8D36148Cu, 0x961E19F4u, 0xA5CB3AD3u, 0xBEE337ABu, 0x939B2023u, 0x88B32D5Bu,
+    0xC96B0F33u, 0xD243024Bu, 0xFF3B15C3u, 0xE41318BBu, 0x7C8B5113u, 0x67A35C6Bu,
+    0x4ADB4BE3u, 0x51F3469Bu, 0x102B64F3u, 0x0B03698Bu, 0x267B7E03u, 0x3D53737Bu,
+    0x138AF0E4u, 0x08A2FD9Cu, 0x25DAEA14u, 0x3EF2E76Cu, 0x7F2AC504u, 0x6402C87Cu,
+    0x497ADFF4u, 0x5252D28Cu, 0xCACA9B24u, 0xD1E2965Cu, 0xFC9A81D4u, 0xE7B28CACu,
+    0xA66AAEC4u, 0xBD42A3BCu, 0x903AB434u, 0x8B12B94Cu, 0xCD89B30Au, 0xD6A1BE72u,
+    0xFBD9A9FAu, 0xE0F1A482u, 0xA12986EAu, 0xBA018B92u, 0x97799C1Au, 0x8C519162u,
+    0x14C9D8CAu, 0x0FE1D5B2u, 0x2299C23Au, 0x39B1CF42u, 0x7869ED2Au, 0x6341E052u,
+    0x4E39F7DAu, 0x5511FAA2u, 0x7BC8793Du, 0x60E07445u, 0x4D9863CDu, 0x56B06EB5u,
+    0x17684CDDu, 0x0C4041A5u, 0x2138562Du, 0x3A105B55u, 0xA28812FDu, 0xB9A01F85u,
+    0x94D8080Du, 0x8FF00575u, 0xCE28271Du, 0xD5002A65u, 0xF8783DEDu, 0xE3503095u,
+    0x754E2961u, 0x6E662419u, 0x431E3391u, 0x58363EE9u, 0x19EE1C81u, 0x02C611F9u,
+    0x2FBE0671u, 0x34960B09u, 0xAC0E42A1u, 0xB7264FD9u, 0x9A5E5851u, 0x81765529u,
+    0xC0AE7741u, 0xDB867A39u, 0xF6FE6DB1u, 0xEDD660C9u, 0xC30FE356u, 0xD827EE2Eu,
+    0xF55FF9A6u, 0xEE77F4DEu, 0xAFAFD6B6u, 0xB487DBCEu, 0x99FFCC46u, 0x82D7C13Eu,
+    0x1A4F8896u, 0x016785EEu, 0x2C1F9266u, 0x37379F1Eu, 0x76EFBD76u, 0x6DC7B00Eu,
+    0x40BFA786u, 0x5B97AAFEu, 0x1D0CA0B8u, 0x0624ADC0u, 0x2B5CBA48u, 0x3074B730u,
+    0x71AC9558u, 0x6A849820u, 0x47FC8FA8u, 0x5CD482D0u, 0xC44CCB78u, 0xDF64C600u,
+    0xF21CD188u, 0xE934DCF0u, 0xA8ECFE98u, 0xB3C4F3E0u, 0x9EBCE468u, 0x8594E910u,
+    0xAB4D6A8Fu, 0xB06567F7u, 0x9D1D707Fu, 0x86357D07u, 0xC7ED5F6Fu, 0xDCC55217u,
+    0xF1BD459Fu, 0xEA9548E7u, 0x720D014Fu, 0x69250C37u, 0x445D1BBFu, 0x5F7516C7u,
+    0x1EAD34AFu, 0x058539D7u, 0x28FD2E5Fu, 0x33D52327u
+  },
+  {
+    0x00000000u, 0x4F576811u, 0x9EAED022u, 0xD1F9B833u, 0x399CBDF3u, 0x76CBD5E2u,
+    0xA7326DD1u, 0xE86505C0u, 0x73397BE6u, 0x3C6E13F7u, 0xED97ABC4u, 0xA2C0C3D5u,
+    0x4AA5C615u, 0x05F2AE04u, 0xD40B1637u, 0x9B5C7E26u, 0xE672F7CCu, 0xA9259FDDu,
+    0x78DC27EEu, 0x378B4FFFu, 0xDFEE4A3Fu, 0x90B9222Eu, 0x41409A1Du, 0x0E17F20Cu,
+    0x954B8C2Au, 0xDA1CE43Bu, 0x0BE55C08u, 0x44B23419u, 0xACD731D9u, 0xE38059C8u,
+    0x3279E1FBu, 0x7D2E89EAu, 0xC824F22Fu, 0x87739A3Eu, 0x568A220Du, 0x19DD4A1Cu,
+    0xF1B84FDCu, 0xBEEF27CDu, 0x6F169FFEu, 0x2041F7EFu, 0xBB1D89C9u, 0xF44AE1D8u,
+    0x25B359EBu, 0x6AE431FAu, 0x8281343Au, 0xCDD65C2Bu, 0x1C2FE418u, 0x53788C09u,
+    0x2E5605E3u, 0x61016DF2u, 0xB0F8D5C1u, 0xFFAFBDD0u, 0x17CAB810u, 0x589DD001u,
+    0x89646832u, 0xC6330023u, 0x5D6F7E05u, 0x12381614u, 0xC3C1AE27u, 0x8C96C636u,
+    0x64F3C3F6u, 0x2BA4ABE7u, 0xFA5D13D4u, 0xB50A7BC5u, 0x9488F9E9u, 0xDBDF91F8u,
+    0x0A2629CBu, 0x457141DAu, 0xAD14441Au, 0xE2432C0Bu, 0x33BA9438u, 0x7CEDFC29u,
+    0xE7B1820Fu, 0xA8E6EA1Eu, 0x791F522Du, 0x36483A3Cu, 0xDE2D3FFCu, 0x917A57EDu,
+    0x4083EFDEu, 0x0FD487CFu, 0x72FA0E25u, 0x3DAD6634u, 0xEC54DE07u, 0xA303B616u,
+    0x4B66B3D6u, 0x0431DBC7u, 0xD5C863F4u, 0x9A9F0BE5u, 0x01C375C3u, 0x4E941DD2u,
+    0x9F6DA5E1u, 0xD03ACDF0u, 0x385FC830u, 0x7708A021u, 0xA6F11812u, 0xE9A67003u,
+    0x5CAC0BC6u, 0x13FB63D7u, 0xC202DBE4u, 0x8D55B3F5u, 0x6530B635u, 0x2A67DE24u,
+    0xFB9E6617u, 0xB4C90E06u, 0x2F957020u, 0x60C21831u, 0xB13BA002u, 0xFE6CC813u,
+    0x1609CDD3u, 0x595EA5C2u, 0x88A71DF1u, 0xC7F075E0u, 0xBADEFC0Au, 0xF589941Bu,
+    0x24702C28u, 0x6B274439u, 0x834241F9u, 0xCC1529E8u, 0x1DEC91DBu, 0x52BBF9CAu,
+    0xC9E787ECu, 0x86B0EFFDu, 0x574957CEu, 0x181E3FDFu, 0xF07B3A1Fu, 0xBF2C520Eu,
+    0x6ED5EA3Du, 0x2182822Cu, 0x2DD0EE65u, 0x62878674u, 0xB37E3E47u, 0xFC295656u,
+    0x144C5396u, 0x5B1B3B87u, 0x8AE283B4u, 0xC5B5EBA5u, 0x5EE99583u, 0x11BEFD92u,
+    0xC04745A1u, 0x8F102DB0u, 0x67752870u, 0x28224061u, 0xF9DBF852u, 0xB68C9043u,
+    0xCBA219A9u, 0x84F571B8u, 0x550CC98Bu, 0x1A5BA19Au, 0xF23EA45Au, 0xBD69CC4Bu,
+    0x6C907478u, 0x23C71C69u, 0xB89B624Fu, 0xF7CC0A5Eu, 0x2635B26Du, 0x6962DA7Cu,
+    0x8107DFBCu, 0xCE50B7ADu, 0x1FA90F9Eu, 0x50FE678Fu, 0xE5F41C4Au, 0xAAA3745Bu,
+    0x7B5ACC68u, 0x340DA479u, 0xDC68A1B9u, 0x933FC9A8u, 0x42C6719Bu, 0x0D91198Au,
+    0x96CD67ACu, 0xD99A0FBDu, 0x0863B78Eu, 0x4734DF9Fu, 0xAF51DA5Fu, 0xE006B24Eu,
+    0x31FF0A7Du, 0x7EA8626Cu, 0x0386EB86u, 0x4CD18397u, 0x9D283BA4u, 0xD27F53B5u,
+    0x3A1A5675u, 0x754D3E64u, 0xA4B48657u, 0xEBE3EE46u, 0x70BF9060u, 0x3FE8F871u,
+    0xEE114042u, 0xA1462853u, 0x49232D93u, 0x06744582u, 0xD78DFDB1u, 0x98DA95A0u,
+    0xB958178Cu, 0xF60F7F9Du, 0x27F6C7AEu, 0x68A1AFBFu, 0x80C4AA7Fu, 0xCF93C26Eu,
+    0x1E6A7A5Du, 0x513D124Cu, 0xCA616C6Au, 0x8536047Bu, 0x54CFBC48u, 0x1B98D459u,
+    0xF3FDD199u, 0xBCAAB988u, 0x6D5301BBu, 0x220469AAu, 0x5F2AE040u, 0x107D8851u,
+    0xC1843062u, 0x8ED35873u, 0x66B65DB3u, 0x29E135A2u, 0xF8188D91u, 0xB74FE580u,
+    0x2C139BA6u, 0x6344F3B7u, 0xB2BD4B84u, 0xFDEA2395u, 0x158F2655u, 0x5AD84E44u,
+    0x8B21F677u, 0xC4769E66u, 0x717CE5A3u, 0x3E2B8DB2u, 0xEFD23581u, 0xA0855D90u,
+    0x48E05850u, 0x07B73041u, 0xD64E8872u, 0x9919E063u, 0x02459E45u, 0x4D12F654u,
+    0x9CEB4E67u, 0xD3BC2676u, 0x3BD923B6u, 0x748E4BA7u, 0xA577F394u, 0xEA209B85u,
+    0x970E126Fu, 0xD8597A7Eu, 0x09A0C24Du, 0x46F7AA5Cu, 0xAE92AF9Cu, 0xE1C5C78Du,
+    0x303C7FBEu, 0x7F6B17AFu, 0xE4376989u, 0xAB600198u, 0x7A99B9ABu, 0x35CED1BAu,
+    0xDDABD47Au, 0x92FCBC6Bu, 0x43050458u, 0x0C526C49u
+  },
+  {
+    0x00000000u, 0x5BA1DCCAu, 0xB743B994u, 0xECE2655Eu, 0x6A466E9Fu, 0x31E7B255u,
+    0xDD05D70Bu, 0x86A40BC1u, 0xD48CDD3Eu, 0x8F2D01F4u, 0x63CF64AAu, 0x386EB860u,
+    0xBECAB3A1u, 0xE56B6F6Bu, 0x09890A35u, 0x5228D6FFu, 0xADD8A7CBu, 0xF6797B01u,
+    0x1A9B1E5Fu, 0x413AC295u, 0xC79EC954u, 0x9C3F159Eu, 0x70DD70C0u, 0x2B7CAC0Au,
+    0x79547AF5u, 0x22F5A63Fu, 0xCE17C361u, 0x95B61FABu, 0x1312146Au, 0x48B3C8A0u,
+    0xA451ADFEu, 0xFFF07134u, 0x5F705221u, 0x04D18EEBu, 0xE833EBB5u, 0xB392377Fu,
+    0x35363CBEu, 0x6E97E074u, 0x8275852Au, 0xD9D459E0u, 0x8BFC8F1Fu, 0xD05D53D5u,
+    0x3CBF368Bu, 0x671EEA41u, 0xE1BAE180u, 0xBA1B3D4Au, 0x56F95814u, 0x0D5884DEu,
+    0xF2A8F5EAu, 0xA9092920u, 0x45EB4C7Eu, 0x1E4A90B4u, 0x98EE9B75u, 0xC34F47BFu,
+    0x2FAD22E1u, 0x740CFE2Bu, 0x262428D4u, 0x7D85F41Eu, 0x91679140u, 0xCAC64D8Au,
+    0x4C62464Bu, 0x17C39A81u, 0xFB21FFDFu, 0xA0802315u, 0xBEE0A442u, 0xE5417888u,
+    0x09A31DD6u, 0x5202C11Cu, 0xD4A6CADDu, 0x8F071617u, 0x63E57349u, 0x3844AF83u,
+    0x6A6C797Cu, 0x31CDA5B6u, 0xDD2FC0E8u, 0x868E1C22u, 0x002A17E3u, 0x5B8BCB29u,
+    0xB769AE77u, 0xECC872BDu, 0x13380389u, 0x4899DF43u, 0xA47BBA1Du, 0xFFDA66D7u,
+    0x797E6D16u, 0x22DFB1DCu, 0xCE3DD482u, 0x959C0848u, 0xC7B4DEB7u, 0x9C15027Du,
+    0x70F76723u, 0x2B56BBE9u, 0xADF2B028u, 0xF6536CE2u, 0x1AB109BCu, 0x4110D576u,
+    0xE190F663u, 0xBA312AA9u, 0x56D34FF7u, 0x0D72933Du, 0x8BD698FCu, 0xD0774436u,
+    0x3C952168u, 0x6734FDA2u, 0x351C2B5Du, 0x6EBDF797u, 0x825F92C9u, 0xD9FE4E03u,
+    0x5F5A45C2u, 0x04FB9908u, 0xE819FC56u, 0xB3B8209Cu, 0x4C4851A8u, 0x17E98D62u,
+    0xFB0BE83Cu, 0xA0AA34F6u, 0x260E3F37u, 0x7DAFE3FDu, 0x914D86A3u, 0xCAEC5A69u,
+    0x98C48C96u, 0xC365505Cu, 0x2F873502u, 0x7426E9C8u, 0xF282E209u, 0xA9233EC3u,
+    0x45C15B9Du, 0x1E608757u, 0x79005533u, 0x22A189F9u, 0xCE43ECA7u, 0x95E2306Du,
+    0x13463BACu, 0x48E7E766u, 0xA4058238u, 0xFFA45EF2u, 0xAD8C880Du, 0xF62D54C7u,
+    0x1ACF3199u, 0x416EED53u, 0xC7CAE692u, 0x9C6B3A58u, 0x70895F06u, 0x2B2883CCu,
+    0xD4D8F2F8u, 0x8F792E32u, 0x639B4B6Cu, 0x383A97A6u, 0xBE9E9C67u, 0xE53F40ADu,
+    0x09DD25F3u, 0x527CF939u, 0x00542FC6u, 0x5BF5F30Cu, 0xB7179652u, 0xECB64A98u,
+    0x6A124159u, 0x31B39D93u, 0xDD51F8CDu, 0x86F02407u, 0x26700712u, 0x7DD1DBD8u,
+    0x9133BE86u, 0xCA92624Cu, 0x4C36698Du, 0x1797B547u, 0xFB75D019u, 0xA0D40CD3u,
+    0xF2FCDA2Cu, 0xA95D06E6u, 0x45BF63B8u, 0x1E1EBF72u, 0x98BAB4B3u, 0xC31B6879u,
+    0x2FF90D27u, 0x7458D1EDu, 0x8BA8A0D9u, 0xD0097C13u, 0x3CEB194Du, 0x674AC587u,
+    0xE1EECE46u, 0xBA4F128Cu, 0x56AD77D2u, 0x0D0CAB18u, 0x5F247DE7u, 0x0485A12Du,
+    0xE867C473u, 0xB3C618B9u, 0x35621378u, 0x6EC3CFB2u, 0x8221AAECu, 0xD9807626u,
+    0xC7E0F171u, 0x9C412DBBu, 0x70A348E5u, 0x2B02942Fu, 0xADA69FEEu, 0xF6074324u,
+    0x1AE5267Au, 0x4144FAB0u, 0x136C2C4Fu, 0x48CDF085u, 0xA42F95DBu, 0xFF8E4911u,
+    0x792A42D0u, 0x228B9E1Au, 0xCE69FB44u, 0x95C8278Eu, 0x6A3856BAu, 0x31998A70u,
+    0xDD7BEF2Eu, 0x86DA33E4u, 0x007E3825u, 0x5BDFE4EFu, 0xB73D81B1u, 0xEC9C5D7Bu,
+    0xBEB48B84u, 0xE515574Eu, 0x09F73210u, 0x5256EEDAu, 0xD4F2E51Bu, 0x8F5339D1u,
+    0x63B15C8Fu, 0x38108045u, 0x9890A350u, 0xC3317F9Au, 0x2FD31AC4u, 0x7472C60Eu,
+    0xF2D6CDCFu, 0xA9771105u, 0x4595745Bu, 0x1E34A891u, 0x4C1C7E6Eu, 0x17BDA2A4u,
+    0xFB5FC7FAu, 0xA0FE1B30u, 0x265A10F1u, 0x7DFBCC3Bu, 0x9119A965u, 0xCAB875AFu,
+    0x3548049Bu, 0x6EE9D851u, 0x820BBD0Fu, 0xD9AA61C5u, 0x5F0E6A04u, 0x04AFB6CEu,
+    0xE84DD390u, 0xB3EC0F5Au, 0xE1C4D9A5u, 0xBA65056Fu, 0x56876031u, 0x0D26BCFBu,
+    0x8B82B73Au, 0xD0236BF0u, 0x3CC10EAEu, 0x6760D264u
+  }
+#endif
+};
+
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+
+
+
+/* Exported function definitions ---------------------------------------------*/
+
+uint8_t Crc_Calculate8(const uint8_t* data, uint16_t num_bits)
+{
+  uint8_t crc = CRC8_INIT;
+  uint16_t byte_count = num_bits / 8;
+
+  for (uint16_t i = 0; i < byte_count; i++) {
+    crc ^= data[i];
+#if CRC_NIBBLE_TABLES == 1
+    crc = (uint8_t) (crc << 4) ^ crc8_table[crc >> 4];
+    crc = (uint8_t) (crc << 4) ^ crc8_table[crc >> 4];
+#else
+    crc = crc8_table[crc];
+#endif
+  }
+
+  // Only the leading bits of a partial last byte are covered
+  uint8_t remaining_bits = num_bits % 8;
+  if (remaining_bits > 0) {
+    crc ^= data[byte_count] & (0xFF << (8 - remaining_bits));
+    for (uint8_t j = 0; j < remaining_bits; j++) {
+      crc = (crc & 0x80) ? (uint8_t) (crc << 1) ^ CRC8_POLYNOMIAL : (uint8_t) (crc << 1);
+    }
+  }
+  return crc;
+}
+
+uint16_t Crc_Calculate16(const uint8_t* data, uint16_t num_bits)
+{
+  uint16_t crc = CRC16_INIT;
+  uint16_t byte_count = num_bits / 8;
+
+  for (uint16_t i = 0; i < byte_count; i++) {
+    crc ^= (uint16_t) data[i] << 8;
+#if CRC_NIBBLE_TABLES == 1
+    crc = (uint16_t) (crc << 4) ^ crc16_table[crc >> 12];
+    crc = (uint16_t) (crc << 4) ^ crc16_table[crc >> 12];
+#else
+    crc = (uint16_t) (crc << 8) ^ crc16_table[crc >> 8];
+#endif
+  }
+
+  uint8_t remaining_bits = num_bits % 8;
+  if (remaining_bits > 0) {
+    crc ^= (uint16_t) (data[byte_count] & (0xFF << (8 - remaining_bits))) << 8;
+    for (uint8_t j = 0; j < remaining_bits; j++) {
+      crc = (crc & 0x8000) ? (uint16_t) (crc << 1) ^ CRC16_POLYNOMIAL : (uint16_t) (crc << 1);
+    }
+  }
+  return crc;
+}
+
+uint32_t Crc_Calculate32(const uint8_t* data, uint16_t num_bits)
+{
+  uint32_t crc = CRC32_INIT;
+  uint16_t byte_count = num_bits / 8;
+  uint16_t i = 0;
+
+#if CRC_NIBBLE_TABLES == 1
+  for (; i < byte_count; i++) {
+    crc ^= (uint32_t) data[i] << 24;
+    crc = (crc << 4) ^ crc32_table[crc >> 28];
+    crc = (crc << 4) ^ crc32_table[crc >> 28];
+  }
+#else
+#if CRC32_SLICES == 8
+  for (; i + 8 <= byte_count; i += 8) {
+    uint32_t high = crc ^ ((uint32_t) data[i] << 24 | (uint32_t) data[i + 1] << 16 |
+                           (uint32_t) data[i + 2] << 8 | data[i + 3]);
+    uint32_t low = (uint32_t) data[i + 4] << 24 | (uint32_t) data[i + 5] << 16 |
+                   (uint32_t) data[i + 6] << 8 | data[i + 7];
+    crc = crc32_table[7][high >> 24] ^ crc32_table[6][(high >> 16) & 0xFF] ^
+          crc32_table[5][(high >> 8) & 0xFF] ^ crc32_table[4][high & 0xFF] ^
+          crc32_table[3][low >> 24] ^ crc32_table[2][(low >> 16) & 0xFF] ^
+          crc32_table[1][(low >> 8) & 0xFF] ^ crc32_table[0][low & 0xFF];
+  }
+#endif
+#if CRC32_SLICES >= 4
+  for (; i + 4 <= byte_count; i += 4) {
+    crc ^= (uint32_t) data[i] << 24 | (uint32_t) data[i + 1] << 16 | (uint32_t) data[i + 2] << 8 | data[i + 3];
+    crc = crc32_table[3][crc >> 24] ^ crc32_table[2][(crc >> 16) & 0xFF] ^
+          crc32_table[1][(crc >> 8) & 0xFF] ^ crc32_table[0][crc & 0xFF];
+  }
+#endif
+  for (; i < byte_count; i++) {
+    crc = (crc << 8) ^ crc32_table[0][(crc >> 24) ^ data[i]];
+  }
+#endif
+
+  uint8_t remaining_bits = num_bits % 8;
+  if (remaining_bits > 0) {
+    crc ^= (uint32_t) (data[byte_count] & (0xFF << (8 - remaining_bits))) << 24;
+    for (uint8_t j = 0; j < remaining_bits; j++) {
+      crc = (crc & 0x80000000u) ? (crc << 1) ^ CRC32_POLYNOMIAL : crc << 1;
+    }
+  }
+  return ~crc;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+
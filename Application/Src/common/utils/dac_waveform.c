@@ -26,6 +26,22 @@ typedef struct {
   bool amplitude_transitioning;
 } WaveformControl_t;
 
+// Frequency path of the current step when it is shaped. The transitions into
+// and out of the step are each centred on its boundary and move the
+// deviation from the carrier.
+typedef struct {
+  bool active;
+  float carrier;
+  float deviation_previous;
+  float deviation_current;
+  float deviation_next;
+  float table_scale_start;  // Gaussian table entries per sample of the transition into the step
+  float table_scale_end;    // and of the transition out of it
+  uint32_t start_end;       // Sample after which the transition into the step is complete
+  uint32_t end_start;       // Sample at which the transition out of the step begins
+  uint32_t length;          // Samples in the step
+} FrequencyShaping_t;
+
 typedef enum {
   FILL_FIRST_HALF,
   FILL_LAST_HALF
@@ -38,6 +54,11 @@ typedef enum {
 #define PHASE_PRECISION     32
 #define AMPLITUDE_STEPS     32  // Number of steps for amplitude transition
 
+#define GAUSSIAN_TABLE_SIZE     129
+#define GAUSSIAN_SPAN           3.0f    // Standard deviations either side of a boundary that a transition lasts
+#define GAUSSIAN_SIGMA_BT       0.1325f // sqrt(ln 2) / (2 pi), standard deviation of the filter in steps times BT
+#define PHASE_PER_HZ            ((float) (1ULL << PHASE_PRECISION) / (float) DAC_SAMPLE_RATE)
+
 /* Private macro -------------------------------------------------------------*/
 
 
@@ -48,19 +69,51 @@ static uint16_t sine_table[SINE_POINTS];
 static uint32_t dac_buffer[DAC_BUFFER_SIZE];
 
 static WaveformControl_t wave_ctrl;
+static DAC_StepSource_t step_source = NULL;
+static WaveformStep_t current_waveform_step;
+static WaveformStep_t next_waveform_step;
+static bool next_step_valid = false;
+static int32_t previous_deviation_hz = 0;
+static uint32_t previous_duration_us = 0;
+static float shaping_bt = 0.0f;
+static FrequencyShaping_t shaping;
+static float gaussian_table[GAUSSIAN_TABLE_SIZE]; // Step response of the filter across a transition
 static const WaveformStep_t* current_sequence = NULL;
 static uint32_t sequence_length = 0;
 static uint32_t current_step = 0;
 static volatile bool dac_running = false;
-static uint32_t current_symbol_duration_us = 0;
+static uint32_t step_sample = 0;       // Samples of the current step already written
+static uint32_t step_length = 0;       // Samples in the current step
+static bool steps_done = false;        // The source ended part way through the last fill
 
 static volatile uint32_t callback_count = 0;
 
+static DAC_SampleSource_t sample_source = NULL;
+static uint32_t source_sample_rate = 0;
+static uint32_t source_amplitude = 0;
+static const float* source_samples = NULL;
+static uint16_t source_length = 0;
+static uint16_t source_index = 0;
+static uint32_t source_phase = 0;     // Position between the last and current samples, DAC_SAMPLE_RATE per sample
+static float source_last = 0.0f;
+static float source_current = 0.0f;
+static bool source_done = false;
+
 /* Private function prototypes -----------------------------------------------*/
 
 static void generateSineTable(void);
+static void generateGaussianTable(void);
+static bool nextStep(void);
+static bool fetchStep(WaveformStep_t* step);
+static int32_t stepDeviation(const WaveformStep_t* step);
+static void updateShaping(void);
+static uint32_t shapedIncrement(uint32_t sample);
+static bool sequenceSource(WaveformStep_t* step);
 static void updateWaveformParameters(const WaveformStep_t* step);
 static void fillDacBuffer(FillType_t type);
+static void fillFromStep(uint16_t start_index, uint16_t end_index);
+static void fillFromSource(uint16_t start_index, uint16_t end_index);
+static bool nextSourceSample(void);
 static void halfFullDmaCallback(void);
 static void fullDmaCallback(void);
 
@@ -69,6 +122,7 @@ static void fullDmaCallback(void);
 bool DAC_InitWaveformGenerator(void)
 {
   generateSineTable();
+  generateGaussianTable();
 
   // Initialize control structure
   memset(&wave_ctrl, 0, sizeof(wave_ctrl));
@@ -80,41 +134,67 @@ bool DAC_InitWaveformGenerator(void)
   return (ret1 == HAL_OK);
 }
 
-bool DAC_SetWaveformSequence(WaveformStep_t* sequence, uint32_t num_steps)
+bool DAC_SetWaveformSequence(const WaveformStep_t* sequence, uint32_t num_steps)
 {
   if(! sequence || num_steps == 0) return false;
 
-  // Length of sequence must be a multiple of half the DAC buffer size
-  uint32_t length_multiple = DAC_BUFFER_SIZE / 2;
-  // Converts symbol length multiple into micro seconds
-  uint32_t length_multiple_us = length_multiple * DAC_SAMPLE_RATE / 1000000;
-
-  // Every symbol duration must be a multiple of half the DAC buffer duration in micro seconds
   for (uint32_t i = 0; i < num_steps; i++) {
-    if ((sequence[i].duration_us % length_multiple_us) != 0) {
+    if (sequence[i].duration_us == 0) {
       return false;
     }
-
-    // Calculate phase increment for each step
-    // Phase increment determines how quickly we move through the sine table
-    // Formula: phase_inc = (freq * 2^PHASE_PRECISION) / sample_rate
-    sequence[i].phase_increment =
-        (((uint64_t) sequence[i].freq_hz) << PHASE_PRECISION) / DAC_SAMPLE_RATE;
   }
 
   current_sequence = sequence;
   sequence_length = num_steps;
   current_step = 0;
 
+  return DAC_SetStepSource(sequenceSource, 0.0f);
+}
+
+bool DAC_SetStepSource(DAC_StepSource_t source, float shaping_bt_product)
+{
+  if (source == NULL || shaping_bt_product < 0.0f) return false;
+
+  step_source = source;
+  sample_source = NULL;
+  shaping_bt = (shaping_bt_product > 0.0f) ? fmaxf(shaping_bt_product, DAC_MIN_SHAPING_BT) : 0.0f;
+
   return true;
 }
 
-bool DAC_StartWaveformOutput(uint32_t channel)
+bool DAC_SetSampleSource(DAC_SampleSource_t source, uint32_t sample_rate, float relative_amplitude)
 {
-  if (current_sequence == NULL) return false;
+  if (source == NULL || sample_rate == 0 || sample_rate > DAC_SAMPLE_RATE) return false;
+  if (relative_amplitude < 0.0f || relative_amplitude > 1.0f) return false;
+
+  sample_source = source;
+  source_sample_rate = sample_rate;
+  source_amplitude = (uint32_t) (relative_amplitude * (float) DAC_MAX_VALUE);
+  source_samples = NULL;
+  source_length = 0;
+  source_index = 0;
+  source_phase = 0;
+  source_last = 0.0f;
+  source_current = 0.0f;
+  source_done = false;
+  step_source = NULL;
+
+  return true;
+}
 
+bool DAC_StartWaveformOutput(uint32_t channel)
+{
+  if (step_source == NULL && sample_source == NULL) return false;
+
+  if (sample_source == NULL) {
+    // The first step has no transition into it
+    next_step_valid = fetchStep(&next_waveform_step);
+    current_waveform_step = next_waveform_step;
+    if (nextStep() == false) return false;
+    updateWaveformParameters(&current_waveform_step);
+    steps_done = false;
+  }
   dac_running = true;
-  updateWaveformParameters(&current_sequence[0]);
   fillDacBuffer(FILL_FIRST_HALF);
   fillDacBuffer(FILL_LAST_HALF);
 
@@ -154,10 +234,125 @@ static void generateSineTable(void)
   }
 }
 
+// Normalized so a transition starts and ends exactly on the two frequencies
+static void generateGaussianTable(void)
+{
+  const float edge = erff(GAUSSIAN_SPAN / (float) M_SQRT2);
+  for (uint16_t i = 0; i < GAUSSIAN_TABLE_SIZE; i++) {
+    float x = GAUSSIAN_SPAN * (2.0f * i / (GAUSSIAN_TABLE_SIZE - 1) - 1.0f);
+    gaussian_table[i] = 0.5f * (1.0f + erff(x / (float) M_SQRT2) / edge);
+  }
+}
+
+// Moves on to the step after the current one, false once the source has
+// ended. The step after that is fetched as well so its transition can start
+// before the boundary.
+static bool nextStep(void)
+{
+  if (next_step_valid == false) {
+    return false;
+  }
+  previous_deviation_hz = stepDeviation(&current_waveform_step);
+  previous_duration_us = current_waveform_step.duration_us;
+  current_waveform_step = next_waveform_step;
+  next_step_valid = fetchStep(&next_waveform_step);
+  return true;
+}
+
+// False once the source has ended or supplied an empty step
+static bool fetchStep(WaveformStep_t* step)
+{
+  if (step_source(step) == false) {
+    return false;
+  }
+  return step->duration_us != 0;
+}
+
+static int32_t stepDeviation(const WaveformStep_t* step)
+{
+  return (int32_t) step->freq_hz - (int32_t) step->carrier_hz;
+}
+
+static void updateShaping(void)
+{
+  int32_t deviation = stepDeviation(&current_waveform_step);
+  int32_t deviation_next = (next_step_valid == true) ? stepDeviation(&next_waveform_step) : deviation;
+  shaping.active = shaping_bt > 0.0f && (previous_deviation_hz != deviation || deviation_next != deviation);
+  if (shaping.active == false) {
+    return;
+  }
+
+  shaping.carrier = (float) current_waveform_step.carrier_hz;
+  shaping.deviation_previous = (float) previous_deviation_hz;
+  shaping.deviation_current = (float) deviation;
+  shaping.deviation_next = (float) deviation_next;
+  shaping.length = (uint32_t) ((uint64_t) current_waveform_step.duration_us * DAC_SAMPLE_RATE / 1000000);
+
+  uint32_t duration_start = (previous_duration_us < current_waveform_step.duration_us) ?
+                            previous_duration_us : current_waveform_step.duration_us;
+  uint32_t duration_end = (next_step_valid == true && next_waveform_step.duration_us < current_waveform_step.duration_us) ?
+                          next_waveform_step.duration_us : current_waveform_step.duration_us;
+  float sigma_start = GAUSSIAN_SIGMA_BT / shaping_bt * (float) duration_start * DAC_SAMPLE_RATE / 1000000.0f;
+  float sigma_end = GAUSSIAN_SIGMA_BT / shaping_bt * (float) duration_end * DAC_SAMPLE_RATE / 1000000.0f;
+  shaping.table_scale_start = (GAUSSIAN_TABLE_SIZE - 1) / (2.0f * GAUSSIAN_SPAN * sigma_start);
+  shaping.table_scale_end = (GAUSSIAN_TABLE_SIZE - 1) / (2.0f * GAUSSIAN_SPAN * sigma_end);
+
+  float start_end = GAUSSIAN_SPAN * sigma_start;
+  float end_start = (float) shaping.length - GAUSSIAN_SPAN * sigma_end;
+  shaping.start_end = (previous_deviation_hz != deviation) ? (uint32_t) ceilf(start_end) : 0;
+  shaping.end_start = (deviation_next != deviation && end_start > 0.0f) ?
+                      (uint32_t) end_start : shaping.length;
+}
+
+// Phase increment at a sample of the current step, the deviation of the step
+// plus the filtered steps from the previous deviation and to the next one
+static uint32_t shapedIncrement(uint32_t sample)
+{
+  if (sample >= shaping.start_end && sample < shaping.end_start) {
+    return wave_ctrl.phase_increment;
+  }
+
+  const float centre = (GAUSSIAN_TABLE_SIZE - 1) / 2.0f;
+  float position[2] = {
+    centre + (float) sample * shaping.table_scale_start,
+    centre + ((float) sample - (float) shaping.length) * shaping.table_scale_end
+  };
+  float step[2];
+  for (uint8_t k = 0; k < 2; k++) {
+    if (position[k] <= 0.0f) {
+      step[k] = 0.0f;
+    }
+    else if (position[k] >= GAUSSIAN_TABLE_SIZE - 1) {
+      step[k] = 1.0f;
+    }
+    else {
+      uint32_t index = (uint32_t) position[k];
+      float fraction = position[k] - (float) index;
+      step[k] = gaussian_table[index] + fraction * (gaussian_table[index + 1] - gaussian_table[index]);
+    }
+  }
+
+  float freq = shaping.carrier + shaping.deviation_previous +
+               (shaping.deviation_current - shaping.deviation_previous) * step[0] +
+               (shaping.deviation_next - shaping.deviation_current) * step[1];
+  return (uint32_t) (freq * PHASE_PER_HZ);
+}
+
+static bool sequenceSource(WaveformStep_t* step)
+{
+  if (current_step >= sequence_length) {
+    return false;
+  }
+  *step = current_sequence[current_step++];
+  return true;
+}
+
 static void updateWaveformParameters(const WaveformStep_t* step)
 {
-  // Calculate new phase increment
-  wave_ctrl.phase_increment = step->phase_increment;
+  // Phase increment determines how quickly we move through the sine table
+  // Formula: phase_inc = (freq * 2^PHASE_PRECISION) / sample_rate
+  wave_ctrl.phase_increment = (((uint64_t) step->freq_hz) << PHASE_PRECISION) / DAC_SAMPLE_RATE;
+  wave_ctrl.phase_accumulator += step->phase_offset;
 
   // Setup amplitude transition
   wave_ctrl.target_amplitude = (uint32_t) (step->relative_amplitude * (float) DAC_MAX_VALUE);
@@ -165,7 +360,9 @@ static void updateWaveformParameters(const WaveformStep_t* step)
   wave_ctrl.amplitude_counter = 0;
   wave_ctrl.amplitude_transitioning = true;
 
-  current_symbol_duration_us = 0;
+  step_sample = 0;
+  step_length = (uint32_t) ((uint64_t) step->duration_us * DAC_SAMPLE_RATE / 1000000);
+  updateShaping();
 }
 
 static void fillDacBuffer(FillType_t type)
@@ -178,32 +375,63 @@ static void fillDacBuffer(FillType_t type)
   if (last_fill == true) {
     last_fill = false;
     DAC_StopWaveformOutput();
+    DAC_WaveformCompleteCallback();
     return;
   }
 
-  // Final step check
-  if (current_step == (sequence_length - 1)) {
-    if (current_symbol_duration_us >= current_sequence[current_step].duration_us) {
-      last_fill = true;
-      return;
-    }
+  if (sample_source != NULL) {
+    uint16_t start_index = (type == FILL_FIRST_HALF) ? 0 : DAC_BUFFER_SIZE / 2;
+    fillFromSource(start_index, start_index + DAC_BUFFER_SIZE / 2);
+    last_fill = source_done;
+    return;
   }
 
-  // Running index to use
-  uint16_t i = (type == FILL_FIRST_HALF) ? 0 : DAC_BUFFER_SIZE / 2;
+  // The previous fill holds the end of the waveform and is now being output
+  if (steps_done == true) {
+    last_fill = true;
+    return;
+  }
 
-  const uint16_t start_index = i; // Absolute starting index to use
-  const uint16_t end_index = (type == FILL_FIRST_HALF) ? DAC_BUFFER_SIZE / 2: DAC_BUFFER_SIZE;
+  const uint16_t start_index = (type == FILL_FIRST_HALF) ? 0 : DAC_BUFFER_SIZE / 2;
+  const uint16_t end_index = start_index + DAC_BUFFER_SIZE / 2;
+
+  // Steps can end anywhere in the half buffer, each run is the rest of the
+  // half or of the current step, whichever ends first
+  uint16_t i = start_index;
+  while (i < end_index) {
+    if (step_sample >= step_length) {
+      // Start the next step, or finish once the source has none
+      if (nextStep() == false) {
+        if (i == start_index) {
+          last_fill = true;
+          return;
+        }
+        for (; i < end_index; i++) {
+          dac_buffer[i] = (DAC_MAX_VALUE + 1) / 2;
+        }
+        steps_done = true;
+        return;
+      }
+      updateWaveformParameters(&current_waveform_step);
+    }
 
-  if (current_symbol_duration_us >= current_sequence[current_step].duration_us) { // Current sequence step has gone on long enough
-    // start new symbol
-    current_step++;
-    updateWaveformParameters(&current_sequence[current_step]);
+    uint32_t remaining = step_length - step_sample;
+    uint16_t run_end = (remaining < (uint32_t) (end_index - i)) ? i + (uint16_t) remaining : end_index;
+    fillFromStep(i, run_end);
+    step_sample += run_end - i;
+    i = run_end;
   }
+}
+
+// Writes a run of samples of the current step, starting step_sample into it
+static void fillFromStep(uint16_t start_index, uint16_t end_index)
+{
+  // Running index to use
+  uint16_t i = start_index;
 
   // Flag to change the output frequency has been set so perform amplitude transition
   if (wave_ctrl.amplitude_transitioning) {
-    for (;i < start_index + AMPLITUDE_STEPS; i++) {
+    for (; i < end_index && wave_ctrl.amplitude_transitioning == true; i++) {
       // Take the first 10 bits of the phase as the sine table has 2^10 points
       uint32_t index = wave_ctrl.phase_accumulator >> (PHASE_PRECISION - 10);
       uint32_t base_value = sine_table[index & (SINE_POINTS - 1)]; // Ensures nothing out of index
@@ -218,11 +446,20 @@ static void fillDacBuffer(FillType_t type)
       dac_buffer[i] = (DAC_MAX_VALUE + 1) / 2 - wave_ctrl.current_amplitude / 2 + ((base_value * wave_ctrl.current_amplitude) >> 12);
 
       // Update phase
-      wave_ctrl.phase_accumulator += wave_ctrl.phase_increment;
+      wave_ctrl.phase_accumulator += (shaping.active == true) ?
+                                     shapedIncrement(step_sample + i - start_index) : wave_ctrl.phase_increment;
     }
   }
 
   uint16_t offset_amt = (DAC_MAX_VALUE + 1) / 2 - wave_ctrl.current_amplitude / 2;
+  if (shaping.active == true) {
+    for (; i < end_index; i++) {
+      uint32_t index = wave_ctrl.phase_accumulator >> (PHASE_PRECISION - 10);
+      uint32_t base_value = sine_table[index & (SINE_POINTS - 1)];
+      dac_buffer[i] = offset_amt + ((base_value * wave_ctrl.current_amplitude) >> 12);
+      wave_ctrl.phase_accumulator += shapedIncrement(step_sample + i - start_index);
+    }
+  }
   for(; i < end_index; i++) {
     // Get current phase
     uint32_t index = wave_ctrl.phase_accumulator >> (PHASE_PRECISION - 10);
@@ -234,8 +471,50 @@ static void fillDacBuffer(FillType_t type)
     // Update phase
     wave_ctrl.phase_accumulator += wave_ctrl.phase_increment;
   }
+}
 
-  current_symbol_duration_us += DAC_BUFFER_SIZE * DAC_SAMPLE_RATE / 1000000 / 2;
+// Linear interpolation between the last two source samples. The output runs
+// one source sample behind and ends at midscale once the source is done.
+static void fillFromSource(uint16_t start_index, uint16_t end_index)
+{
+  const float scale = (float) source_amplitude / 2.0f;
+  const float midscale = (float) ((DAC_MAX_VALUE + 1) / 2);
+  for (uint16_t i = start_index; i < end_index; i++) {
+    source_phase += source_sample_rate;
+    while (source_phase >= DAC_SAMPLE_RATE) {
+      source_phase -= DAC_SAMPLE_RATE;
+      source_last = source_current;
+      source_current = (nextSourceSample() == true) ? source_samples[source_index++] : 0.0f;
+    }
+
+    float t = (float) source_phase / (float) DAC_SAMPLE_RATE;
+    float value = midscale + scale * (source_last + t * (source_current - source_last));
+    value = fminf(fmaxf(value, 0.0f), (float) DAC_MAX_VALUE);
+    dac_buffer[i] = (uint32_t) value;
+  }
+}
+
+// Makes sure source_samples[source_index] is the next sample, false once the
+// source has run out
+static bool nextSourceSample(void)
+{
+  if (source_done == true) {
+    return false;
+  }
+  if (source_index >= source_length) {
+    source_index = 0;
+    source_length = sample_source(&source_samples);
+    if (source_length == 0 || source_samples == NULL) {
+      source_done = true;
+      return false;
+    }
+  }
+  return true;
+}
+
+__weak void DAC_WaveformCompleteCallback(void)
+{
+  // Overridden by whoever needs to know when a sequence has finished
 }
 
 // DMA callbacks
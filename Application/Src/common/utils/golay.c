@@ -0,0 +1,114 @@
+/*
+ * golay.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "golay.h"
+#include <stddef.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define GOLAY_MASK              ((1u << GOLAY_DATA_BITS) - 1)
+#define NUM_SYNDROMES           (1u << GOLAY_PARITY_BITS)
+
+// Each syndrome table entry holds the data bits in error, the weight of the
+// whole error pattern and whether the syndrome belongs to any correctable one
+#define SYNDROME_WEIGHT_SHIFT   12
+#define SYNDROME_VALID          0x8000u
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+// Parity of each data bit, most significant first. The matrix is its own
+// transpose and inverse.
+static const uint16_t parity_rows[GOLAY_DATA_BITS] = {
+  0xDC5, 0xB8B, 0x717, 0xE2D, 0xC5B, 0x8B7, 0x16F, 0x2DD, 0x5B9, 0xB71, 0x6E3, 0xFFE
+};
+
+static uint16_t syndrome_errors[NUM_SYNDROMES];
+static bool syndrome_table_ready = false;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static uint16_t calculateParity(uint16_t data);
+static void buildSyndromeTable(void);
+static void addErrorPattern(uint32_t error, uint8_t weight);
+
+/* Exported function definitions ---------------------------------------------*/
+
+uint32_t Golay_Encode(uint16_t data)
+{
+  data &= GOLAY_MASK;
+  return ((uint32_t) data << GOLAY_PARITY_BITS) | calculateParity(data);
+}
+
+bool Golay_Decode(uint32_t codeword, uint16_t* data, uint8_t* num_corrected)
+{
+  if (data == NULL || num_corrected == NULL) {
+    return false;
+  }
+  buildSyndromeTable();
+
+  uint16_t received = (codeword >> GOLAY_PARITY_BITS) & GOLAY_MASK;
+  uint16_t syndrome = calculateParity(received) ^ (codeword & GOLAY_MASK);
+  uint16_t entry = syndrome_errors[syndrome];
+  if ((entry & SYNDROME_VALID) == 0) {
+    return false;
+  }
+
+  *data = received ^ (entry & GOLAY_MASK);
+  *num_corrected = (entry >> SYNDROME_WEIGHT_SHIFT) & 0x7;
+  return true;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static uint16_t calculateParity(uint16_t data)
+{
+  uint16_t parity = 0;
+  for (uint8_t i = 0; i < GOLAY_DATA_BITS; i++) {
+    if ((data & (1u << (GOLAY_DATA_BITS - 1 - i))) != 0) {
+      parity ^= parity_rows[i];
+    }
+  }
+  return parity;
+}
+
+// The code's minimum distance of 8 gives every pattern of up to 3 bits its
+// own syndrome. The syndromes left over come from 4 or more bits in error.
+static void buildSyndromeTable(void)
+{
+  if (syndrome_table_ready == true) {
+    return;
+  }
+
+  addErrorPattern(0, 0);
+  for (uint8_t i = 0; i < GOLAY_CODEWORD_BITS; i++) {
+    addErrorPattern(1u << i, 1);
+    for (uint8_t j = i + 1; j < GOLAY_CODEWORD_BITS; j++) {
+      addErrorPattern((1u << i) | (1u << j), 2);
+      for (uint8_t k = j + 1; k < GOLAY_CODEWORD_BITS; k++) {
+        addErrorPattern((1u << i) | (1u << j) | (1u << k), 3);
+      }
+    }
+  }
+  syndrome_table_ready = true;
+}
+
+static void addErrorPattern(uint32_t error, uint8_t weight)
+{
+  uint16_t data_error = (error >> GOLAY_PARITY_BITS) & GOLAY_MASK;
+  uint16_t syndrome = calculateParity(data_error) ^ (error & GOLAY_MASK);
+  syndrome_errors[syndrome] = SYNDROME_VALID | ((uint16_t) weight << SYNDROME_WEIGHT_SHIFT) | data_error;
+}
@@ -0,0 +1,108 @@
+/*
+ * interleaver.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "interleaver.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool permuteBits(const uint8_t* src, uint8_t* dest, uint16_t num_bits, uint8_t depth,
+                        bool interleave);
+static inline bool getBit(const uint8_t* bits, uint16_t position);
+static inline void setBit(uint8_t* bits, uint16_t position, bool bit);
+
+/* Exported function definitions ---------------------------------------------*/
+
+bool Interleaver_Interleave(const uint8_t* src, uint8_t* dest, uint16_t num_bits, uint8_t depth)
+{
+  return permuteBits(src, dest, num_bits, depth, true);
+}
+
+bool Interleaver_Deinterleave(const uint8_t* src, uint8_t* dest, uint16_t num_bits, uint8_t depth)
+{
+  return permuteBits(src, dest, num_bits, depth, false);
+}
+
+bool Interleaver_DeinterleaveLlr(const int8_t* src, int8_t* dest, uint16_t num_bits, uint8_t depth)
+{
+  if (depth == 0) {
+    return false;
+  }
+
+  uint16_t num_columns = (num_bits + depth - 1) / depth;
+  uint16_t sent = 0;
+  for (uint16_t column = 0; column < num_columns; column++) {
+    for (uint16_t coded = column; coded < num_bits; coded += num_columns) {
+      dest[coded] = src[sent++];
+    }
+  }
+  return true;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// Walks the matrix a column at a time. Going down a column, each row moves
+// num_columns bits further into the coded block.
+static bool permuteBits(const uint8_t* src, uint8_t* dest, uint16_t num_bits, uint8_t depth,
+                        bool interleave)
+{
+  if (depth == 0) {
+    return false;
+  }
+  if (depth == 1) {
+    memcpy(dest, src, (num_bits + 7) / 8);
+    return true;
+  }
+
+  uint16_t num_columns = (num_bits + depth - 1) / depth;
+  uint16_t sent = 0;
+  for (uint16_t column = 0; column < num_columns; column++) {
+    for (uint16_t coded = column; coded < num_bits; coded += num_columns) {
+      if (interleave == true) {
+        setBit(dest, sent, getBit(src, coded));
+      }
+      else {
+        setBit(dest, coded, getBit(src, sent));
+      }
+      sent++;
+    }
+  }
+  return true;
+}
+
+static inline bool getBit(const uint8_t* bits, uint16_t position)
+{
+  return (bits[position / 8] & (0x80 >> (position % 8))) != 0;
+}
+
+static inline void setBit(uint8_t* bits, uint16_t position, bool bit)
+{
+  if (bit == true) {
+    bits[position / 8] |= 0x80 >> (position % 8);
+  }
+  else {
+    bits[position / 8] &= ~(0x80 >> (position % 8));
+  }
+}
@@ -0,0 +1,288 @@
+/*
+ * reed_solomon.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "reed_solomon.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define GF_ORDER            255   // Nonzero elements of GF(256)
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+// Powers of alpha, repeated so that the sum of two logs needs no reduction
+static const uint8_t gf_exp[2 * GF_ORDER] = {
+  0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26,
+  0x4C, 0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0,
+  0x9D, 0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23,
+  0x46, 0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1,
+  0x5F, 0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+  0xFD, 0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2,
+  0xD9, 0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE,
+  0x81, 0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC,
+  0x85, 0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54,
+  0xA8, 0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73,
+  0xE6, 0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF,
+  0xE3, 0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41,
+  0x82, 0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6,
+  0x51, 0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09,
+  0x12, 0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16,
+  0x2C, 0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E, 0x01,
+  0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26, 0x4C,
+  0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x9D,
+  0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23, 0x46,
+  0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1, 0x5F,
+  0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xFD,
+  0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2, 0xD9,
+  0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE, 0x81,
+  0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC, 0x85,
+  0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54, 0xA8,
+  0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73, 0xE6,
+  0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF, 0xE3,
+  0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41, 0x82,
+  0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6, 0x51,
+  0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09, 0x12,
+  0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16, 0x2C,
+  0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E
+};
+
+// Inverse of gf_exp, entry 0 unused
+static const uint8_t gf_log[GF_ORDER + 1] = {
+  0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1A, 0xC6, 0x03, 0xDF, 0x33, 0xEE, 0x1B, 0x68, 0xC7, 0x4B,
+  0x04, 0x64, 0xE0, 0x0E, 0x34, 0x8D, 0xEF, 0x81, 0x1C, 0xC1, 0x69, 0xF8, 0xC8, 0x08, 0x4C, 0x71,
+  0x05, 0x8A, 0x65, 0x2F, 0xE1, 0x24, 0x0F, 0x21, 0x35, 0x93, 0x8E, 0xDA, 0xF0, 0x12, 0x82, 0x45,
+  0x1D, 0xB5, 0xC2, 0x7D, 0x6A, 0x27, 0xF9, 0xB9, 0xC9, 0x9A, 0x09, 0x78, 0x4D, 0xE4, 0x72, 0xA6,
+  0x06, 0xBF, 0x8B, 0x62, 0x66, 0xDD, 0x30, 0xFD, 0xE2, 0x98, 0x25, 0xB3, 0x10, 0x91, 0x22, 0x88,
+  0x36, 0xD0, 0x94, 0xCE, 0x8F, 0x96, 0xDB, 0xBD, 0xF1, 0xD2, 0x13, 0x5C, 0x83, 0x38, 0x46, 0x40,
+  0x1E, 0x42, 0xB6, 0xA3, 0xC3, 0x48, 0x7E, 0x6E, 0x6B, 0x3A, 0x28, 0x54, 0xFA, 0x85, 0xBA, 0x3D,
+  0xCA, 0x5E, 0x9B, 0x9F, 0x0A, 0x15, 0x79, 0x2B, 0x4E, 0xD4, 0xE5, 0xAC, 0x73, 0xF3, 0xA7, 0x57,
+  0x07, 0x70, 0xC0, 0xF7, 0x8C, 0x80, 0x63, 0x0D, 0x67, 0x4A, 0xDE, 0xED, 0x31, 0xC5, 0xFE, 0x18,
+  0xE3, 0xA5, 0x99, 0x77, 0x26, 0xB8, 0xB4, 0x7C, 0x11, 0x44, 0x92, 0xD9, 0x23, 0x20, 0x89, 0x2E,
+  0x37, 0x3F, 0xD1, 0x5B, 0x95, 0xBC, 0xCF, 0xCD, 0x90, 0x87, 0x97, 0xB2, 0xDC, 0xFC, 0xBE, 0x61,
+  0xF2, 0x56, 0xD3, 0xAB, 0x14, 0x2A, 0x5D, 0x9E, 0x84, 0x3C, 0x39, 0x53, 0x47, 0x6D, 0x41, 0xA2,
+  0x1F, 0x2D, 0x43, 0xD8, 0xB7, 0x7B, 0xA4, 0x76, 0xC4, 0x17, 0x49, 0xEC, 0x7F, 0x0C, 0x6F, 0xF6,
+  0x6C, 0xA1, 0x3B, 0x52, 0x29, 0x9D, 0x55, 0xAA, 0xFB, 0x60, 0x86, 0xB1, 0xBB, 0xCC, 0x3E, 0x5A,
+  0xCB, 0x59, 0x5F, 0xB0, 0x9C, 0xA9, 0xA0, 0x51, 0x0B, 0xF5, 0x16, 0xEB, 0x7A, 0x75, 0x2C, 0xD7,
+  0x4F, 0xAE, 0xD5, 0xE9, 0xE6, 0xE7, 0xAD, 0xE8, 0x74, 0xD6, 0xF4, 0xEA, 0xA8, 0x50, 0x58, 0xAF
+};
+
+// Generator polynomial of the last parity length used, highest power first
+static uint8_t generator[REED_SOLOMON_MAX_PARITY + 1];
+static uint8_t generator_parity = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void buildGenerator(uint8_t num_parity);
+static uint8_t gfMultiply(uint8_t a, uint8_t b);
+static uint8_t gfDivide(uint8_t a, uint8_t b);
+static uint8_t gfPower(uint16_t exponent);
+
+/* Exported function definitions ---------------------------------------------*/
+
+bool ReedSolomon_Encode(const uint8_t* data, uint16_t num_data, uint8_t num_parity, uint8_t* parity)
+{
+  if (num_parity == 0 || num_parity > REED_SOLOMON_MAX_PARITY ||
+      num_data + num_parity > REED_SOLOMON_MAX_LENGTH) {
+    return false;
+  }
+  buildGenerator(num_parity);
+
+  // Remainder of the data times x^num_parity divided by the generator, a
+  // byte at a time through a shift register
+  memset(parity, 0, num_parity);
+  for (uint16_t i = 0; i < num_data; i++) {
+    uint8_t feedback = data[i] ^ parity[0];
+    if (feedback == 0) {
+      memmove(parity, &parity[1], num_parity - 1);
+      parity[num_parity - 1] = 0;
+      continue;
+    }
+    uint8_t feedback_log = gf_log[feedback];
+    for (uint8_t j = 0; j + 1 < num_parity; j++) {
+      uint8_t coefficient = generator[j + 1];
+      parity[j] = parity[j + 1] ^ ((coefficient != 0) ? gf_exp[feedback_log + gf_log[coefficient]] : 0);
+    }
+    uint8_t coefficient = generator[num_parity];
+    parity[num_parity - 1] = (coefficient != 0) ? gf_exp[feedback_log + gf_log[coefficient]] : 0;
+  }
+  return true;
+}
+
+bool ReedSolomon_Decode(uint8_t* codeword, uint16_t length, uint8_t num_parity, uint8_t* num_corrected)
+{
+  *num_corrected = 0;
+  if (num_parity == 0 || num_parity > REED_SOLOMON_MAX_PARITY ||
+      length <= num_parity || length > REED_SOLOMON_MAX_LENGTH) {
+    return false;
+  }
+
+  // The codeword evaluated at each root of the generator, all zero when
+  // nothing is wrong
+  uint8_t syndromes[REED_SOLOMON_MAX_PARITY];
+  bool errors_found = false;
+  for (uint8_t j = 0; j < num_parity; j++) {
+    uint8_t root = gfPower(j);
+    uint8_t value = 0;
+    for (uint16_t i = 0; i < length; i++) {
+      value = gfMultiply(value, root) ^ codeword[i];
+    }
+    syndromes[j] = value;
+    errors_found |= (value != 0);
+  }
+  if (errors_found == false) {
+    return true;
+  }
+
+  // Berlekamp-Massey, the polynomials lowest power first
+  uint8_t locator[REED_SOLOMON_MAX_PARITY + 1] = {1};
+  uint8_t previous[REED_SOLOMON_MAX_PARITY + 1] = {1};
+  uint8_t saved[REED_SOLOMON_MAX_PARITY + 1];
+  uint8_t num_errors = 0;
+  uint8_t shift = 1;
+  uint8_t previous_discrepancy = 1;
+  for (uint8_t r = 0; r < num_parity; r++) {
+    uint8_t discrepancy = syndromes[r];
+    for (uint8_t i = 1; i <= num_errors; i++) {
+      discrepancy ^= gfMultiply(locator[i], syndromes[r - i]);
+    }
+    if (discrepancy == 0) {
+      shift++;
+      continue;
+    }
+
+    uint8_t scale = gfDivide(discrepancy, previous_discrepancy);
+    bool grow = (2 * num_errors <= r);
+    if (grow == true) {
+      memcpy(saved, locator, num_parity + 1);
+    }
+    for (uint8_t i = 0; i + shift <= num_parity; i++) {
+      locator[i + shift] ^= gfMultiply(scale, previous[i]);
+    }
+    if (grow == true) {
+      num_errors = r + 1 - num_errors;
+      memcpy(previous, saved, num_parity + 1);
+      previous_discrepancy = discrepancy;
+      shift = 1;
+    }
+    else {
+      shift++;
+    }
+  }
+  if (2 * num_errors > num_parity) {
+    return false;
+  }
+
+  // Chien search, byte i is in error when the locator has a root at the
+  // inverse of its position alpha^(length - 1 - i)
+  uint16_t positions[REED_SOLOMON_MAX_PARITY / 2];
+  uint8_t num_found = 0;
+  for (uint16_t i = 0; i < length; i++) {
+    uint8_t inverse = gfPower(GF_ORDER - (length - 1 - i));
+    uint8_t value = 0;
+    for (int16_t k = num_errors; k >= 0; k--) {
+      value = gfMultiply(value, inverse) ^ locator[k];
+    }
+    if (value == 0) {
+      if (num_found == num_errors) {
+        return false;
+      }
+      positions[num_found++] = i;
+    }
+  }
+  if (num_found != num_errors) {
+    return false;
+  }
+
+  // Forney, the error evaluator is the syndromes times the locator cut to
+  // num_parity terms
+  uint8_t evaluator[REED_SOLOMON_MAX_PARITY];
+  for (uint8_t k = 0; k < num_parity; k++) {
+    uint8_t value = 0;
+    for (uint8_t i = 0; i <= k && i <= num_errors; i++) {
+      value ^= gfMultiply(locator[i], syndromes[k - i]);
+    }
+    evaluator[k] = value;
+  }
+
+  uint8_t magnitudes[REED_SOLOMON_MAX_PARITY / 2];
+  for (uint8_t e = 0; e < num_found; e++) {
+    uint16_t power = length - 1 - positions[e];
+    uint8_t location = gfPower(power);
+    uint8_t inverse = gfPower(GF_ORDER - power);
+
+    uint8_t numerator = 0;
+    for (int16_t k = num_parity - 1; k >= 0; k--) {
+      numerator = gfMultiply(numerator, inverse) ^ evaluator[k];
+    }
+    // Formal derivative, only the odd powers remain in characteristic 2
+    uint8_t denominator = 0;
+    uint8_t inverse_squared = gfMultiply(inverse, inverse);
+    for (int16_t k = (num_errors - 1) | 1; k >= 1; k -= 2) {
+      denominator = gfMultiply(denominator, inverse_squared) ^ locator[k];
+    }
+    if (denominator == 0) {
+      return false;
+    }
+    magnitudes[e] = gfMultiply(location, gfDivide(numerator, denominator));
+  }
+
+  for (uint8_t e = 0; e < num_found; e++) {
+    codeword[positions[e]] ^= magnitudes[e];
+  }
+  *num_corrected = num_found;
+  return true;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// Product of (x - alpha^j) for j from 0 to num_parity - 1
+static void buildGenerator(uint8_t num_parity)
+{
+  if (generator_parity == num_parity) {
+    return;
+  }
+  memset(generator, 0, sizeof(generator));
+  generator[0] = 1;
+  for (uint8_t j = 0; j < num_parity; j++) {
+    uint8_t root = gfPower(j);
+    for (uint8_t i = j + 1; i > 0; i--) {
+      generator[i] ^= gfMultiply(root, generator[i - 1]);
+    }
+  }
+  generator_parity = num_parity;
+}
+
+static uint8_t gfMultiply(uint8_t a, uint8_t b)
+{
+  if (a == 0 || b == 0) {
+    return 0;
+  }
+  return gf_exp[gf_log[a] + gf_log[b]];
+}
+
+static uint8_t gfDivide(uint8_t a, uint8_t b)
+{
+  if (a == 0) {
+    return 0;
+  }
+  return gf_exp[gf_log[a] + GF_ORDER - gf_log[b]];
+}
+
+static uint8_t gfPower(uint16_t exponent)
+{
+  return gf_exp[exponent % GF_ORDER];
+}
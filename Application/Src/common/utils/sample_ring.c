@@ -0,0 +1,130 @@
+/*
+ * sample_ring.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "sample_ring.h"
+#include <stddef.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+
+
+/* Private macro -------------------------------------------------------------*/
+
+// The producer fills the buffer before publishing write_count and the
+// consumer is done with the samples before publishing read_count, so each
+// side loads the other's counter with acquire and stores its own with release
+#define LOAD_ACQUIRE(x)       __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(x, v)   __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#define LOAD_RELAXED(x)       __atomic_load_n(&(x), __ATOMIC_RELAXED)
+
+/* Private variables ---------------------------------------------------------*/
+
+
+
+/* Private function prototypes -----------------------------------------------*/
+
+
+
+/* Exported function definitions ---------------------------------------------*/
+
+bool SampleRing_Init(SampleRing_t* ring, uint16_t* buffer, uint32_t size, uint32_t write_ahead)
+{
+  if (ring == NULL || buffer == NULL) {
+    return false;
+  }
+  if (size == 0 || (size & (size - 1)) != 0 || write_ahead >= size) {
+    return false;
+  }
+
+  ring->buffer = buffer;
+  ring->mask = size - 1;
+  ring->capacity = size - write_ahead;
+  ring->overruns = 0;
+  ring->lost_samples = 0;
+  SampleRing_Reset(ring);
+  return true;
+}
+
+void SampleRing_Reset(SampleRing_t* ring)
+{
+  STORE_RELEASE(ring->write_count, 0);
+  STORE_RELEASE(ring->read_count, 0);
+}
+
+bool SampleRing_Commit(SampleRing_t* ring, uint32_t count)
+{
+  uint32_t read_count = LOAD_ACQUIRE(ring->read_count);
+  uint32_t unread_before = ring->write_count - read_count;
+  uint32_t write_count = ring->write_count + count;
+  STORE_RELEASE(ring->write_count, write_count);
+
+  uint32_t unread = write_count - read_count;
+  if (unread <= ring->capacity) {
+    return true;
+  }
+
+  // Only count the samples this commit destroyed, earlier ones already were
+  uint32_t lost_before = (unread_before > ring->capacity) ? (unread_before - ring->capacity) : 0;
+  if (lost_before == 0) {
+    ring->overruns++;
+  }
+  ring->lost_samples += unread - ring->capacity - lost_before;
+  return false;
+}
+
+uint32_t SampleRing_Available(const SampleRing_t* ring)
+{
+  return LOAD_ACQUIRE(ring->write_count) - ring->read_count;
+}
+
+bool SampleRing_Resync(SampleRing_t* ring)
+{
+  uint32_t write_count = LOAD_ACQUIRE(ring->write_count);
+  if (write_count - ring->read_count <= ring->capacity) {
+    return false;
+  }
+  STORE_RELEASE(ring->read_count, write_count - ring->capacity);
+  return true;
+}
+
+void SampleRing_Advance(SampleRing_t* ring, uint32_t count)
+{
+  STORE_RELEASE(ring->read_count, ring->read_count + count);
+}
+
+void SampleRing_SeekIndex(SampleRing_t* ring, uint32_t index)
+{
+  uint32_t forward = (index - ring->read_count) & ring->mask;
+  uint32_t read_count = ring->read_count + forward;
+  if (forward > ring->mask / 2) {
+    read_count -= ring->mask + 1;
+  }
+  STORE_RELEASE(ring->read_count, read_count);
+}
+
+uint32_t SampleRing_GetReadIndex(const SampleRing_t* ring)
+{
+  return ring->read_count & ring->mask;
+}
+
+uint32_t SampleRing_GetOverruns(const SampleRing_t* ring)
+{
+  return LOAD_RELAXED(ring->overruns);
+}
+
+uint32_t SampleRing_GetLostSamples(const SampleRing_t* ring)
+{
+  return LOAD_RELAXED(ring->lost_samples);
+}
+
+/* Private function definitions ----------------------------------------------*/
@@ -0,0 +1,88 @@
+/*
+ * slot_ring.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "slot_ring.h"
+#include <stddef.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+
+
+/* Private function prototypes -----------------------------------------------*/
+
+
+
+/* Exported function definitions ---------------------------------------------*/
+
+bool SlotRing_Init(SlotRing_t* ring, uint16_t* buffer, uint16_t buffer_size, uint16_t slot_size)
+{
+  if (ring == NULL || buffer == NULL || slot_size == 0) {
+    return false;
+  }
+  if (buffer_size == 0 || (buffer_size & (buffer_size - 1)) != 0 || buffer_size % slot_size != 0) {
+    return false;
+  }
+  if (buffer_size / slot_size <= SLOT_RING_DMA_SLOTS) {
+    return false;
+  }
+
+  ring->buffer = buffer;
+  ring->buffer_size = buffer_size;
+  ring->slot_size = slot_size;
+  ring->num_slots = buffer_size / slot_size;
+  SlotRing_Reset(ring);
+  return true;
+}
+
+void SlotRing_Reset(SlotRing_t* ring)
+{
+  ring->next_slot = SLOT_RING_DMA_SLOTS;
+  ring->write_index = 0;
+  ring->sample_count = 0;
+}
+
+uint16_t* SlotRing_GetSlot(const SlotRing_t* ring, uint16_t slot)
+{
+  return &ring->buffer[(slot % ring->num_slots) * ring->slot_size];
+}
+
+uint16_t* SlotRing_SlotComplete(SlotRing_t* ring)
+{
+  uint16_t* next = SlotRing_GetSlot(ring, ring->next_slot);
+  ring->next_slot = (ring->next_slot + 1) % ring->num_slots;
+
+  // Slot data is already in place, only the indices move
+  ring->write_index = (ring->write_index + ring->slot_size) & (ring->buffer_size - 1);
+  ring->sample_count += ring->slot_size;
+  return next;
+}
+
+uint16_t SlotRing_GetWriteIndex(const SlotRing_t* ring)
+{
+  return ring->write_index;
+}
+
+uint32_t SlotRing_GetSampleCount(const SlotRing_t* ring)
+{
+  return ring->sample_count;
+}
+
+/* Private function definitions ----------------------------------------------*/
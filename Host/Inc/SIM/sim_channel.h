@@ -0,0 +1,80 @@
+/*
+ * sim_channel.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef SIM_SIM_CHANNEL_H_
+#define SIM_SIM_CHANNEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef struct {
+  float gain;           // Voltage gain from DAC output to ADC input
+  float noise_rms;      // Standard deviation of the additive noise in ADC codes
+  uint32_t seed;        // Seed of the noise generator so runs are repeatable
+  uint32_t fade_period; // ADC samples from the start of one fade to the next, 0 for none
+  uint32_t fade_length; // ADC samples of each fade, which cut the signal but not the noise
+} SimChannelConfig_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+#define SIM_DAC_MIDSCALE      2048
+#define SIM_ADC_MAX_VALUE     4095
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Resets the channel state and applies a new configuration
+ *
+ * @param config Channel gain, noise level, noise seed and fades
+ */
+void SimChannel_Init(const SimChannelConfig_t* config);
+
+/**
+ * @brief Passes one DAC sample through the channel
+ *
+ * The DAC runs at DAC_SAMPLE_RATE and the ADC at ADC_SAMPLING_RATE so only some
+ * DAC samples complete an ADC conversion. Each ADC sample is the average of the
+ * DAC samples in its sampling period, which stands in for the anti-aliasing
+ * filter in front of the ADC.
+ *
+ * @param dac_sample 12-bit DAC code, SIM_DAC_MIDSCALE when the DAC is idle
+ * @param adc_sample Output for the 12-bit ADC code when one is produced
+ *
+ * @return true if an ADC sample was produced
+ */
+bool SimChannel_Step(uint16_t dac_sample, uint16_t* adc_sample);
+
+/**
+ * @brief Generates one zero-mean Gaussian sample from the channel noise source
+ *
+ * @return Sample with unit variance
+ */
+float SimChannel_Gaussian(void);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_SIM_CHANNEL_H_ */
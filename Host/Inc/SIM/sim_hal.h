@@ -0,0 +1,112 @@
+/*
+ * sim_hal.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+#ifndef SIM_SIM_HAL_H_
+#define SIM_SIM_HAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+#include <stdbool.h>
+
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+
+
+/* Exported constants --------------------------------------------------------*/
+
+
+
+/* Exported macro ------------------------------------------------------------*/
+
+extern ADC_HandleTypeDef hadc1;
+extern ADC_HandleTypeDef hadc3;
+extern DAC_HandleTypeDef hdac1;
+extern TIM_HandleTypeDef htim6;
+extern TIM_HandleTypeDef htim8;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief Emulates one DMA transfer from an ADC into its registered buffer
+ *
+ * Writes the sample at the current DMA position and raises the half/full
+ * transfer callbacks exactly where the circular DMA on the target would. In
+ * double-buffer mode the memory registers swap at the end of each transfer
+ * and the stream's transfer complete callback for the finished one is raised.
+ * Double-buffer targets must be static data, see dmaAddress in hal_shim.c.
+ *
+ * @param hadc ADC handle that the sample was converted on
+ * @param sample Raw 12-bit conversion result
+ *
+ * @return true if the ADC DMA was running and accepted the sample
+ */
+bool SimHal_AdcPushSample(ADC_HandleTypeDef* hadc, uint16_t sample);
+
+/**
+ * @brief Emulates one DMA transfer from the DAC buffer to a DAC channel
+ *
+ * Returns the sample at the current DMA position and raises the half/full
+ * transfer callbacks, which refill the buffer through dac_waveform.c.
+ *
+ * @param channel DAC_CHANNEL_1 or DAC_CHANNEL_2
+ * @param sample Output for the 12-bit DAC code that would be driven
+ *
+ * @return true if DMA was running on the channel and a sample was produced
+ */
+bool SimHal_DacPullSample(uint32_t channel, uint16_t* sample);
+
+/**
+ * @brief Checks if DMA output is active on a DAC channel
+ *
+ * @param channel DAC_CHANNEL_1 or DAC_CHANNEL_2
+ *
+ * @return true if HAL_DAC_Start_DMA was called and not yet stopped
+ */
+bool SimHal_IsDacRunning(uint32_t channel);
+
+/**
+ * @brief Registers the function that simulates the hardware for one kernel tick
+ *
+ * The RTOS shim calls the hook once per tick elapsed in osDelay, which is how
+ * simulated time advances while the MESS task waits. The hook is not re-entered
+ * if it calls osDelay itself.
+ *
+ * @param hook Function to run every tick, or NULL to disable
+ */
+void SimHal_SetTickHook(void (*hook)(void));
+
+/**
+ * @brief Returns how many times a task call that can block has returned
+ *
+ * Counts osDelay calls and blocking event flag waits made outside the tick
+ * hook, which on the target are the points where the task wakes up.
+ */
+uint32_t SimHal_GetTaskWakeups(void);
+
+/**
+ * @brief Returns the number of error routines raised by the application
+ *
+ * @return Count of Error_Routine calls since start-up
+ */
+uint32_t SimHal_GetErrorCount(void);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_SIM_HAL_H_ */
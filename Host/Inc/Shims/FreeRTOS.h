@@ -0,0 +1,57 @@
+/*
+ * FreeRTOS.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Host shim for the FreeRTOS base types used by the application.
+ */
+
+#ifndef __FREERTOS_SHIM_H_
+#define __FREERTOS_SHIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+#define pdFALSE           ((BaseType_t) 0)
+#define pdTRUE            ((BaseType_t) 1)
+#define pdPASS            (pdTRUE)
+#define pdFAIL            (pdFALSE)
+#define errQUEUE_EMPTY    ((BaseType_t) 0)
+#define errQUEUE_FULL     ((BaseType_t) 0)
+
+#define portMAX_DELAY     ((TickType_t) 0xFFFFFFFFUL)
+
+/* Exported macro ------------------------------------------------------------*/
+
+#define configASSERT(x)   ((void) 0)
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FREERTOS_SHIM_H_ */
@@ -0,0 +1,53 @@
+/*
+ * arm_const_structs.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Host shim for the CMSIS-DSP constant FFT instances.
+ */
+
+#ifndef __ARM_CONST_STRUCTS_SHIM_H_
+#define __ARM_CONST_STRUCTS_SHIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+
+
+/* Exported constants --------------------------------------------------------*/
+
+
+
+/* Exported macro ------------------------------------------------------------*/
+
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len16;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len32;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len64;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len128;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len256;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len512;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ARM_CONST_STRUCTS_SHIM_H_ */
@@ -0,0 +1,92 @@
+/*
+ * arm_math.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Host shim for the CMSIS-DSP functions used by the application. Signatures
+ *  and data layouts (including the packed RFFT output format) match CMSIS-DSP
+ *  so results are comparable with the target, but the implementations are
+ *  plain C and not tuned for speed.
+ */
+
+#ifndef __ARM_MATH_SHIM_H_
+#define __ARM_MATH_SHIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <math.h>
+
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef float float32_t;
+
+typedef enum {
+  ARM_MATH_SUCCESS        =  0,
+  ARM_MATH_ARGUMENT_ERROR = -1,
+  ARM_MATH_LENGTH_ERROR   = -2,
+  ARM_MATH_SIZE_MISMATCH  = -3,
+  ARM_MATH_NANINF         = -4,
+  ARM_MATH_SINGULAR       = -5,
+  ARM_MATH_TEST_FAILURE   = -6
+} arm_status;
+
+typedef struct {
+  uint16_t fftLen;
+  const float32_t* pTwiddle;
+  const uint16_t* pBitRevTable;
+  uint16_t bitRevLength;
+} arm_cfft_instance_f32;
+
+typedef struct {
+  arm_cfft_instance_f32 Sint;
+  uint16_t fftLenRFFT;
+  const float32_t* pTwiddleRFFT;
+} arm_rfft_fast_instance_f32;
+
+/* Exported constants --------------------------------------------------------*/
+
+#ifndef PI
+#define PI                3.14159265358979f
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32* S, uint16_t fftLen);
+arm_status arm_rfft_64_fast_init_f32(arm_rfft_fast_instance_f32* S);
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32* S, float32_t* p, float32_t* pOut, uint8_t ifftFlag);
+
+void arm_cfft_f32(const arm_cfft_instance_f32* S, float32_t* p1, uint8_t ifftFlag, uint8_t bitReverseFlag);
+
+void arm_cmplx_mag_squared_f32(const float32_t* pSrc, float32_t* pDst, uint32_t numSamples);
+void arm_cmplx_mult_cmplx_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t numSamples);
+void arm_cmplx_conj_f32(const float32_t* pSrc, float32_t* pDst, uint32_t numSamples);
+
+void arm_mean_f32(const float32_t* pSrc, uint32_t blockSize, float32_t* pResult);
+void arm_max_f32(const float32_t* pSrc, uint32_t blockSize, float32_t* pResult, uint32_t* pIndex);
+void arm_dot_prod_f32(const float32_t* pSrcA, const float32_t* pSrcB, uint32_t blockSize, float32_t* result);
+
+float32_t arm_sin_f32(float32_t x);
+float32_t arm_cos_f32(float32_t x);
+arm_status arm_sqrt_f32(float32_t in, float32_t* pOut);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ARM_MATH_SHIM_H_ */
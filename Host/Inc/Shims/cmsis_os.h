@@ -0,0 +1,116 @@
+/*
+ * cmsis_os.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Host shim for the CMSIS-RTOS2 calls used by the application. The host
+ *  build is single threaded, so mutexes always succeed and osDelay simply
+ *  advances the simulated kernel tick.
+ */
+
+#ifndef __CMSIS_OS_SHIM_H_
+#define __CMSIS_OS_SHIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "FreeRTOS.h"
+#include <stdint.h>
+#include <stddef.h>
+
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef enum {
+  osOK              =  0,
+  osError           = -1,
+  osErrorTimeout    = -2,
+  osErrorResource   = -3,
+  osErrorParameter  = -4,
+  osErrorNoMemory   = -5,
+  osErrorISR        = -6
+} osStatus_t;
+
+typedef void* osThreadId_t;
+typedef void* osEventFlagsId_t;
+typedef void* osMutexId_t;
+typedef void* osSemaphoreId_t;
+
+typedef struct {
+  const char* name;
+  uint32_t attr_bits;
+  void* cb_mem;
+  uint32_t cb_size;
+} osEventFlagsAttr_t;
+
+typedef struct {
+  const char* name;
+  uint32_t attr_bits;
+  void* cb_mem;
+  uint32_t cb_size;
+} osMutexAttr_t;
+
+typedef struct {
+  const char* name;
+  uint32_t attr_bits;
+  void* cb_mem;
+  uint32_t cb_size;
+} osSemaphoreAttr_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+#define osWaitForever         0xFFFFFFFFU
+
+#define osFlagsWaitAny        0x00000000U
+#define osFlagsWaitAll        0x00000001U
+#define osFlagsNoClear        0x00000002U
+
+#define osFlagsError          0x80000000U
+#define osFlagsErrorUnknown   0xFFFFFFFFU
+#define osFlagsErrorTimeout   0xFFFFFFFEU
+#define osFlagsErrorResource  0xFFFFFFFDU
+#define osFlagsErrorParameter 0xFFFFFFFCU
+
+#define osMutexRecursive      0x00000001U
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+osStatus_t osDelay(uint32_t ticks);
+uint32_t osKernelGetTickCount(void);
+
+osThreadId_t osThreadGetId(void);
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags);
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout);
+
+osEventFlagsId_t osEventFlagsNew(const osEventFlagsAttr_t* attr);
+uint32_t osEventFlagsSet(osEventFlagsId_t ef_id, uint32_t flags);
+uint32_t osEventFlagsClear(osEventFlagsId_t ef_id, uint32_t flags);
+uint32_t osEventFlagsGet(osEventFlagsId_t ef_id);
+uint32_t osEventFlagsWait(osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout);
+
+osMutexId_t osMutexNew(const osMutexAttr_t* attr);
+osStatus_t osMutexAcquire(osMutexId_t mutex_id, uint32_t timeout);
+osStatus_t osMutexRelease(osMutexId_t mutex_id);
+
+osSemaphoreId_t osSemaphoreNew(uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t* attr);
+osStatus_t osSemaphoreAcquire(osSemaphoreId_t semaphore_id, uint32_t timeout);
+osStatus_t osSemaphoreRelease(osSemaphoreId_t semaphore_id);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CMSIS_OS_SHIM_H_ */
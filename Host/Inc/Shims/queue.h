@@ -0,0 +1,57 @@
+/*
+ * queue.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Host shim for the FreeRTOS queue API. Queues are fixed size copy-in/copy-out
+ *  rings; the host build never blocks so timeouts are ignored.
+ */
+
+#ifndef __QUEUE_SHIM_H_
+#define __QUEUE_SHIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "FreeRTOS.h"
+
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef struct QueueDefinition* QueueHandle_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+
+
+/* Exported macro ------------------------------------------------------------*/
+
+#define xQueueSend(xQueue, pvItemToQueue, xTicksToWait) \
+  xQueueSendToBack((xQueue), (pvItemToQueue), (xTicksToWait))
+
+#define xQueueSendFromISR(xQueue, pvItemToQueue, pxHigherPriorityTaskWoken) \
+  xQueueSendToBack((xQueue), (pvItemToQueue), 0)
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize);
+void vQueueDelete(QueueHandle_t xQueue);
+BaseType_t xQueueSendToBack(QueueHandle_t xQueue, const void* pvItemToQueue, TickType_t xTicksToWait);
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void* pvBuffer, TickType_t xTicksToWait);
+BaseType_t xQueuePeek(QueueHandle_t xQueue, void* pvBuffer, TickType_t xTicksToWait);
+UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t xQueue);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __QUEUE_SHIM_H_ */
@@ -0,0 +1,197 @@
+/*
+ * stm32h7xx_hal.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Host shim for the subset of the STM32H7 HAL used by the MESS pipeline.
+ *  Peripheral handles are plain structs and DMA transfers are emulated by
+ *  sim_hal.c so the application sources compile unchanged on Linux.
+ */
+
+#ifndef __STM32H7xx_HAL_SHIM_H_
+#define __STM32H7xx_HAL_SHIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+
+/* Private includes ----------------------------------------------------------*/
+
+
+
+/* Exported types ------------------------------------------------------------*/
+
+typedef enum {
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum {
+  GPIO_PIN_RESET = 0U,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct {
+  uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef enum {
+  MEMORY0 = 0x00U,
+  MEMORY1 = 0x01U
+} HAL_DMA_MemoryTypeDef;
+
+typedef struct __DMA_HandleTypeDef {
+  uint32_t instance;
+  void* Parent;
+  void (*XferCpltCallback)(struct __DMA_HandleTypeDef* hdma);
+  void (*XferHalfCpltCallback)(struct __DMA_HandleTypeDef* hdma);
+  void (*XferM1CpltCallback)(struct __DMA_HandleTypeDef* hdma);
+  void (*XferM1HalfCpltCallback)(struct __DMA_HandleTypeDef* hdma);
+  void (*XferErrorCallback)(struct __DMA_HandleTypeDef* hdma);
+} DMA_HandleTypeDef;
+
+typedef struct {
+  uint32_t ISR;
+  uint32_t IER;
+  uint32_t DR;
+  uint32_t CFGR;
+} ADC_TypeDef;
+
+typedef struct {
+  uint32_t ConversionDataManagement;
+  uint32_t DMAContinuousRequests;
+} ADC_InitTypeDef;
+
+typedef struct {
+  uint32_t instance;
+  ADC_TypeDef* Instance;
+  ADC_InitTypeDef Init;
+  DMA_HandleTypeDef* DMA_Handle;
+  uint32_t ErrorCode;
+} ADC_HandleTypeDef;
+
+typedef struct {
+  uint32_t instance;
+  uint32_t ErrorCode;
+  DMA_HandleTypeDef* DMA_Handle1;
+  DMA_HandleTypeDef* DMA_Handle2;
+} DAC_HandleTypeDef;
+
+typedef struct {
+  uint32_t instance;
+} TIM_HandleTypeDef;
+
+typedef enum {
+  EXTI2_IRQn = 8
+} IRQn_Type;
+
+/* Exported constants --------------------------------------------------------*/
+
+#define GPIO_PIN_0          ((uint16_t)0x0001)
+#define GPIO_PIN_1          ((uint16_t)0x0002)
+#define GPIO_PIN_2          ((uint16_t)0x0004)
+#define GPIO_PIN_3          ((uint16_t)0x0008)
+#define GPIO_PIN_4          ((uint16_t)0x0010)
+#define GPIO_PIN_5          ((uint16_t)0x0020)
+#define GPIO_PIN_6          ((uint16_t)0x0040)
+#define GPIO_PIN_7          ((uint16_t)0x0080)
+#define GPIO_PIN_8          ((uint16_t)0x0100)
+#define GPIO_PIN_9          ((uint16_t)0x0200)
+#define GPIO_PIN_10         ((uint16_t)0x0400)
+#define GPIO_PIN_11         ((uint16_t)0x0800)
+#define GPIO_PIN_12         ((uint16_t)0x1000)
+#define GPIO_PIN_13         ((uint16_t)0x2000)
+#define GPIO_PIN_14         ((uint16_t)0x4000)
+#define GPIO_PIN_15         ((uint16_t)0x8000)
+
+#define DAC_CHANNEL_1       0x00000000U
+#define DAC_CHANNEL_2       0x00000010U
+#define DAC_ALIGN_12B_R     0x00000000U
+
+#define HAL_MAX_DELAY       0xFFFFFFFFU
+
+#define ADC_FLAG_OVR        0x00000010U
+#define ADC_IT_OVR          0x00000010U
+#define HAL_ADC_ERROR_OVR   0x02U
+#define HAL_ADC_ERROR_DMA   0x04U
+
+#define __weak              __attribute__((weak))
+
+/* Exported macro ------------------------------------------------------------*/
+
+extern GPIO_TypeDef sim_gpio_ports[5];
+extern ADC_TypeDef sim_adc_registers[2];
+
+#define GPIOA               (&sim_gpio_ports[0])
+#define GPIOB               (&sim_gpio_ports[1])
+#define GPIOC               (&sim_gpio_ports[2])
+#define GPIOD               (&sim_gpio_ports[3])
+#define GPIOE               (&sim_gpio_ports[4])
+
+#define ADC1                (&sim_adc_registers[0])
+#define ADC3                (&sim_adc_registers[1])
+
+#define UNUSED(X)           (void)X
+
+// The flags are cleared by writing 1 on the target, the shim clears them directly
+#define __HAL_ADC_CLEAR_FLAG(__HANDLE__, __FLAG__)      (((__HANDLE__)->Instance->ISR) &= ~(__FLAG__))
+#define __HAL_ADC_ENABLE_IT(__HANDLE__, __INTERRUPT__)  (((__HANDLE__)->Instance->IER) |= (__INTERRUPT__))
+#define __HAL_ADC_DISABLE_IT(__HANDLE__, __INTERRUPT__) (((__HANDLE__)->Instance->IER) &= ~(__INTERRUPT__))
+
+// The input ADC is ADC3 on the target, which the HAL configures separately
+#define ADC_VER_V5_V90
+#define ADC3_CFGR_DMACONTREQ(__DMACONTREQ_MODE__) ((__DMACONTREQ_MODE__) << 1)
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+uint32_t HAL_GetTick(void);
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef* htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef* htim);
+
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef* hadc);
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef* hadc, uint32_t* pData, uint32_t Length);
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef* hadc);
+void LL_ADC_REG_SetDMATransferMode(ADC_TypeDef* ADCx, uint32_t DMATransfer);
+void LL_ADC_EnableDMAReq(ADC_TypeDef* ADCx);
+void LL_ADC_REG_SetDataTransferMode(ADC_TypeDef* ADCx, uint32_t DataTransferMode);
+void ADC_DMAError(DMA_HandleTypeDef* hdma);
+
+HAL_StatusTypeDef HAL_DMAEx_MultiBufferStart_IT(DMA_HandleTypeDef* hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                                uint32_t SecondMemAddress, uint32_t DataLength);
+HAL_StatusTypeDef HAL_DMAEx_ChangeMemory(DMA_HandleTypeDef* hdma, uint32_t Address, HAL_DMA_MemoryTypeDef memory);
+
+HAL_StatusTypeDef HAL_DAC_Start(DAC_HandleTypeDef* hdac, uint32_t Channel);
+HAL_StatusTypeDef HAL_DAC_Stop(DAC_HandleTypeDef* hdac, uint32_t Channel);
+HAL_StatusTypeDef HAL_DAC_SetValue(DAC_HandleTypeDef* hdac, uint32_t Channel, uint32_t Alignment, uint32_t Data);
+HAL_StatusTypeDef HAL_DAC_Start_DMA(DAC_HandleTypeDef* hdac, uint32_t Channel, const uint32_t* pData,
+                                    uint32_t Length, uint32_t Alignment);
+HAL_StatusTypeDef HAL_DAC_Stop_DMA(DAC_HandleTypeDef* hdac, uint32_t Channel);
+
+// Weak callbacks implemented by the application
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef* hadc);
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc);
+void HAL_ADC_ErrorCallback(ADC_HandleTypeDef* hadc);
+void HAL_DAC_ConvHalfCpltCallbackCh1(DAC_HandleTypeDef* hdac);
+void HAL_DAC_ConvCpltCallbackCh1(DAC_HandleTypeDef* hdac);
+void HAL_DACEx_ConvHalfCpltCallbackCh2(DAC_HandleTypeDef* hdac);
+void HAL_DACEx_ConvCpltCallbackCh2(DAC_HandleTypeDef* hdac);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32H7xx_HAL_SHIM_H_ */
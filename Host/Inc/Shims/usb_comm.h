@@ -0,0 +1,53 @@
+/*
+ * usb_comm.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Host shim shadowing Application/Inc/drivers/usb_comm.h. USB CDC output is
+ *  redirected to stdout so debug dumps remain visible on the host.
+ */
+
+#ifndef __USB_COMM_H_
+#define __USB_COMM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "cmsis_os.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private includes ----------------------------------------------------------*/
+
+extern osSemaphoreId_t usbSemaphoreHandle;
+
+/* Exported types ------------------------------------------------------------*/
+
+
+
+/* Exported constants --------------------------------------------------------*/
+
+
+
+/* Exported macro ------------------------------------------------------------*/
+
+
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+uint8_t CDC_Transmit_HS(uint8_t* Buf, uint16_t Len);
+
+/* Private defines -----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USB_COMM_H_ */
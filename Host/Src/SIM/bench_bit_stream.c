@@ -0,0 +1,222 @@
+/*
+ * bench_bit_stream.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Measures the word at a time bit packing against the original one bit at a
+ *  time loops. BitStream_Write and BitStream_Read must match a per-bit
+ *  reference for every start offset and length, leaving the bits around
+ *  the ones written untouched. Packets built with Packet_AddBits must then
+ *  hold the same bits as ones built with Packet_AddBit, and read
+ *  back the same through Packet_GetBits. Filling a full payload is timed
+ *  with each.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "bit_stream.h"
+#include "mess_packet.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define BUFFER_BYTES        48
+#define MAX_OFFSET          16
+#define MAX_BITS            ((BUFFER_BYTES - 4) * 8 - MAX_OFFSET)
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint8_t source[BUFFER_BYTES];
+static uint8_t background[BUFFER_BYTES];
+static uint8_t payload[PACKET_DATA_MAX_LENGTH_BYTES];
+static BitMessage_t word_msg;
+static BitMessage_t bit_msg;
+static uint32_t iterations = 20000;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool checkStream(void);
+static bool checkPacket(void);
+static void benchPayload(void);
+static bool fillPerBit(BitMessage_t* msg, const uint8_t* data, uint16_t num_bits);
+static bool getBit(const uint8_t* data, uint32_t position);
+static void setBit(uint8_t* data, uint32_t position, bool bit);
+static uint32_t nextRandom(void);
+static double now(void);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(int argc, char** argv)
+{
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--iterations") == 0) {
+      iterations = (uint32_t) strtoul(argv[i + 1], NULL, 0);
+    }
+    else {
+      fprintf(stderr, "usage: %s [--iterations N]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  for (uint16_t i = 0; i < BUFFER_BYTES; i++) {
+    source[i] = (uint8_t) (nextRandom() >> 24);
+    background[i] = (uint8_t) (nextRandom() >> 24);
+  }
+  for (uint16_t i = 0; i < PACKET_DATA_MAX_LENGTH_BYTES; i++) {
+    payload[i] = (uint8_t) (nextRandom() >> 24);
+  }
+
+  bool passed = checkStream();
+  if (checkPacket() == false) {
+    passed = false;
+  }
+  benchPayload();
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// Every offset into both buffers against every length, on top of random bits
+// that must survive
+static bool checkStream(void)
+{
+  uint8_t actual[BUFFER_BYTES];
+  uint8_t expected[BUFFER_BYTES];
+  uint32_t mismatches = 0;
+  for (uint32_t offset = 0; offset < MAX_OFFSET; offset++) {
+    for (uint32_t bits = 0; bits <= MAX_BITS; bits++) {
+      memcpy(actual, background, BUFFER_BYTES);
+      memcpy(expected, background, BUFFER_BYTES);
+      BitStream_Write(actual, offset, source, bits);
+      for (uint32_t i = 0; i < bits; i++) {
+        setBit(expected, offset + i, getBit(source, i));
+      }
+      if (memcmp(actual, expected, BUFFER_BYTES) != 0 && mismatches++ < 10) {
+        printf("write of %u bits at %u differs\n", bits, offset);
+      }
+
+      memcpy(actual, background, BUFFER_BYTES);
+      memset(expected, 0, BUFFER_BYTES);
+      memcpy(&expected[(bits + 7) / 8], &background[(bits + 7) / 8], BUFFER_BYTES - (bits + 7) / 8);
+      BitStream_Read(source, offset, actual, bits);
+      for (uint32_t i = 0; i < bits; i++) {
+        setBit(expected, i, getBit(source, offset + i));
+      }
+      if (memcmp(actual, expected, BUFFER_BYTES) != 0 && mismatches++ < 10) {
+        printf("read of %u bits at %u differs\n", bits, offset);
+      }
+    }
+  }
+  printf("offsets 0 to %u, lengths 0 to %u bits: %u mismatches\n", MAX_OFFSET - 1, MAX_BITS, mismatches);
+  return mismatches == 0;
+}
+
+// Chunks of every length from 1 to 40 bits added one after another, so
+// they start at every offset into a byte
+static bool checkPacket(void)
+{
+  Packet_PrepareRx(&word_msg, NULL);
+  Packet_PrepareRx(&bit_msg, NULL);
+  uint16_t position = 0;
+  bool passed = true;
+  for (uint16_t bits = 1; bits <= 40 && passed == true; bits++) {
+    uint16_t start = (uint16_t) (nextRandom() % (PACKET_DATA_MAX_LENGTH_BITS - bits));
+    uint8_t chunk[8];
+    uint8_t read_back[8];
+    BitStream_Read(payload, start, chunk, bits);
+    if (Packet_AddBits(&word_msg, chunk, bits) == false || fillPerBit(&bit_msg, chunk, bits) == false ||
+        Packet_GetBits(&word_msg, &position, bits, read_back) == false ||
+        memcmp(chunk, read_back, (bits + 7) / 8) != 0) {
+      passed = false;
+    }
+  }
+
+  if (word_msg.bit_count != bit_msg.bit_count || memcmp(word_msg.data, bit_msg.data, sizeof(bit_msg.data)) != 0) {
+    passed = false;
+  }
+
+  // Neither may go past the packet or the bits in it
+  uint8_t spare[PACKET_MAX_LENGTH_BYTES] = {0};
+  if (Packet_AddBits(&word_msg, spare, PACKET_MAX_LENGTH_BITS - word_msg.bit_count + 1) == true ||
+      Packet_GetBits(&word_msg, &position, 1, spare) == true || position != word_msg.bit_count) {
+    passed = false;
+  }
+  printf("packet bits %s\n", (passed == true) ? "match" : "DIFFER");
+  return passed;
+}
+
+static void benchPayload(void)
+{
+  const uint16_t num_bits = PACKET_DATA_MAX_LENGTH_BITS;
+  double seconds[2];
+  for (uint8_t word = 0; word < 2; word++) {
+    double start = now();
+    for (uint32_t it = 0; it < iterations; it++) {
+      Packet_PrepareRx(&bit_msg, NULL);
+      if (word != 0) {
+        Packet_AddBits(&bit_msg, payload, num_bits);
+      }
+      else {
+        fillPerBit(&bit_msg, payload, num_bits);
+      }
+    }
+    seconds[word] = now() - start;
+  }
+
+  double megabytes = (double) iterations * num_bits / 8.0 / 1e6;
+  printf("%8s %14s %14s %8s\n", "bytes", "per bit MB/s", "word MB/s", "speedup");
+  printf("%8u %14.1f %14.1f %7.1fx\n", num_bits / 8, megabytes / seconds[0], megabytes / seconds[1],
+         seconds[0] / seconds[1]);
+}
+
+static bool fillPerBit(BitMessage_t* msg, const uint8_t* data, uint16_t num_bits)
+{
+  for (uint16_t i = 0; i < num_bits; i++) {
+    if (Packet_AddBit(msg, getBit(data, i)) == false) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool getBit(const uint8_t* data, uint32_t position)
+{
+  return (data[position / 8] & (1 << (7 - position % 8))) != 0;
+}
+
+static void setBit(uint8_t* data, uint32_t position, bool bit)
+{
+  if (bit == true) {
+    data[position / 8] |= (1 << (7 - position % 8));
+  }
+  else {
+    data[position / 8] &= ~(1 << (7 - position % 8));
+  }
+}
+
+static uint32_t nextRandom(void)
+{
+  static uint32_t seed = 1;
+  seed = seed * 1664525u + 1013904223u;
+  return seed;
+}
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
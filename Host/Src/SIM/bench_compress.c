@@ -0,0 +1,209 @@
+/*
+ * bench_compress.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Compresses messages like the modem sends, from short status strings to
+ *  full payloads of telemetry, plus English text and random bytes that
+ *  can't be compressed. Each must decompress back to what was sent. Prints
+ *  the size of each, compressed and not, and the bits its packet takes in
+ *  each format with CRC-16, then the time to compress and decompress it.
+ *  Random and corrupted streams are decoded last, which must be refused or
+ *  decode without going out of bounds.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "compress.h"
+#include "mess_main.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define CRC_BITS            16
+#define NUM_CORRUPTIONS     20000
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char* messages[] = {
+  "status=OK",
+  "ack,seq=118",
+  "id=2,t=5130,depth=42.7,temp=11.38,bat=3.87,status=OK;",
+  "id=2,seq=40,t=5130,depth=42.7,temp=11.38,bat=3.87,status=OK;"
+  "id=2,seq=41,t=5190,depth=42.9,temp=11.35,bat=3.87,status=OK;",
+  "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47",
+  "node=3,warning,bat=3.41,pressure=1013.2,salinity=34.81,current=0.12",
+  "The quick brown fox jumps over the lazy dog near the buoy at dawn.",
+};
+
+static uint32_t iterations = 2000;
+static uint32_t seed = 1;
+static uint8_t random_bytes[PACKET_DATA_MAX_LENGTH_BYTES];
+static uint8_t compressed[COMPRESS_MAX_OUTPUT(PACKET_DATA_MAX_LENGTH_BYTES)];
+static uint8_t decompressed[PACKET_DATA_MAX_LENGTH_BYTES];
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool benchMessage(const char* name, const uint8_t* data, uint16_t length);
+static bool checkCorrupted(void);
+static uint32_t packetBits(uint16_t payload_bytes, bool byte_exact);
+static uint32_t nextRandom(void);
+static double now(void);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(int argc, char** argv)
+{
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--iterations") == 0) {
+      iterations = (uint32_t) strtoul(argv[i + 1], NULL, 0);
+    }
+    else {
+      fprintf(stderr, "usage: %s [--iterations N]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  printf("%-10s %5s %5s %6s %7s %7s %7s %7s %9s %9s\n", "message", "bytes", "comp", "ratio",
+         "pow2", "pow2 c", "exact", "exact c", "enc ns/B", "dec ns/B");
+  bool passed = true;
+  for (uint8_t m = 0; m < sizeof(messages) / sizeof(messages[0]); m++) {
+    char name[16];
+    snprintf(name, sizeof(name), "text %u", m);
+    if (benchMessage(name, (const uint8_t*) messages[m], (uint16_t) strlen(messages[m])) == false) {
+      passed = false;
+    }
+  }
+  for (uint16_t i = 0; i < sizeof(random_bytes); i++) {
+    random_bytes[i] = (uint8_t) nextRandom();
+  }
+  if (benchMessage("random", random_bytes, sizeof(random_bytes)) == false) {
+    passed = false;
+  }
+
+  if (checkCorrupted() == false) {
+    passed = false;
+  }
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static bool benchMessage(const char* name, const uint8_t* data, uint16_t length)
+{
+  uint16_t compressed_bytes = 0;
+  uint16_t decompressed_bytes = 0;
+  if (Compress_Encode(data, length, compressed, sizeof(compressed), &compressed_bytes) == false ||
+      Compress_Decode(compressed, compressed_bytes, decompressed, sizeof(decompressed),
+                      &decompressed_bytes) == false ||
+      decompressed_bytes != length || memcmp(decompressed, data, length) != 0) {
+    printf("%s FAILED to round trip\n", name);
+    return false;
+  }
+
+  volatile uint32_t sink = 0;
+  double start = now();
+  for (uint32_t it = 0; it < iterations; it++) {
+    Compress_Encode(data, length, compressed, sizeof(compressed), &compressed_bytes);
+    sink ^= compressed[compressed_bytes - 1];
+  }
+  double encode_seconds = now() - start;
+  start = now();
+  for (uint32_t it = 0; it < iterations; it++) {
+    Compress_Decode(compressed, compressed_bytes, decompressed, sizeof(decompressed),
+                    &decompressed_bytes);
+    sink ^= decompressed[decompressed_bytes - 1];
+  }
+  double decode_seconds = now() - start;
+  (void) sink;
+
+  // The packet falls back to the original when compressing doesn't help
+  uint32_t pow2 = packetBits(length, false);
+  uint32_t exact = packetBits(length, true);
+  uint32_t pow2_compressed = packetBits(compressed_bytes, false);
+  uint32_t exact_compressed = packetBits(compressed_bytes, true);
+  printf("%-10s %5u %5u %6.2f %7u %7u %7u %7u %9.1f %9.1f\n", name, length, compressed_bytes,
+         (double) length / compressed_bytes, pow2, (pow2_compressed < pow2) ? pow2_compressed : pow2,
+         exact, (exact_compressed < exact) ? exact_compressed : exact,
+         encode_seconds * 1e9 / iterations / length, decode_seconds * 1e9 / iterations / length);
+  return true;
+}
+
+// Flips bits of a valid stream, or makes one up, and decodes it. Either is
+// fine as long as it stays in bounds, which the sanitizer builds check.
+static bool checkCorrupted(void)
+{
+  const uint8_t* data = (const uint8_t*) messages[3];
+  uint16_t length = (uint16_t) strlen(messages[3]);
+  uint16_t valid_bytes;
+  uint8_t stream[sizeof(compressed)];
+  Compress_Encode(data, length, stream, sizeof(stream), &valid_bytes);
+
+  uint32_t refused = 0;
+  for (uint32_t trial = 0; trial < NUM_CORRUPTIONS; trial++) {
+    uint16_t stream_bytes = valid_bytes;
+    if (trial % 2 == 0) {
+      Compress_Encode(data, length, compressed, sizeof(compressed), &stream_bytes);
+      compressed[nextRandom() % stream_bytes] ^= (uint8_t) (1 << (nextRandom() % 8));
+    }
+    else {
+      stream_bytes = 1 + nextRandom() % sizeof(compressed);
+      for (uint16_t i = 0; i < stream_bytes; i++) {
+        compressed[i] = (uint8_t) nextRandom();
+      }
+    }
+    uint16_t decompressed_bytes = 0;
+    if (Compress_Decode(compressed, stream_bytes, decompressed, sizeof(decompressed),
+                        &decompressed_bytes) == false) {
+      refused++;
+    }
+    else if (decompressed_bytes > sizeof(decompressed)) {
+      printf("corrupted stream decoded to %u bytes\n", decompressed_bytes);
+      return false;
+    }
+  }
+  printf("%u corrupted and random streams: %u refused\n", NUM_CORRUPTIONS, refused);
+  return true;
+}
+
+static uint32_t packetBits(uint16_t payload_bytes, bool byte_exact)
+{
+  uint32_t bits = PACKET_PREAMBLE_LENGTH_BITS + CRC_BITS;
+  if (byte_exact == true) {
+    if (payload_bytes > (1 << PACKET_LENGTH_BITS) - 1) {
+      bits += PACKET_LENGTH_EXTENSION_BITS;
+    }
+    return bits + 8 * payload_bytes;
+  }
+  uint32_t padded = 1;
+  while (padded < payload_bytes) {
+    padded *= 2;
+  }
+  return bits + 8 * padded;
+}
+
+static uint32_t nextRandom(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,251 @@
+/*
+ * bench_crc.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Measures the table driven CRCs against the original bit at a time loops
+ *  of mess_error_correction.c, kept here as the reference. Every length from
+ *  0 to a full packet, partial last bytes included, must give the same CRC
+ *  as the reference for several random messages. Whole packets are then
+ *  timed with each. Built once per table configuration, see CMakeLists.txt.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "crc.h"
+#include "mess_main.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define NUM_MESSAGES        8
+#define MAX_BITS            (PACKET_MAX_LENGTH_BYTES * 8)
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint8_t messages[NUM_MESSAGES][PACKET_MAX_LENGTH_BYTES];
+static uint32_t iterations = 20000;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool checkLengths(void);
+static void benchWidth(uint8_t width);
+static uint8_t referenceCrc8(const uint8_t* data, uint16_t num_bits);
+static uint16_t referenceCrc16(const uint8_t* data, uint16_t num_bits);
+static uint32_t referenceCrc32(const uint8_t* data, uint16_t num_bits);
+static uint32_t calculate(uint8_t width, bool reference, const uint8_t* data, uint16_t num_bits);
+static double now(void);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(int argc, char** argv)
+{
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--iterations") == 0) {
+      iterations = (uint32_t) strtoul(argv[i + 1], NULL, 0);
+    }
+    else {
+      fprintf(stderr, "usage: %s [--iterations N]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  uint32_t seed = 1;
+  for (uint8_t m = 0; m < NUM_MESSAGES; m++) {
+    for (uint16_t i = 0; i < PACKET_MAX_LENGTH_BYTES; i++) {
+      seed = seed * 1664525u + 1013904223u;
+      messages[m][i] = (uint8_t) (seed >> 24);
+    }
+  }
+
+  printf("nibble_tables=%d crc32_slices=%d\n", CRC_NIBBLE_TABLES, CRC32_SLICES);
+  bool passed = checkLengths();
+
+  printf("%-6s %8s %14s %14s %8s\n", "width", "bytes", "bitwise MB/s", "table MB/s", "speedup");
+  benchWidth(8);
+  benchWidth(16);
+  benchWidth(32);
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static bool checkLengths(void)
+{
+  const uint8_t widths[] = {8, 16, 32};
+  uint32_t mismatches = 0;
+  for (uint8_t w = 0; w < sizeof(widths); w++) {
+    for (uint8_t m = 0; m < NUM_MESSAGES; m++) {
+      for (uint16_t bits = 0; bits <= MAX_BITS; bits++) {
+        uint32_t expected = calculate(widths[w], true, messages[m], bits);
+        uint32_t actual = calculate(widths[w], false, messages[m], bits);
+        if (actual != expected && mismatches++ < 10) {
+          printf("CRC-%u of %u bits: 0x%08X, expected 0x%08X\n", widths[w], bits, actual, expected);
+        }
+      }
+    }
+  }
+  printf("lengths 0 to %u bits: %u mismatches\n", MAX_BITS, mismatches);
+  return mismatches == 0;
+}
+
+static void benchWidth(uint8_t width)
+{
+  const uint16_t num_bits = PACKET_MAX_LENGTH_BITS - width;
+  volatile uint32_t sink = 0;
+  double seconds[2];
+  for (uint8_t reference = 0; reference < 2; reference++) {
+    double start = now();
+    for (uint32_t it = 0; it < iterations; it++) {
+      sink ^= calculate(width, reference == 0, messages[it % NUM_MESSAGES], num_bits);
+    }
+    seconds[reference] = now() - start;
+  }
+  (void) sink;
+
+  double megabytes = (double) iterations * num_bits / 8.0 / 1e6;
+  printf("%-6u %8u %14.1f %14.1f %7.1fx\n", width, num_bits / 8, megabytes / seconds[0],
+         megabytes / seconds[1], seconds[0] / seconds[1]);
+}
+
+static uint32_t calculate(uint8_t width, bool reference, const uint8_t* data, uint16_t num_bits)
+{
+  switch (width) {
+    case 8:
+      return (reference == true) ? referenceCrc8(data, num_bits) : Crc_Calculate8(data, num_bits);
+    case 16:
+      return (reference == true) ? referenceCrc16(data, num_bits) : Crc_Calculate16(data, num_bits);
+    default:
+      return (reference == true) ? referenceCrc32(data, num_bits) : Crc_Calculate32(data, num_bits);
+  }
+}
+
+static uint8_t referenceCrc8(const uint8_t* data, uint16_t num_bits)
+{
+  uint8_t polynomial = 0x07;
+  uint8_t crc = 0;
+
+  uint16_t byte_count = num_bits / 8;
+  uint16_t remaining_bits = num_bits % 8;
+
+  for (uint16_t i = 0; i < byte_count; i++) {
+    crc ^= data[i];
+
+    for (uint16_t j = 0; j < 8; j++) {
+      if (crc & 0x80) {
+        crc = (crc << 1) ^ polynomial;
+      }
+      else {
+        crc = crc << 1;
+      }
+    }
+  }
+
+  if (remaining_bits > 0) {
+    uint8_t last_byte = data[byte_count] & (0xFF << (8 - remaining_bits));
+    crc ^= last_byte;
+
+    for (uint8_t i = 0; i < remaining_bits; i++) {
+      if (crc & 0x80) {
+        crc = (crc << 1) ^ polynomial;
+      }
+      else {
+        crc = crc << 1;
+      }
+    }
+  }
+  return crc;
+}
+
+static uint16_t referenceCrc16(const uint8_t* data, uint16_t num_bits)
+{
+  uint16_t polynomial = 0x1021;
+  uint16_t crc = 0xFFFF;
+
+  uint16_t byte_count = num_bits / 8;
+  uint16_t remaining_bits = num_bits % 8;
+
+  for (uint16_t i = 0; i < byte_count; i++) {
+    crc ^= (uint16_t) data[i] << 8;
+
+    for (uint16_t j = 0; j < 8; j++) {
+      if (crc & 0x8000) {
+        crc = (crc << 1) ^ polynomial;
+      }
+      else {
+        crc = crc << 1;
+      }
+    }
+  }
+
+  if (remaining_bits > 0) {
+    uint8_t last_byte = data[byte_count] & (0xFF << (8 - remaining_bits));
+    crc ^= (uint16_t)last_byte << 8;
+
+    for (uint16_t j = 0; j < remaining_bits; j++) {
+      if (crc & 0x8000) {
+        crc = (crc << 1) ^ polynomial;
+      }
+      else {
+        crc = crc << 1;
+      }
+    }
+  }
+  return crc;
+}
+
+static uint32_t referenceCrc32(const uint8_t* data, uint16_t num_bits)
+{
+  uint32_t polynomial = 0x04C11DB7;
+  uint32_t crc = 0xFFFFFFFF;
+
+  uint16_t byte_count = num_bits / 8;
+  uint16_t remaining_bits = num_bits % 8;
+
+  for (uint16_t i = 0; i < byte_count; i++) {
+    crc ^= (uint32_t) data[i] << 24;
+
+    for (uint16_t j = 0; j < 8; j++) {
+      if (crc & 0x80000000) {
+        crc = (crc << 1) ^ polynomial;
+      }
+      else {
+        crc = crc << 1;
+      }
+    }
+  }
+
+  if (remaining_bits > 0) {
+    uint8_t last_byte = data[byte_count] & (0xFF << (8 - remaining_bits));
+    crc ^= ((uint32_t)last_byte << 24);
+
+    for (size_t j = 0; j < remaining_bits; j++) {
+      if (crc & 0x80000000) {
+        crc = (crc << 1) ^ 0x04C11DB7;
+      } else {
+        crc = crc << 1;
+      }
+    }
+  }
+  return ~crc;
+}
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,260 @@
+/*
+ * bench_detect.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Compares the cost of the frequency-based message start detectors while
+ *  listening to noise, then checks that each still detects a burst. The FFT
+ *  and Goertzel detectors get a tone and must trigger at the same point, the
+ *  chirp matched filter gets the chirp preamble followed by the tone. CFAR is
+ *  also run after a stall that leaves more input waiting than its history
+ *  holds, after which it must still detect the burst. Noise is
+ *  either simulated or read from a capture printed by Input_PrintNoise (one
+ *  ADC code per line).
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "sim_hal.h"
+#include "sim_channel.h"
+#include "mess_adc.h"
+#include "mess_input.h"
+#include "mess_modulate.h"
+#include "cfg_parameters.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+typedef struct {
+  MsgStartFunctions_t function;
+  const char* name;
+  bool chirp_burst;        // Burst starts with the chirp preamble
+  bool stall;              // The MESS task stalls before the burst and falls behind
+  double seconds;
+  uint32_t calls;
+  uint32_t false_alarms;
+  int32_t burst_latency;   // Samples from the burst start to its detection, -1 if missed
+} DetectorResult_t;
+
+/* Private define ------------------------------------------------------------*/
+
+#define BURST_FREQUENCY       30000.0f
+#define BURST_AMPLITUDE       800.0f
+#define BURST_MAX_SAMPLES     (ADC_SAMPLING_RATE / 10)
+#define BURST_LEAD_SAMPLES    (8 * ADC_BUFFER_SIZE)
+#define STALL_SAMPLES         (PROCESSING_BUFFER_SIZE * 3 / 4)
+#define CHIRP_STEP_SAMPLES    (CHIRP_STEP_DURATION_US * (ADC_SAMPLING_RATE / 1000) / 1000)
+#define MAX_CAPTURE_SAMPLES   (1 << 20)
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static float noise_rms = 20.0f;
+static float noise_seconds = 10.0f;
+static uint32_t seed = 1;
+
+static uint16_t* capture = NULL;
+static uint32_t capture_length = 0;
+
+static uint32_t samples_since_call = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void runDetector(DetectorResult_t* result);
+static bool pushSample(DetectorResult_t* result, uint16_t sample);
+static void restartListening(void);
+static uint16_t noiseSample(uint32_t index);
+static bool loadCapture(const char* path);
+static double now(void);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(int argc, char** argv)
+{
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--noise") == 0) {
+      noise_rms = strtof(argv[i + 1], NULL);
+    }
+    else if (strcmp(argv[i], "--seconds") == 0) {
+      noise_seconds = strtof(argv[i + 1], NULL);
+    }
+    else if (strcmp(argv[i], "--seed") == 0) {
+      seed = (uint32_t) strtoul(argv[i + 1], NULL, 0);
+    }
+    else if (strcmp(argv[i], "--capture") == 0) {
+      if (loadCapture(argv[i + 1]) == false) {
+        fprintf(stderr, "could not read capture %s\n", argv[i + 1]);
+        return 2;
+      }
+    }
+    else {
+      fprintf(stderr, "usage: %s [--noise RMS] [--seconds S] [--seed N] [--capture FILE]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  if (Param_Init() == false || Input_RegisterParams() == false ||
+      ADC_Init() == false || Input_Init() == false) {
+    fprintf(stderr, "initialization failed\n");
+    return 1;
+  }
+
+  DetectorResult_t results[] = {
+    {.function = MSG_START_FREQUENCY, .name = "overlapping FFTs"},
+    {.function = MSG_START_SLIDING_GOERTZEL, .name = "sliding Goertzel"},
+    {.function = MSG_START_CHIRP, .name = "chirp", .chirp_burst = true},
+    {.function = MSG_START_CFAR, .name = "CA-CFAR"},
+    {.function = MSG_START_CFAR, .name = "CA-CFAR stalled", .stall = true}
+  };
+  const uint8_t num_results = sizeof(results) / sizeof(results[0]);
+
+  uint32_t noise_samples = (capture != NULL) ? capture_length :
+                           (uint32_t) (noise_seconds * ADC_SAMPLING_RATE);
+  printf("%u noise samples (%s), burst at %.0f Hz\n", noise_samples,
+         (capture != NULL) ? "capture" : "simulated", BURST_FREQUENCY);
+
+  bool passed = true;
+  for (uint8_t i = 0; i < num_results; i++) {
+    runDetector(&results[i]);
+    printf("%-18s %8.1f ns/sample %8.0f ns/call  false alarms %u  burst latency %d samples\n",
+           results[i].name, results[i].seconds * 1e9 / noise_samples,
+           results[i].seconds * 1e9 / results[i].calls, results[i].false_alarms,
+           results[i].burst_latency);
+    if (results[i].burst_latency < 0) {
+      passed = false;
+    }
+  }
+
+  printf("sliding Goertzel speedup %.1fx\n", results[0].seconds / results[1].seconds);
+
+  // Both compute the same bins so they must trigger at the same point
+  if (results[0].burst_latency != results[1].burst_latency) {
+    passed = false;
+  }
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static void runDetector(DetectorResult_t* result)
+{
+  uint8_t function = result->function;
+  Param_SetUint8(PARAM_MSG_START_FCN, &function);
+
+  SimChannelConfig_t channel = {.gain = 1.0f, .noise_rms = noise_rms, .seed = seed};
+  SimChannel_Init(&channel);
+  restartListening();
+
+  uint32_t noise_samples = (capture != NULL) ? capture_length :
+                           (uint32_t) (noise_seconds * ADC_SAMPLING_RATE);
+  for (uint32_t n = 0; n < noise_samples; n++) {
+    if (pushSample(result, noiseSample(n)) == true) {
+      result->false_alarms++;
+      restartListening();
+    }
+  }
+
+  // Only the listening cost is benchmarked
+  double noise_time = result->seconds;
+  uint32_t noise_calls = result->calls;
+
+  // Noise ahead of the burst lets adaptive detectors settle, a detection
+  // there counts as a miss
+  restartListening();
+  result->burst_latency = -1;
+  if (result->stall == true) {
+    for (uint32_t n = 0; n < STALL_SAMPLES; n++) {
+      SimHal_AdcPushSample(&hadc3, noiseSample(n % noise_samples));
+    }
+  }
+  for (uint32_t n = 0; n < BURST_LEAD_SAMPLES; n++) {
+    float value = SIM_DAC_MIDSCALE + noise_rms * SimChannel_Gaussian();
+    if (pushSample(result, (uint16_t) lroundf(value)) == true) {
+      result->seconds = noise_time;
+      result->calls = noise_calls;
+      return;
+    }
+  }
+
+  float phase = 0.0f;
+  for (uint32_t n = 0; n < BURST_MAX_SAMPLES; n++) {
+    float frequency = BURST_FREQUENCY;
+    if (result->chirp_burst == true && n < CHIRP_PREAMBLE_STEPS * CHIRP_STEP_SAMPLES) {
+      frequency = Modulate_GetChirpFrequency(n / CHIRP_STEP_SAMPLES);
+    }
+    phase += 2.0f * (float) M_PI * frequency / ADC_SAMPLING_RATE;
+    float value = SIM_DAC_MIDSCALE + BURST_AMPLITUDE * sinf(phase) +
+                  noise_rms * SimChannel_Gaussian();
+    if (pushSample(result, (uint16_t) lroundf(value)) == true) {
+      result->burst_latency = n;
+      break;
+    }
+  }
+
+  result->seconds = noise_time;
+  result->calls = noise_calls;
+}
+
+// Feeds one sample to the input ADC and runs the detector once a DMA half
+// transfer has completed, which is the most often the MESS task sees new data
+static bool pushSample(DetectorResult_t* result, uint16_t sample)
+{
+  SimHal_AdcPushSample(&hadc3, sample);
+  if (++samples_since_call < ADC_BUFFER_SIZE / 2) {
+    return false;
+  }
+  samples_since_call = 0;
+
+  double start = now();
+  bool detected = Input_DetectMessageStart();
+  result->seconds += now() - start;
+  result->calls++;
+  return detected;
+}
+
+static void restartListening(void)
+{
+  ADC_StopAll();
+  Input_Reset();
+  ADC_StartInput();
+  samples_since_call = 0;
+}
+
+static uint16_t noiseSample(uint32_t index)
+{
+  if (capture != NULL) {
+    return capture[index];
+  }
+  float value = SIM_DAC_MIDSCALE + noise_rms * SimChannel_Gaussian();
+  return (uint16_t) lroundf(fminf(fmaxf(value, 0.0f), SIM_ADC_MAX_VALUE));
+}
+
+static bool loadCapture(const char* path)
+{
+  FILE* file = fopen(path, "r");
+  if (file == NULL) {
+    return false;
+  }
+  capture = malloc(MAX_CAPTURE_SAMPLES * sizeof(uint16_t));
+  unsigned value;
+  while (capture_length < MAX_CAPTURE_SAMPLES && fscanf(file, "%u", &value) == 1) {
+    capture[capture_length++] = (uint16_t) value;
+  }
+  fclose(file);
+  return capture_length > 0;
+}
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
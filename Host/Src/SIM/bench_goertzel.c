@@ -0,0 +1,232 @@
+/*
+ * bench_goertzel.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Measures the Goertzel bank against the original two-tone kernel, which
+ *  recomputed its coefficients and masked the ring index on every sample.
+ *  Both run over the same blocks of a noisy ring buffer, including blocks
+ *  that wrap, for FHBFSK sized tone sets and the block lengths of the
+ *  slowest and fastest baud rates. The bank energies must match the
+ *  reference. Also times Demodulate_Perform for small and large hop sets.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "mess_goertzel.h"
+#include "mess_demodulate.h"
+#include "mess_modulate.h"
+#include "mess_main.h"
+#include "mess_adc.h"
+#include "sim_channel.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define RING_SIZE           PROCESSING_BUFFER_SIZE
+#define TONE_SPACING        100
+#define FIRST_TONE          25000
+#define MAX_ENERGY_ERROR    1e-3f   // Relative to the largest energy of the block
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint16_t ring[RING_SIZE];
+static uint32_t iterations = 200;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool benchTones(uint16_t num_tones, uint16_t block_length);
+static bool benchDemodulate(uint8_t num_tones);
+static void legacyPair(const uint16_t* buffer, uint16_t buf_len, uint16_t start_index, uint16_t length,
+                       uint32_t f0, uint32_t f1, float* energy_f0, float* energy_f1);
+static double now(void);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(int argc, char** argv)
+{
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--iterations") == 0) {
+      iterations = (uint32_t) strtoul(argv[i + 1], NULL, 0);
+    }
+    else {
+      fprintf(stderr, "usage: %s [--iterations N]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  SimChannelConfig_t channel = {.gain = 1.0f, .noise_rms = 200.0f, .seed = 1};
+  SimChannel_Init(&channel);
+  for (uint32_t n = 0; n < RING_SIZE; n++) {
+    float tone = 500.0f * sinf(2.0f * (float) M_PI * (FIRST_TONE + 7 * TONE_SPACING) * n / ADC_SAMPLING_RATE);
+    float value = 2048.0f + tone + 200.0f * SimChannel_Gaussian();
+    ring[n] = (uint16_t) fminf(fmaxf(value, 0.0f), 4095.0f);
+  }
+
+  printf("%-6s %-6s %14s %14s %8s\n", "tones", "block", "legacy Ms/s", "bank Ms/s", "speedup");
+
+  bool passed = true;
+  const uint16_t block_lengths[] = {ADC_SAMPLING_RATE / 1000, ADC_SAMPLING_RATE / 100};
+  const uint16_t tone_counts[] = {2, 10, 30, GOERTZEL_MAX_TONES};
+  for (uint8_t b = 0; b < sizeof(block_lengths) / sizeof(block_lengths[0]); b++) {
+    for (uint8_t t = 0; t < sizeof(tone_counts) / sizeof(tone_counts[0]); t++) {
+      if (benchTones(tone_counts[t], block_lengths[b]) == false) {
+        passed = false;
+      }
+    }
+  }
+
+  if (benchDemodulate(DEFAULT_FHBFSK_NUM_TONES) == false || benchDemodulate(MAX_FHBFSK_NUM_TONES) == false) {
+    passed = false;
+  }
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// Samples per second are counted per input sample, whatever the number of
+// tones, so they show what one block of the tone set costs
+static bool benchTones(uint16_t num_tones, uint16_t block_length)
+{
+  uint32_t frequencies[GOERTZEL_MAX_TONES];
+  for (uint16_t i = 0; i < num_tones; i++) {
+    frequencies[i] = FIRST_TONE + i * TONE_SPACING;
+  }
+  GoertzelBank_t bank;
+  if (Goertzel_InitBank(&bank, frequencies, num_tones, ADC_SAMPLING_RATE) == false) {
+    return false;
+  }
+
+  // Block starts stride through the ring so some wrap
+  const uint32_t num_blocks = RING_SIZE / block_length + 1;
+  float bank_energies[GOERTZEL_MAX_TONES];
+  float legacy_energies[GOERTZEL_MAX_TONES];
+  volatile float sink = 0.0f;
+
+  double start = now();
+  for (uint32_t it = 0; it < iterations; it++) {
+    for (uint32_t block = 0; block < num_blocks; block++) {
+      uint16_t start_index = (uint16_t) ((block * block_length + it) & (RING_SIZE - 1));
+      for (uint16_t i = 0; i < num_tones; i += 2) {
+        legacyPair(ring, RING_SIZE, start_index, block_length, frequencies[i], frequencies[i + 1],
+                   &legacy_energies[i], &legacy_energies[i + 1]);
+      }
+      sink += legacy_energies[0];
+    }
+  }
+  double legacy_seconds = now() - start;
+
+  start = now();
+  for (uint32_t it = 0; it < iterations; it++) {
+    for (uint32_t block = 0; block < num_blocks; block++) {
+      uint16_t start_index = (uint16_t) ((block * block_length + it) & (RING_SIZE - 1));
+      Goertzel_Compute(&bank, 0, num_tones, ring, RING_SIZE, start_index, block_length, bank_energies);
+      sink += bank_energies[0];
+    }
+  }
+  double bank_seconds = now() - start;
+
+  // Compare every block start of the last iteration, wrapped ones included
+  bool matched = true;
+  for (uint32_t block = 0; block < num_blocks && matched == true; block++) {
+    uint16_t start_index = (uint16_t) ((block * block_length + iterations - 1) & (RING_SIZE - 1));
+    Goertzel_Compute(&bank, 0, num_tones, ring, RING_SIZE, start_index, block_length, bank_energies);
+    float largest = 0.0f;
+    for (uint16_t i = 0; i < num_tones; i += 2) {
+      legacyPair(ring, RING_SIZE, start_index, block_length, frequencies[i], frequencies[i + 1],
+                 &legacy_energies[i], &legacy_energies[i + 1]);
+      largest = fmaxf(largest, fmaxf(legacy_energies[i], legacy_energies[i + 1]));
+    }
+    for (uint16_t i = 0; i < num_tones; i++) {
+      if (fabsf(bank_energies[i] - legacy_energies[i]) > MAX_ENERGY_ERROR * largest) {
+        printf("tone %u block %u: bank %g legacy %g\n", i, block, bank_energies[i], legacy_energies[i]);
+        matched = false;
+      }
+    }
+  }
+
+  double samples = (double) iterations * num_blocks * block_length;
+  printf("%-6u %-6u %14.2f %14.2f %7.1fx%s\n", num_tones, block_length, samples / legacy_seconds * 1e-6,
+         samples / bank_seconds * 1e-6, legacy_seconds / bank_seconds, (matched == true) ? "" : "  MISMATCH");
+  (void)(sink);
+  return matched;
+}
+
+// Cost of demodulating one bit with the full FHBFSK hop set configured
+static bool benchDemodulate(uint8_t num_tones)
+{
+  mod_demod_method = MOD_DEMOD_FHBFSK;
+  fhbfsk_num_tones = num_tones;
+  baud_rate = 1000.0f;
+
+  DemodulationInfo_t info = {
+    .data_buf = ring,
+    .buf_len = RING_SIZE,
+    .data_len = (uint16_t) (ADC_SAMPLING_RATE / baud_rate),
+  };
+  const uint32_t bits = iterations * 100;
+
+  double start = now();
+  for (uint32_t bit = 0; bit < bits; bit++) {
+    info.bit_index = (uint16_t) bit;
+    info.data_start_index = (uint16_t) ((bit * info.data_len) & (RING_SIZE - 1));
+    if (Demodulate_Perform(&info) == false) {
+      return false;
+    }
+  }
+  double seconds = now() - start;
+
+  printf("Demodulate_Perform with %2u hops: %6.0f ns/bit\n", num_tones, seconds * 1e9 / bits);
+  return true;
+}
+
+// The two-tone kernel as it was in mess_demodulate.c
+static void legacyPair(const uint16_t* buffer, uint16_t buf_len, uint16_t start_index, uint16_t length,
+                       uint32_t f0, uint32_t f1, float* energy_f0, float* energy_f1)
+{
+  float omega_f0 = 2.0 * M_PI * f0 / ADC_SAMPLING_RATE;
+  float omega_f1 = 2.0 * M_PI * f1 / ADC_SAMPLING_RATE;
+
+  float coeff_f0 = 2.0 * cosf(omega_f0);
+  float coeff_f1 = 2.0 * cosf(omega_f1);
+
+  uint16_t mask = buf_len - 1;
+
+  float q0_f0 = 0, q1_f0 = 0, q2_f0 = 0;
+  float q0_f1 = 0, q1_f1 = 0, q2_f1 = 0;
+
+  for (uint16_t i = 0; i < length; i++) {
+    uint16_t index = (i + start_index) & mask;
+
+    q0_f0 = coeff_f0 * q1_f0 - q2_f0 + buffer[index];
+    q2_f0 = q1_f0;
+    q1_f0 = q0_f0;
+
+    q0_f1 = coeff_f1 * q1_f1 - q2_f1 + buffer[index];
+    q2_f1 = q1_f1;
+    q1_f1 = q0_f1;
+  }
+
+  *energy_f0 = q1_f0 * q1_f0 + q2_f0 * q2_f0 - coeff_f0 * q1_f0 * q2_f0;
+  *energy_f1 = q1_f1 * q1_f1 + q2_f1 * q2_f1 - coeff_f1 * q1_f1 * q2_f1;
+}
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,291 @@
+/*
+ * bench_viterbi.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Bit error rate of the convolutional code against Eb/N0. Blocks the size
+ *  of a full payload and its CRC are encoded at each rate, sent as BPSK
+ *  through white Gaussian noise and decoded from their log-likelihood
+ *  ratios, quantized as the packets store them. Rate 1/2 is also decoded
+ *  from the hard decisions alone, and the uncoded rate is given alongside.
+ *  Every rate must come through a noiseless channel unchanged at any length
+ *  and reach the expected coding gain. The encoder must give the impulse
+ *  response of the IEEE 802.11a code and each rate its free distance.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "conv_code.h"
+#include "mess_packet.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+typedef enum {
+  CURVE_UNCODED,
+  CURVE_RATE_1_2_HARD,
+  CURVE_RATE_1_2,
+  CURVE_RATE_2_3,
+  CURVE_RATE_3_4,
+  NUM_CURVES
+} Curve_t;
+
+/* Private define ------------------------------------------------------------*/
+
+#define BLOCK_BITS          CONV_CODE_MAX_INPUT_BITS
+#define MAX_CODED_BITS      (2 * (BLOCK_BITS + CONV_CODE_TAIL_BITS))
+#define MIN_EBN0_DB         0
+#define MAX_EBN0_DB         8
+#define TARGET_ERRORS       200     // Bit errors to count at each point before moving on
+
+// Required bit error rates, well short of what the code reaches
+#define CHECK_EBN0_DB       5
+#define MAX_CODED_BER       1e-4
+
+// Inputs up to this long, after a leading 1, are searched for the lightest
+// codeword. The free distance paths of the code are much shorter.
+#define FREE_DISTANCE_SPAN  12
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static const char* curve_names[NUM_CURVES] = {"uncoded", "1/2 hard", "1/2", "2/3", "3/4"};
+static const ConvCodeRate_t curve_rates[NUM_CURVES] = {
+  CONV_CODE_RATE_1_2, CONV_CODE_RATE_1_2, CONV_CODE_RATE_1_2, CONV_CODE_RATE_2_3, CONV_CODE_RATE_3_4
+};
+
+static uint8_t data[(BLOCK_BITS + 7) / 8];
+static uint8_t coded[(MAX_CODED_BITS + 7) / 8];
+static uint8_t decoded[(BLOCK_BITS + 7) / 8];
+static int8_t llr[MAX_CODED_BITS];
+
+// A single 1 at rate 1/2 gives the generators 133 and 171 interleaved, output
+// 133 first
+static const uint8_t impulse_response[] = {0xDF, 0x2C};
+static const uint8_t free_distances[NUM_CURVES] = {
+  [CURVE_RATE_1_2] = 10, [CURVE_RATE_2_3] = 6, [CURVE_RATE_3_4] = 5
+};
+static uint32_t max_blocks = 200;
+static uint32_t seed = 1;
+static double decode_seconds[NUM_CURVES];
+static uint32_t decode_blocks[NUM_CURVES];
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool checkNoiseless(void);
+static bool checkCode(void);
+static double measureBer(Curve_t curve, float ebn0_db);
+static void sendBlock(Curve_t curve, uint16_t num_bits, float noise_sigma);
+static void decodeBlock(Curve_t curve, uint16_t num_bits);
+static float gaussian(void);
+static uint32_t nextRandom(void);
+static double now(void);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(int argc, char** argv)
+{
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--blocks") == 0) {
+      max_blocks = (uint32_t) strtoul(argv[i + 1], NULL, 0);
+    }
+    else {
+      fprintf(stderr, "usage: %s [--blocks N]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  bool passed = checkNoiseless();
+  if (checkCode() == false) {
+    passed = false;
+  }
+
+  printf("%-8s", "Eb/N0");
+  for (uint8_t c = 0; c < NUM_CURVES; c++) {
+    printf(" %10s", curve_names[c]);
+  }
+  printf("\n");
+
+  for (int db = MIN_EBN0_DB; db <= MAX_EBN0_DB; db++) {
+    printf("%-8d", db);
+    for (uint8_t c = 0; c < NUM_CURVES; c++) {
+      double ber = measureBer((Curve_t) c, (float) db);
+      printf(" %10.2e", ber);
+      if (db == CHECK_EBN0_DB && c != CURVE_UNCODED && c != CURVE_RATE_1_2_HARD && ber > MAX_CODED_BER) {
+        passed = false;
+      }
+    }
+    printf("\n");
+  }
+
+  printf("decode us per block:");
+  for (uint8_t c = CURVE_RATE_1_2; c < NUM_CURVES; c++) {
+    printf(" %s %.0f", curve_names[c], decode_seconds[c] * 1e6 / decode_blocks[c]);
+  }
+  printf("\n");
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// Every length up to a few bytes past the puncturing periods, then a full
+// block
+static bool checkNoiseless(void)
+{
+  uint32_t failures = 0;
+  for (uint8_t c = CURVE_RATE_1_2; c < NUM_CURVES; c++) {
+    for (uint16_t bits = 0; bits <= BLOCK_BITS; bits = (bits < 64) ? bits + 1 : bits + 61) {
+      sendBlock((Curve_t) c, bits, 0.0f);
+      decodeBlock((Curve_t) c, bits);
+      for (uint16_t i = 0; i < (bits + 7) / 8; i++) {
+        uint8_t mask = (i == bits / 8) ? (uint8_t) (0xFF << (8 - bits % 8)) : 0xFF;
+        if (((data[i] ^ decoded[i]) & mask) != 0 || (decoded[i] & ~mask) != 0) {
+          if (failures++ < 10) {
+            printf("rate %s, %u bits decoded wrongly without noise\n", curve_names[c], bits);
+          }
+          break;
+        }
+      }
+    }
+  }
+  printf("noiseless lengths: %u failures\n", failures);
+  return failures == 0;
+}
+
+// The lightest codeword is searched for at every phase of the puncturing,
+// which leading zeros shift the input to
+static bool checkCode(void)
+{
+  bool passed = true;
+  uint8_t one = 0x80;
+  ConvCode_Encode(&one, 1, CONV_CODE_RATE_1_2, coded);
+  if (memcmp(coded, impulse_response, sizeof(impulse_response)) != 0) {
+    printf("impulse response %02X %02X, expected %02X %02X\n", coded[0], coded[1],
+           impulse_response[0], impulse_response[1]);
+    passed = false;
+  }
+
+  printf("free distance:");
+  for (uint8_t c = CURVE_RATE_1_2; c < NUM_CURVES; c++) {
+    uint16_t lightest = UINT16_MAX;
+    for (uint8_t phase = 0; phase < 3; phase++) {
+      for (uint32_t pattern = 1 << (FREE_DISTANCE_SPAN - 1); pattern < (1u << FREE_DISTANCE_SPAN); pattern++) {
+        // Pattern bits MSB first after phase zeros
+        uint32_t input = pattern << (32 - FREE_DISTANCE_SPAN - phase);
+        uint8_t bytes[4] = {input >> 24, input >> 16, input >> 8, input};
+        uint16_t num_bits = FREE_DISTANCE_SPAN + phase;
+        ConvCode_Encode(bytes, num_bits, curve_rates[c], coded);
+        uint16_t weight = 0;
+        for (uint16_t i = 0; i < (ConvCode_EncodedLength(num_bits, curve_rates[c]) + 7) / 8; i++) {
+          weight += __builtin_popcount(coded[i]);
+        }
+        if (weight < lightest) {
+          lightest = weight;
+        }
+      }
+    }
+    printf(" %s %u", curve_names[c], lightest);
+    if (lightest != free_distances[c]) {
+      passed = false;
+    }
+  }
+  printf("\n");
+  return passed;
+}
+
+// Eb is the energy per data bit, so the noise goes up with the rate
+static double measureBer(Curve_t curve, float ebn0_db)
+{
+  float rate = (curve == CURVE_UNCODED) ? 1.0f : (float) BLOCK_BITS /
+               ConvCode_EncodedLength(BLOCK_BITS, curve_rates[curve]);
+  float esn0 = rate * powf(10.0f, ebn0_db / 10.0f);
+  float sigma = sqrtf(1.0f / (2.0f * esn0));
+
+  uint64_t errors = 0;
+  uint64_t bits = 0;
+  uint32_t blocks = 0;
+  while (errors < TARGET_ERRORS && blocks < max_blocks) {
+    sendBlock(curve, BLOCK_BITS, sigma);
+    double start = now();
+    decodeBlock(curve, BLOCK_BITS);
+    decode_seconds[curve] += now() - start;
+    decode_blocks[curve]++;
+    for (uint16_t i = 0; i < BLOCK_BITS / 8; i++) {
+      errors += __builtin_popcount(data[i] ^ decoded[i]);
+    }
+    bits += BLOCK_BITS;
+    blocks++;
+  }
+  return (double) errors / (double) bits;
+}
+
+// BPSK with a 1 sent as +1, its ratio 2 y / sigma^2 stored in
+// PACKET_LLR_SCALE steps like Packet_AddSoftBit
+static void sendBlock(Curve_t curve, uint16_t num_bits, float noise_sigma)
+{
+  for (uint16_t i = 0; i < (num_bits + 7) / 8; i++) {
+    data[i] = (uint8_t) (nextRandom() >> 24);
+  }
+
+  const uint8_t* sent = data;
+  uint16_t num_sent = num_bits;
+  if (curve != CURVE_UNCODED) {
+    ConvCode_Encode(data, num_bits, curve_rates[curve], coded);
+    sent = coded;
+    num_sent = ConvCode_EncodedLength(num_bits, curve_rates[curve]);
+  }
+
+  for (uint16_t i = 0; i < num_sent; i++) {
+    float symbol = ((sent[i / 8] >> (7 - i % 8)) & 1) ? 1.0f : -1.0f;
+    float y = symbol + noise_sigma * gaussian();
+    float steps = (noise_sigma > 0.0f) ? roundf(2.0f * y / (noise_sigma * noise_sigma) * PACKET_LLR_SCALE)
+                                       : symbol * PACKET_LLR_MAX;
+    steps = fminf(fmaxf(steps, -PACKET_LLR_MAX), PACKET_LLR_MAX);
+    if (curve == CURVE_UNCODED || curve == CURVE_RATE_1_2_HARD) {
+      steps = (y < 0.0f) ? -PACKET_LLR_MAX : PACKET_LLR_MAX;
+    }
+    llr[i] = (int8_t) steps;
+  }
+}
+
+static void decodeBlock(Curve_t curve, uint16_t num_bits)
+{
+  if (curve == CURVE_UNCODED) {
+    memset(decoded, 0, sizeof(decoded));
+    for (uint16_t i = 0; i < num_bits; i++) {
+      decoded[i / 8] |= (llr[i] > 0) << (7 - i % 8);
+    }
+  }
+  else {
+    ConvCode_Decode(llr, num_bits, curve_rates[curve], decoded);
+  }
+}
+
+static float gaussian(void)
+{
+  float u1 = ((nextRandom() >> 8) + 1.0f) / 16777217.0f;
+  float u2 = (nextRandom() >> 8) / 16777216.0f;
+  return sqrtf(-2.0f * logf(u1)) * cosf(2.0f * (float) M_PI * u2);
+}
+
+static uint32_t nextRandom(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed;
+}
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,133 @@
+/*
+ * sim_channel.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "sim_channel.h"
+#include "mess_adc.h"
+#include "dac_waveform.h"
+#include <math.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static SimChannelConfig_t channel = {
+  .gain = 1.0f,
+  .noise_rms = 0.0f,
+  .seed = 1
+};
+
+static uint32_t rng_state = 1;
+static uint32_t resample_phase = 0;
+static float resample_sum = 0.0f;
+static uint32_t resample_count = 0;
+static uint32_t fade_phase = 0;
+
+static bool has_spare = false;
+static float spare = 0.0f;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static uint32_t nextRandom(void);
+static float uniform(void);
+
+/* Exported function definitions ---------------------------------------------*/
+
+void SimChannel_Init(const SimChannelConfig_t* config)
+{
+  channel = *config;
+  rng_state = (config->seed != 0) ? config->seed : 1;
+  resample_phase = 0;
+  resample_sum = 0.0f;
+  resample_count = 0;
+  fade_phase = 0;
+  has_spare = false;
+}
+
+bool SimChannel_Step(uint16_t dac_sample, uint16_t* adc_sample)
+{
+  resample_sum += (float) dac_sample;
+  resample_count++;
+
+  resample_phase += ADC_SAMPLING_RATE;
+  if (resample_phase < DAC_SAMPLE_RATE) {
+    return false;
+  }
+  resample_phase -= DAC_SAMPLE_RATE;
+
+  float average = resample_sum / (float) resample_count;
+  resample_sum = 0.0f;
+  resample_count = 0;
+
+  float gain = channel.gain;
+  if (channel.fade_period > 0) {
+    if (fade_phase < channel.fade_length) {
+      gain = 0.0f;
+    }
+    fade_phase = (fade_phase + 1) % channel.fade_period;
+  }
+
+  float value = SIM_DAC_MIDSCALE + gain * (average - SIM_DAC_MIDSCALE);
+  if (channel.noise_rms > 0.0f) {
+    value += channel.noise_rms * SimChannel_Gaussian();
+  }
+
+  if (value < 0.0f) {
+    value = 0.0f;
+  }
+  else if (value > SIM_ADC_MAX_VALUE) {
+    value = SIM_ADC_MAX_VALUE;
+  }
+  *adc_sample = (uint16_t) lroundf(value);
+  return true;
+}
+
+// Box-Muller transform, keeping the second sample of each pair
+float SimChannel_Gaussian(void)
+{
+  if (has_spare == true) {
+    has_spare = false;
+    return spare;
+  }
+
+  float u1 = uniform();
+  float u2 = uniform();
+  float radius = sqrtf(-2.0f * logf(u1));
+  float angle = 2.0f * (float) M_PI * u2;
+
+  spare = radius * sinf(angle);
+  has_spare = true;
+  return radius * cosf(angle);
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// xorshift32
+static uint32_t nextRandom(void)
+{
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+// Uniform in (0, 1] so the logarithm in the Box-Muller transform stays finite
+static float uniform(void)
+{
+  return ((float) (nextRandom() >> 8) + 1.0f) / 16777216.0f;
+}
@@ -0,0 +1,645 @@
+/*
+ * sim_main.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Host executable that runs the unmodified MESS task against the simulated
+ *  HAL. Packets are queued for transmission on the feedback DAC channel, the
+ *  DAC samples are passed through a simple channel model into the input ADC
+ *  and the decoded messages are compared against what was sent.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "sim_hal.h"
+#include "sim_channel.h"
+#include "dac_waveform.h"
+#include "mess_adc.h"
+#include "mess_main.h"
+#include "mess_packet.h"
+#include "mess_error_correction.h"
+#include "mess_input.h"
+#include "mess_modulate.h"
+#include "cfg_main.h"
+#include "cfg_parameters.h"
+#include "cfg_defaults.h"
+#include "cmsis_os.h"
+#include "main.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+typedef struct {
+  ModDemodMethod_t method;
+  uint8_t mfsk_bits;
+  float gfsk_bt;
+  DemodulationDecision_t decision;
+  MsgStartFunctions_t detector;
+  ErrorCorrectionMethod_t correction;
+  uint8_t rs_parity;
+  PacketFormat_t format;
+  uint8_t interleaver_depth;
+  bool compress;
+  bool telemetry;
+  float baud;
+  float gain;
+  float noise_rms;
+  uint32_t fade_period_ms;
+  uint32_t fade_length_ms;
+  uint16_t length_bits;
+  uint32_t packets;
+  uint8_t burst;
+  uint32_t burst_gap_ms;
+  uint32_t seed;
+  bool verbose;
+} SimOptions_t;
+
+typedef struct {
+  uint32_t sent;
+  uint32_t received;
+  uint32_t lost;
+  uint32_t corrupted;
+  uint32_t bit_errors;
+  uint32_t crc_failures;
+  uint64_t decoded_bits;
+} SimResults_t;
+
+/* Private define ------------------------------------------------------------*/
+
+#define DAC_SAMPLES_PER_TICK      (DAC_SAMPLE_RATE / 1000)
+#define PACKET_GAP_TICKS          200   // Idle time between the end of one packet and the next
+#define PACKET_TIMEOUT_TICKS      2000  // Extra time allowed past the nominal packet duration
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static SimOptions_t options = {
+  .method = MOD_DEMOD_FSK,
+  .mfsk_bits = DEFAULT_MFSK_BITS,
+  .gfsk_bt = DEFAULT_GFSK_BT,
+  .decision = DEFAULT_DEMOD_DECISION,
+  .detector = DEFAULT_MSG_START_FCN,
+  .correction = DEFAULT_ERROR_CORRECTION,
+  .rs_parity = DEFAULT_RS_PARITY,
+  .format = DEFAULT_PACKET_FORMAT,
+  .interleaver_depth = DEFAULT_INTERLEAVER_DEPTH,
+  .compress = false,
+  .telemetry = false,
+  .baud = DEFAULT_BAUD_RATE,
+  .gain = 4.0f,
+  .noise_rms = 20.0f,
+  .fade_period_ms = 0,
+  .fade_length_ms = 0,
+  .length_bits = 64,
+  .packets = 5,
+  .burst = 1,
+  .burst_gap_ms = DEFAULT_BURST_GAP_MS,
+  .seed = 1,
+  .verbose = false
+};
+
+static SimResults_t results;
+
+static const char* method_names[NUM_MOD_DEMOD_METHODS] = {"fsk", "fhbfsk", "mfsk", "dbpsk", "dqpsk", "ofdm"};
+static const char* format_names[NUM_PACKET_FORMATS] = {"pow2", "exact"};
+static const char* correction_names[NUM_ERROR_CORRECTION_METHODS] = {
+  "crc8", "crc16", "crc32", "checksum8", "checksum16", "checksum32", "conv12", "conv23", "conv34", "rs"
+};
+
+static jmp_buf sim_exit;
+
+static bool params_applied = false;
+static bool awaiting_packet = false;
+static uint32_t next_tx_tick = PACKET_GAP_TICKS;
+static uint32_t deadline_tick = 0;
+static Message_t tx_msgs[MSG_QUEUE_SIZE]; // Packets of the group in flight, in the order sent
+static uint8_t tx_count = 0;
+static uint8_t rx_count = 0;
+
+static uint32_t payload_state = 1;
+
+static double hook_seconds = 0.0;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void simulateTick(void);
+static bool applyParams(void);
+static void queuePackets(uint32_t tick);
+static void checkReceived(uint32_t tick);
+static void fillTelemetry(uint8_t* data, uint16_t num_bytes);
+static uint16_t nextDacSample(void);
+static double now(void);
+static bool parseOptions(int argc, char** argv);
+static void printUsage(const char* name);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(int argc, char** argv)
+{
+  if (parseOptions(argc, argv) == false) {
+    printUsage(argv[0]);
+    return 2;
+  }
+
+  SimChannelConfig_t channel = {
+    .gain = options.gain,
+    .noise_rms = options.noise_rms,
+    .seed = options.seed,
+    .fade_period = options.fade_period_ms * (ADC_SAMPLING_RATE / 1000),
+    .fade_length = options.fade_length_ms * (ADC_SAMPLING_RATE / 1000)
+  };
+  SimChannel_Init(&channel);
+  payload_state = options.seed * 2654435761u + 1;
+
+  // Stand in for the default task and the CFG task which normally set these up
+  if (Param_Init() == false || CFG_CreateParamFlags() == false) {
+    fprintf(stderr, "parameter initialization failed\n");
+    return 1;
+  }
+  print_event_handle = osEventFlagsNew(NULL);
+  MESS_InitializeQueues();
+  osEventFlagsSet(param_events, EVENT_PARAMS_LOADED);
+
+  SimHal_SetTickHook(simulateTick);
+
+  double start = now();
+  if (setjmp(sim_exit) == 0) {
+    MESS_StartTask(NULL);
+  }
+  double elapsed = now() - start;
+  double task_seconds = elapsed - hook_seconds;
+
+  printf("method=%s", method_names[options.method]);
+  if (options.method == MOD_DEMOD_MFSK) {
+    printf(" tones=%u", 1u << options.mfsk_bits);
+  }
+  if (options.correction != DEFAULT_ERROR_CORRECTION) {
+    printf(" correction=%s", correction_names[options.correction]);
+  }
+  if (options.correction == REED_SOLOMON) {
+    printf(" parity=%u", options.rs_parity);
+  }
+  if (options.format != DEFAULT_PACKET_FORMAT) {
+    printf(" format=%s", format_names[options.format]);
+  }
+  if (options.interleaver_depth != DEFAULT_INTERLEAVER_DEPTH) {
+    printf(" interleave=%u", options.interleaver_depth);
+  }
+  if (options.fade_period_ms > 0) {
+    printf(" fade=%u/%ums", options.fade_length_ms, options.fade_period_ms);
+  }
+  if (options.telemetry == true) {
+    printf(" payload=telemetry");
+  }
+  if (options.compress == true) {
+    printf(" compressed");
+  }
+  printf(" baud=%.2f length=%u gain=%.2f noise=%.1f\n", baud_rate,
+         options.length_bits, options.gain, options.noise_rms);
+  printf("sent=%u received=%u lost=%u corrupted=%u bit_errors=%u crc_failures=%u\n",
+         results.sent, results.received, results.lost, results.corrupted,
+         results.bit_errors, results.crc_failures);
+  printf("input_overruns=%u input_lost_samples=%u header_rejects=%u\n", Input_GetOverruns(),
+         Input_GetLostSamples(), Input_GetHeaderRejects());
+  printf("simulated_ms=%u wall_ms=%.1f task_ms=%.1f task_wakeups=%u",
+         osKernelGetTickCount(), elapsed * 1e3, task_seconds * 1e3, SimHal_GetTaskWakeups());
+  if (results.decoded_bits > 0) {
+    printf(" ns_per_decoded_bit=%.0f", task_seconds * 1e9 / (double) results.decoded_bits);
+  }
+  printf("\n");
+
+  bool passed = (results.received == options.packets) && (results.corrupted == 0) &&
+                (results.crc_failures == 0) && (SimHal_GetErrorCount() == 0);
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// Runs one millisecond of the hardware and the test bench around the MESS task
+static void simulateTick(void)
+{
+  double start = now();
+  uint32_t tick = osKernelGetTickCount();
+
+  if (params_applied == false) {
+    if (applyParams() == false) {
+      fprintf(stderr, "failed to apply simulation parameters\n");
+      longjmp(sim_exit, 1);
+    }
+    params_applied = true;
+  }
+
+  // The feedback ADC is triggered with the DAC and reads its output at 16 bits
+  for (uint32_t i = 0; i < DAC_SAMPLES_PER_TICK; i++) {
+    uint16_t dac_sample = nextDacSample();
+    uint16_t adc_sample;
+    SimHal_AdcPushSample(&hadc1, (uint16_t) (dac_sample << 4));
+    if (SimChannel_Step(dac_sample, &adc_sample) == true) {
+      SimHal_AdcPushSample(&hadc3, adc_sample);
+    }
+  }
+
+  checkReceived(tick);
+
+  if (awaiting_packet == false && results.sent < options.packets && tick >= next_tx_tick) {
+    queuePackets(tick);
+  }
+
+  hook_seconds += now() - start;
+
+  if (awaiting_packet == false && results.sent >= options.packets) {
+    longjmp(sim_exit, 1);
+  }
+}
+
+static bool applyParams(void)
+{
+  uint8_t method = options.method;
+  if (Param_SetUint8(PARAM_MOD_DEMOD_METHOD, &method) == false) {
+    return false;
+  }
+  uint8_t mfsk_bits = options.mfsk_bits;
+  if (Param_SetUint8(PARAM_MFSK_BITS, &mfsk_bits) == false) {
+    return false;
+  }
+  float gfsk_bt = options.gfsk_bt;
+  if (Param_SetFloat(PARAM_GFSK_BT, &gfsk_bt) == false) {
+    return false;
+  }
+  uint8_t decision = options.decision;
+  if (Param_SetUint8(PARAM_DEMODULATION_DECISION, &decision) == false) {
+    return false;
+  }
+  uint8_t detector = options.detector;
+  if (Param_SetUint8(PARAM_MSG_START_FCN, &detector) == false) {
+    return false;
+  }
+  // The matched filter needs the transmitter to send the chirp
+  uint8_t chirp = (options.detector == MSG_START_CHIRP);
+  if (Param_SetUint8(PARAM_CHIRP_PREAMBLE, &chirp) == false) {
+    return false;
+  }
+  uint8_t correction = options.correction;
+  if (Param_SetUint8(PARAM_ERROR_CORRECTION, &correction) == false) {
+    return false;
+  }
+  uint8_t rs_parity = options.rs_parity;
+  if (Param_SetUint8(PARAM_RS_PARITY, &rs_parity) == false) {
+    return false;
+  }
+  uint8_t format = options.format;
+  if (Param_SetUint8(PARAM_PACKET_FORMAT, &format) == false) {
+    return false;
+  }
+  uint8_t depth = options.interleaver_depth;
+  if (Param_SetUint8(PARAM_INTERLEAVER_DEPTH, &depth) == false) {
+    return false;
+  }
+  uint8_t compressed_types = (options.compress == true) ? MAX_COMPRESSED_TYPES : 0;
+  if (Param_SetUint8(PARAM_COMPRESSED_TYPES, &compressed_types) == false) {
+    return false;
+  }
+  uint8_t burst_mode = (options.burst > 1);
+  if (Param_SetUint8(PARAM_BURST_MODE, &burst_mode) == false) {
+    return false;
+  }
+  uint32_t burst_gap_ms = options.burst_gap_ms;
+  if (Param_SetUint32(PARAM_BURST_GAP, &burst_gap_ms) == false) {
+    return false;
+  }
+  float baud = options.baud;
+  MESS_RoundBaud(&baud);
+  return Param_SetFloat(PARAM_BAUD, &baud);
+}
+
+// Queues the next group of packets all at once, which in burst mode go out
+// back to back
+static void queuePackets(uint32_t tick)
+{
+  uint16_t error_bits = 0;
+  ErrorCorrection_CheckLength(options.length_bits, &error_bits);
+  uint32_t packet_bits = PACKET_PREAMBLE_LENGTH_BITS + options.length_bits + error_bits;
+  if (options.format == PACKET_FORMAT_BYTE_EXACT && options.length_bits > 8 * PACKET_SHORT_MAX_BYTES) {
+    packet_bits += PACKET_LENGTH_EXTENSION_BITS;
+  }
+  uint32_t packet_symbols = Modulate_GetSymbolCount(packet_bits);
+  uint32_t packet_ticks = (uint32_t) (1000.0f * packet_symbols / Modulate_GetSymbolRate());
+
+  tx_count = 0;
+  rx_count = 0;
+  deadline_tick = tick + PACKET_TIMEOUT_TICKS;
+  while (tx_count < options.burst && results.sent < options.packets) {
+    Message_t* tx_msg = &tx_msgs[tx_count];
+    memset(tx_msg, 0, sizeof(Message_t));
+    tx_msg->type = MSG_TRANSMIT_FEEDBACK;
+    tx_msg->data_type = STRING;
+    tx_msg->length_bits = options.length_bits;
+    if (options.telemetry == true) {
+      fillTelemetry(tx_msg->data, options.length_bits / 8);
+    }
+    else {
+      for (uint16_t i = 0; i < options.length_bits / 8; i++) {
+        payload_state = payload_state * 1664525u + 1013904223u;
+        tx_msg->data[i] = (uint8_t) (payload_state >> 24);
+      }
+    }
+
+    if (MESS_AddMessageToTxQ(tx_msg) != pdPASS) {
+      fprintf(stderr, "tx queue full\n");
+      longjmp(sim_exit, 1);
+    }
+    deadline_tick += packet_ticks + ((tx_count > 0) ? options.burst_gap_ms : 0);
+    tx_count++;
+    results.sent++;
+  }
+  awaiting_packet = true;
+}
+
+// Packets of a group are matched in the order they were sent
+static void checkReceived(uint32_t tick)
+{
+  Message_t rx_msg;
+  while (MESS_GetMessageFromRxQ(&rx_msg) == pdPASS) {
+    if (awaiting_packet == false) {
+      // Detection triggered on noise after the packet was accounted for
+      continue;
+    }
+
+    const Message_t* tx_msg = &tx_msgs[rx_count];
+    uint32_t bit_errors = 0;
+    for (uint16_t i = 0; i < tx_msg->length_bits / 8; i++) {
+      bit_errors += __builtin_popcount(tx_msg->data[i] ^ rx_msg.data[i]);
+    }
+    if (rx_msg.length_bits != tx_msg->length_bits) {
+      bit_errors += tx_msg->length_bits;
+    }
+
+    results.received++;
+    results.decoded_bits += rx_msg.length_bits;
+    results.bit_errors += bit_errors;
+    if (bit_errors != 0) {
+      results.corrupted++;
+    }
+    if (rx_msg.error_correction_error == true) {
+      results.crc_failures++;
+    }
+    if (options.verbose == true) {
+      printf("packet %u: tick=%u bit_errors=%u crc_error=%d sync_quality=%.2f\n",
+             results.sent - tx_count + rx_count + 1, tick, bit_errors, rx_msg.error_correction_error,
+             Input_GetSyncQuality());
+    }
+
+    rx_count++;
+    if (rx_count >= tx_count) {
+      awaiting_packet = false;
+      next_tx_tick = tick + PACKET_GAP_TICKS;
+    }
+  }
+
+  if (awaiting_packet == true && tick >= deadline_tick) {
+    for (; rx_count < tx_count; rx_count++) {
+      if (options.verbose == true) {
+        printf("packet %u: lost\n", results.sent - tx_count + rx_count + 1);
+      }
+      results.lost++;
+    }
+    awaiting_packet = false;
+    next_tx_tick = tick + PACKET_GAP_TICKS;
+  }
+}
+
+// Records like a sensor node would report, cut off at the payload length
+static void fillTelemetry(uint8_t* data, uint16_t num_bytes)
+{
+  char text[PACKET_DATA_MAX_LENGTH_BYTES + 96];
+  uint16_t length = 0;
+  while (length < num_bytes) {
+    payload_state = payload_state * 1664525u + 1013904223u;
+    uint32_t r = payload_state >> 8;
+    length += (uint16_t) snprintf(&text[length], sizeof(text) - length,
+                                  "id=2,seq=%u,t=%u,depth=%u.%u,temp=%u.%02u,bat=3.%02u,status=OK;",
+                                  results.sent, 1000 + r % 9000, 10 + r % 90, r % 10, 4 + r % 16,
+                                  r % 100, 60 + r % 40);
+  }
+  memcpy(data, text, num_bytes);
+}
+
+static uint16_t nextDacSample(void)
+{
+  uint16_t sample;
+  if (SimHal_DacPullSample(DAC_CHANNEL_FEEDBACK, &sample) == true) {
+    return sample;
+  }
+  if (SimHal_DacPullSample(DAC_CHANNEL_TRANSDUCER, &sample) == true) {
+    return sample;
+  }
+  return SIM_DAC_MIDSCALE;
+}
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+static bool parseOptions(int argc, char** argv)
+{
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+    if (strcmp(arg, "--verbose") == 0) {
+      options.verbose = true;
+      continue;
+    }
+    if (strcmp(arg, "--compress") == 0) {
+      options.compress = true;
+      continue;
+    }
+    if (value == NULL) {
+      return false;
+    }
+    i++;
+
+    if (strcmp(arg, "--method") == 0) {
+      if (strcmp(value, "fsk") == 0) {
+        options.method = MOD_DEMOD_FSK;
+      }
+      else if (strcmp(value, "fhbfsk") == 0) {
+        options.method = MOD_DEMOD_FHBFSK;
+      }
+      else if (strcmp(value, "mfsk") == 0) {
+        options.method = MOD_DEMOD_MFSK;
+      }
+      else if (strcmp(value, "dbpsk") == 0) {
+        options.method = MOD_DEMOD_DBPSK;
+      }
+      else if (strcmp(value, "dqpsk") == 0) {
+        options.method = MOD_DEMOD_DQPSK;
+      }
+      else if (strcmp(value, "ofdm") == 0) {
+        options.method = MOD_DEMOD_OFDM;
+      }
+      else {
+        return false;
+      }
+    }
+    else if (strcmp(arg, "--mfsk-bits") == 0) {
+      options.mfsk_bits = (uint8_t) strtoul(value, NULL, 0);
+    }
+    else if (strcmp(arg, "--gfsk-bt") == 0) {
+      options.gfsk_bt = strtof(value, NULL);
+    }
+    else if (strcmp(arg, "--decision") == 0) {
+      if (strcmp(value, "amplitude") == 0) {
+        options.decision = AMPLITUDE_COMPARISON;
+      }
+      else if (strcmp(value, "historical") == 0) {
+        options.decision = HISTORICAL_COMPARISON;
+      }
+      else {
+        return false;
+      }
+    }
+    else if (strcmp(arg, "--detector") == 0) {
+      if (strcmp(value, "fft") == 0) {
+        options.detector = MSG_START_FREQUENCY;
+      }
+      else if (strcmp(value, "goertzel") == 0) {
+        options.detector = MSG_START_SLIDING_GOERTZEL;
+      }
+      else if (strcmp(value, "chirp") == 0) {
+        options.detector = MSG_START_CHIRP;
+      }
+      else if (strcmp(value, "cfar") == 0) {
+        options.detector = MSG_START_CFAR;
+      }
+      else {
+        return false;
+      }
+    }
+    else if (strcmp(arg, "--correction") == 0) {
+      uint8_t c = 0;
+      while (c < NUM_ERROR_CORRECTION_METHODS && strcmp(value, correction_names[c]) != 0) {
+        c++;
+      }
+      if (c == NUM_ERROR_CORRECTION_METHODS) {
+        return false;
+      }
+      options.correction = (ErrorCorrectionMethod_t) c;
+    }
+    else if (strcmp(arg, "--format") == 0) {
+      uint8_t f = 0;
+      while (f < NUM_PACKET_FORMATS && strcmp(value, format_names[f]) != 0) {
+        f++;
+      }
+      if (f == NUM_PACKET_FORMATS) {
+        return false;
+      }
+      options.format = (PacketFormat_t) f;
+    }
+    else if (strcmp(arg, "--payload") == 0) {
+      if (strcmp(value, "random") == 0) {
+        options.telemetry = false;
+      }
+      else if (strcmp(value, "telemetry") == 0) {
+        options.telemetry = true;
+      }
+      else {
+        return false;
+      }
+    }
+    else if (strcmp(arg, "--interleave") == 0) {
+      options.interleaver_depth = (uint8_t) strtoul(value, NULL, 0);
+    }
+    else if (strcmp(arg, "--rs-parity") == 0) {
+      options.rs_parity = (uint8_t) strtoul(value, NULL, 0);
+    }
+    else if (strcmp(arg, "--baud") == 0) {
+      options.baud = strtof(value, NULL);
+    }
+    else if (strcmp(arg, "--gain") == 0) {
+      options.gain = strtof(value, NULL);
+    }
+    else if (strcmp(arg, "--noise") == 0) {
+      options.noise_rms = strtof(value, NULL);
+    }
+    else if (strcmp(arg, "--fade") == 0) {
+      char* end;
+      options.fade_length_ms = (uint32_t) strtoul(value, &end, 0);
+      if (*end != '/') {
+        return false;
+      }
+      options.fade_period_ms = (uint32_t) strtoul(end + 1, NULL, 0);
+    }
+    else if (strcmp(arg, "--length") == 0) {
+      options.length_bits = (uint16_t) strtoul(value, NULL, 0);
+    }
+    else if (strcmp(arg, "--packets") == 0) {
+      options.packets = (uint32_t) strtoul(value, NULL, 0);
+    }
+    else if (strcmp(arg, "--burst") == 0) {
+      options.burst = (uint8_t) strtoul(value, NULL, 0);
+    }
+    else if (strcmp(arg, "--burst-gap") == 0) {
+      options.burst_gap_ms = (uint32_t) strtoul(value, NULL, 0);
+    }
+    else if (strcmp(arg, "--seed") == 0) {
+      options.seed = (uint32_t) strtoul(value, NULL, 0);
+    }
+    else {
+      return false;
+    }
+  }
+
+  // The power of two format can only describe power of two payload lengths
+  uint16_t length = options.length_bits;
+  if (length < PACKET_DATA_MIN_LENGTH_BITS || length > PACKET_DATA_MAX_LENGTH_BITS || length % 8 != 0) {
+    return false;
+  }
+  if (options.format == PACKET_FORMAT_POWER_OF_TWO && (length & (length - 1)) != 0) {
+    return false;
+  }
+  if (options.mfsk_bits < MIN_MFSK_BITS || options.mfsk_bits > MAX_MFSK_BITS) {
+    return false;
+  }
+  if (options.rs_parity < MIN_RS_PARITY || options.rs_parity > MAX_RS_PARITY) {
+    return false;
+  }
+  if (options.interleaver_depth < MIN_INTERLEAVER_DEPTH ||
+      options.interleaver_depth > MAX_INTERLEAVER_DEPTH) {
+    return false;
+  }
+  if (options.fade_period_ms > 0 && options.fade_length_ms >= options.fade_period_ms) {
+    return false;
+  }
+  if (options.burst < 1 || options.burst > MODULATE_MAX_BURST_MESSAGES ||
+      options.burst_gap_ms > MAX_BURST_GAP_MS) {
+    return false;
+  }
+  return options.baud > 0.0f && options.packets > 0;
+}
+
+static void printUsage(const char* name)
+{
+  fprintf(stderr,
+          "usage: %s [--method fsk|fhbfsk|mfsk|dbpsk|dqpsk|ofdm] [--mfsk-bits 2|3|4]\n"
+          "          [--gfsk-bt BT] [--decision amplitude|historical]\n"
+          "          [--detector fft|goertzel|chirp|cfar] [--baud B]\n"
+          "          [--correction crc8|crc16|crc32|checksum8|checksum16|checksum32|\n"
+          "                        conv12|conv23|conv34|rs] [--rs-parity N]\n"
+          "          [--format pow2|exact] [--interleave DEPTH] [--compress]\n"
+          "          [--payload random|telemetry] [--gain G] [--noise RMS]\n"
+          "          [--fade MS/PERIOD_MS] [--length BITS] [--packets N] [--burst N]\n"
+          "          [--burst-gap MS] [--seed S] [--verbose]\n",
+          name);
+}
@@ -0,0 +1,215 @@
+/*
+ * test_calibration.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Runs the transducer calibration sweep against a simulated resonant
+ *  response. Each point's test tone is captured by the feedback ADC, 16 bit
+ *  and triggered with the DAC at DAC_SAMPLE_RATE, between stretches of
+ *  silence and measured with Feedback_MeasureTone, which must
+ *  recover the tone amplitude. The finished gain table must flatten the
+ *  response, interpolate between its points, and be applied to the tones
+ *  the modulator sends: the two FSK tones of a message must come out of the
+ *  DAC in the ratio of their gains.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "sim_hal.h"
+#include "sim_channel.h"
+#include "mess_adc.h"
+#include "mess_feedback.h"
+#include "mess_calibration.h"
+#include "mess_modulate.h"
+#include "mess_packet.h"
+#include "mess_main.h"
+#include "dac_waveform.h"
+#include "cfg_defaults.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define RESONANCE_HZ          32000.0f
+#define RESONANCE_WIDTH_HZ    3000.0f
+#define TONE_AMPLITUDE        9600.0f // Feedback ADC codes at resonance
+#define NOISE_RMS             20.0f
+#define FEEDBACK_NOISE_RMS    320.0f
+#define FEEDBACK_MIDSCALE     32768.0f
+#define FEEDBACK_MAX          65535.0f
+#define SILENCE_BEFORE        3000    // Samples around each captured tone
+#define SILENCE_AFTER         2000
+#define TONE_SAMPLES          (FEEDBACK_TEST_DURATION_MS * DAC_SAMPLE_RATE / 1000)
+
+#define MAX_AMPLITUDE_ERROR   0.03f   // Relative, of each measured tone
+#define MAX_FLATNESS_ERROR    0.03f   // Relative, of the equalized response
+#define MAX_RATIO_ERROR       0.03f   // Relative, of the DAC tone amplitudes
+
+#define MESSAGE_BYTES         16
+#define MAX_DAC_SAMPLES       (MESSAGE_BYTES * 8 * 10000 + DAC_BUFFER_SIZE)
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static float dac_samples[MAX_DAC_SAMPLES];
+
+/* Private function prototypes -----------------------------------------------*/
+
+static float response(float freq_hz);
+static void captureTone(uint32_t freq_hz, float amplitude);
+static bool checkSweep(void);
+static bool checkModulation(void);
+static float dacToneAmplitude(uint32_t num_samples, uint32_t freq_hz);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(void)
+{
+  SimChannelConfig_t channel = {.gain = 1.0f, .noise_rms = NOISE_RMS, .seed = 1};
+  SimChannel_Init(&channel);
+  if (ADC_Init() == false || Feedback_Init() == false || DAC_InitWaveformGenerator() == false) {
+    printf("failed to initialize\n");
+    return 1;
+  }
+
+  bool passed = checkSweep();
+  if (checkModulation() == false) {
+    passed = false;
+  }
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static float response(float freq_hz)
+{
+  float detuning = (freq_hz - RESONANCE_HZ) / RESONANCE_WIDTH_HZ;
+  return 1.0f / sqrtf(1.0f + detuning * detuning);
+}
+
+// Feedback of one test tone on ADC1, the feedback ADC, running before and
+// after it as it does around the DAC output
+static void captureTone(uint32_t freq_hz, float amplitude)
+{
+  Feedback_Reset();
+  ADC_StartFeedback();
+  for (uint32_t n = 0; n < SILENCE_BEFORE + TONE_SAMPLES + SILENCE_AFTER; n++) {
+    float value = FEEDBACK_MIDSCALE + FEEDBACK_NOISE_RMS * SimChannel_Gaussian();
+    if (n >= SILENCE_BEFORE && n < SILENCE_BEFORE + TONE_SAMPLES) {
+      value += amplitude * (float) sin(2.0 * M_PI * freq_hz * n / DAC_SAMPLE_RATE);
+    }
+    SimHal_AdcPushSample(&hadc1, (uint16_t) fminf(fmaxf(value, 0.0f), FEEDBACK_MAX));
+  }
+  ADC_StopFeedback();
+}
+
+static bool checkSweep(void)
+{
+  if (Calibration_StartSweep() == false) {
+    printf("failed to start the sweep\n");
+    return false;
+  }
+
+  bool passed = true;
+  uint32_t freq_hz;
+  printf("%-8s %10s %10s\n", "freq", "expected", "measured");
+  while (Calibration_GetSweepFrequency(&freq_hz) == true) {
+    float expected = TONE_AMPLITUDE * response((float) freq_hz);
+    float measured = 0.0f;
+    captureTone(freq_hz, expected);
+    if (Feedback_MeasureTone(freq_hz, &measured) == false) {
+      printf("%-8u failed to measure\n", freq_hz);
+      return false;
+    }
+    printf("%-8u %10.1f %10.1f\n", freq_hz, expected, measured);
+    if (fabsf(measured - expected) > MAX_AMPLITUDE_ERROR * expected) {
+      passed = false;
+    }
+    Calibration_RecordPoint(measured);
+  }
+  if (Calibration_FinishSweep() == false || Calibration_GetNumPoints() == 0) {
+    printf("failed to finish the sweep\n");
+    return false;
+  }
+
+  // Every point brought to the same level, unless its gain was limited
+  float level = 0.0f;
+  for (uint16_t i = 0; i < Calibration_GetNumPoints(); i++) {
+    float amplitude, gain;
+    Calibration_GetPoint(i, &freq_hz, &amplitude, &gain);
+    if (gain <= CALIBRATION_MIN_GAIN || gain >= CALIBRATION_MAX_GAIN) {
+      continue;
+    }
+    float equalized = gain * response((float) freq_hz);
+    if (level == 0.0f) {
+      level = equalized;
+    }
+    if (fabsf(equalized - level) > MAX_FLATNESS_ERROR * level) {
+      printf("%u Hz equalized to %.3f, expected %.3f\n", freq_hz, equalized, level);
+      passed = false;
+    }
+  }
+
+  uint32_t first_freq, second_freq;
+  float amplitude, first_gain, second_gain;
+  Calibration_GetPoint(0, &first_freq, &amplitude, &first_gain);
+  Calibration_GetPoint(1, &second_freq, &amplitude, &second_gain);
+  float middle_gain = Calibration_GetGain((first_freq + second_freq) / 2);
+  if (fabsf(middle_gain - (first_gain + second_gain) / 2.0f) > 1e-4f ||
+      Calibration_GetGain(first_freq - 1000) != first_gain) {
+    printf("gain table interpolation is wrong\n");
+    passed = false;
+  }
+  printf("sweep %s\n", (passed == true) ? "passed" : "FAILED");
+  return passed;
+}
+
+// Sends alternating bits as FSK and compares the level of the two tones in
+// the DAC output with their gains
+static bool checkModulation(void)
+{
+  mod_demod_method = MOD_DEMOD_FSK;
+  BitMessage_t bit_msg;
+  memset(&bit_msg, 0, sizeof(BitMessage_t));
+  memset(bit_msg.data, 0x55, MESSAGE_BYTES);
+  bit_msg.bit_count = MESSAGE_BYTES * 8;
+  if (Modulate_SetMessageSource(&bit_msg) == false || DAC_StartWaveformOutput(DAC_CHANNEL_2) == false) {
+    printf("failed to start the message\n");
+    return false;
+  }
+
+  uint32_t count = 0;
+  uint16_t sample;
+  while (count < MAX_DAC_SAMPLES && SimHal_DacPullSample(DAC_CHANNEL_2, &sample) == true) {
+    dac_samples[count++] = (float) sample - (float) SIM_DAC_MIDSCALE;
+  }
+
+  float ratio = dacToneAmplitude(count, fsk_f1) / dacToneAmplitude(count, fsk_f0);
+  float expected = Calibration_GetGain(fsk_f1) / Calibration_GetGain(fsk_f0);
+  bool passed = fabsf(ratio - expected) <= MAX_RATIO_ERROR * expected;
+  printf("FSK tone ratio %.3f, expected %.3f %s\n", ratio, expected, (passed == true) ? "" : "FAILED");
+  return passed;
+}
+
+static float dacToneAmplitude(uint32_t num_samples, uint32_t freq_hz)
+{
+  double coeff = 2.0 * cos(2.0 * M_PI * freq_hz / DAC_SAMPLE_RATE);
+  double q1 = 0.0;
+  double q2 = 0.0;
+  for (uint32_t n = 0; n < num_samples; n++) {
+    double q0 = coeff * q1 - q2 + dac_samples[n];
+    q2 = q1;
+    q1 = q0;
+  }
+  return (float) sqrt(q1 * q1 + q2 * q2 - coeff * q1 * q2);
+}
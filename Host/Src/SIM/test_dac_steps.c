@@ -0,0 +1,129 @@
+/*
+ * test_dac_steps.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Checks that the DAC waveform generator starts each step on the exact
+ *  sample its duration puts it at, whatever its position in the DMA half
+ *  buffers. The steps hold a constant level, a zero frequency with the phase
+ *  turned a quarter cycle from one step to the next, so every boundary shows
+ *  as a change of level. The output must then stop within the half buffer
+ *  the last step ends in, padded with midscale.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "sim_hal.h"
+#include "sim_channel.h"
+#include "dac_waveform.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define QUARTER_CYCLE       (1u << 30)
+#define LEVEL_MARGIN        512     // Distance from midscale a high or low step must reach
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+// Shorter than, equal to and longer than a half buffer, and ones that leave
+// a boundary part way into the next half
+static const uint32_t durations_us[] = {
+  100, 37, 249, 250, 251, 333, 1, 1, 499, 500, 777, 2, 1000, 123, 4321, 250, 250, 13
+};
+
+#define NUM_STEPS           (sizeof(durations_us) / sizeof(durations_us[0]))
+
+static WaveformStep_t sequence[NUM_STEPS];
+
+/* Private function prototypes -----------------------------------------------*/
+
+static int8_t expectedLevel(uint32_t step);
+static int8_t measuredLevel(uint16_t sample);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(void)
+{
+  uint32_t total_samples = 0;
+  for (uint32_t i = 0; i < NUM_STEPS; i++) {
+    sequence[i].freq_hz = 0;
+    sequence[i].relative_amplitude = 1.0f;
+    sequence[i].duration_us = durations_us[i];
+    sequence[i].phase_offset = (i == 0) ? 0 : QUARTER_CYCLE;
+    total_samples += durations_us[i] * (DAC_SAMPLE_RATE / 1000000);
+  }
+
+  if (DAC_InitWaveformGenerator() == false || DAC_SetWaveformSequence(sequence, NUM_STEPS) == false ||
+      DAC_StartWaveformOutput(DAC_CHANNEL_2) == false) {
+    printf("failed to start the waveform\n");
+    return 1;
+  }
+
+  bool passed = true;
+  uint32_t count = 0;
+  uint32_t step = 0;
+  uint32_t step_end = durations_us[0];
+  uint32_t errors = 0;
+  uint16_t sample;
+  while (count < total_samples + DAC_BUFFER_SIZE && SimHal_DacPullSample(DAC_CHANNEL_2, &sample) == true) {
+    while (step < NUM_STEPS && count >= step_end) {
+      step++;
+      step_end += (step < NUM_STEPS) ? durations_us[step] : 0;
+    }
+    int8_t expected = (step < NUM_STEPS) ? expectedLevel(step) : 0;
+    if (measuredLevel(sample) != expected || (step >= NUM_STEPS && sample != SIM_DAC_MIDSCALE)) {
+      if (errors++ < 10) {
+        printf("sample %u of step %u: %u\n", count, step, sample);
+      }
+      passed = false;
+    }
+    count++;
+  }
+
+  // The last half buffer is padded out after the final step
+  const uint32_t half = DAC_BUFFER_SIZE / 2;
+  const uint32_t expected_count = (total_samples + half - 1) / half * half;
+  printf("steps=%u samples=%u output=%u expected=%u errors=%u\n", (unsigned) NUM_STEPS, total_samples,
+         count, expected_count, errors);
+  if (count != expected_count || DAC_IsRunning() == true) {
+    passed = false;
+  }
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// Step i sits at i quarter cycles, so the level goes midscale, high,
+// midscale, low
+static int8_t expectedLevel(uint32_t step)
+{
+  switch (step % 4) {
+    case 1:
+      return 1;
+    case 3:
+      return -1;
+    default:
+      return 0;
+  }
+}
+
+static int8_t measuredLevel(uint16_t sample)
+{
+  if (sample > SIM_DAC_MIDSCALE + LEVEL_MARGIN) {
+    return 1;
+  }
+  if (sample + LEVEL_MARGIN < SIM_DAC_MIDSCALE) {
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * test_gfsk_spectrum.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Checks the Gaussian frequency shaping of the DAC waveform generator. A
+ *  random two-tone FSK step sequence is generated with shaping off and at
+ *  decreasing bandwidth-time products, and the share of the output energy
+ *  outside the band around the tones is measured. Shaping must leave the
+ *  length of the output unchanged, must cut the energy outside the band well
+ *  below the unshaped output and cut it further at 0.5 than at 1.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "sim_hal.h"
+#include "sim_channel.h"
+#include "dac_waveform.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define NUM_SYMBOLS         64
+#define SYMBOL_DURATION_US  1000
+#define TONE_F0             29000
+#define TONE_F1             30000
+#define BAND_HALF_WIDTH     2500    // Around the centre of the two tones, in Hertz
+#define SPECTRUM_START      20000
+#define SPECTRUM_END        40000
+#define SPECTRUM_STEP       50
+#define MIN_IMPROVEMENT_DB  20.0f   // Required of every product over shaping off
+
+#define NUM_SAMPLES         (NUM_SYMBOLS * SYMBOL_DURATION_US * (DAC_SAMPLE_RATE / 1000000))
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint8_t symbols[NUM_SYMBOLS];
+static uint16_t symbol_index = 0;
+static float samples[NUM_SAMPLES + DAC_BUFFER_SIZE];
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool symbolSource(WaveformStep_t* step);
+static bool generate(float bt, uint32_t* num_samples);
+static float outOfBandShare(uint32_t num_samples);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(void)
+{
+  uint32_t seed = 1;
+  for (uint16_t i = 0; i < NUM_SYMBOLS; i++) {
+    seed = seed * 1664525u + 1013904223u;
+    symbols[i] = (seed >> 31) & 1;
+  }
+  if (DAC_InitWaveformGenerator() == false) {
+    return 1;
+  }
+
+  printf("%-6s %10s %12s\n", "BT", "samples", "out of band");
+
+  bool passed = true;
+  const float products[] = {0.0f, 1.0f, 0.5f, DAC_MIN_SHAPING_BT};
+  float share[sizeof(products) / sizeof(products[0])];
+  for (uint8_t i = 0; i < sizeof(products) / sizeof(products[0]); i++) {
+    uint32_t num_samples;
+    if (generate(products[i], &num_samples) == false) {
+      printf("%-6.2f failed to generate\n", products[i]);
+      return 1;
+    }
+    share[i] = outOfBandShare(num_samples);
+    printf("%-6.2f %10u %9.1f dB\n", products[i], num_samples, 10.0f * log10f(share[i]));
+
+    // Shaping only moves the frequency within the steps
+    if (num_samples != NUM_SAMPLES) {
+      printf("expected %u samples\n", NUM_SAMPLES);
+      passed = false;
+    }
+    float improvement = 10.0f * log10f(share[0] / share[i]);
+    if (i > 0 && improvement < MIN_IMPROVEMENT_DB) {
+      printf("less than %.0f dB below unshaped\n", MIN_IMPROVEMENT_DB);
+      passed = false;
+    }
+  }
+
+  if (share[2] >= share[1]) {
+    printf("BT 0.50 is no better than BT 1.00\n");
+    passed = false;
+  }
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static bool symbolSource(WaveformStep_t* step)
+{
+  if (symbol_index >= NUM_SYMBOLS) {
+    return false;
+  }
+  step->freq_hz = (symbols[symbol_index++] != 0) ? TONE_F1 : TONE_F0;
+  step->relative_amplitude = 1.0f;
+  step->duration_us = SYMBOL_DURATION_US;
+  step->phase_offset = 0;
+  return true;
+}
+
+// Runs the generator until it stops on its own at the end of the sequence
+static bool generate(float bt, uint32_t* num_samples)
+{
+  symbol_index = 0;
+  if (DAC_SetStepSource(symbolSource, bt) == false || DAC_StartWaveformOutput(DAC_CHANNEL_2) == false) {
+    return false;
+  }
+
+  uint32_t count = 0;
+  uint16_t sample;
+  while (count < NUM_SAMPLES + DAC_BUFFER_SIZE && SimHal_DacPullSample(DAC_CHANNEL_2, &sample) == true) {
+    samples[count++] = (float) sample - (float) SIM_DAC_MIDSCALE;
+  }
+  *num_samples = count;
+  return DAC_IsRunning() == false;
+}
+
+// Hann windowed spectrum of the output, evaluated with a Goertzel filter at
+// each frequency
+static float outOfBandShare(uint32_t num_samples)
+{
+  const float centre = (TONE_F0 + TONE_F1) / 2.0f;
+  float inside = 0.0f;
+  float outside = 0.0f;
+  for (uint32_t f = SPECTRUM_START; f < SPECTRUM_END; f += SPECTRUM_STEP) {
+    double coeff = 2.0 * cos(2.0 * M_PI * f / DAC_SAMPLE_RATE);
+    double q1 = 0.0;
+    double q2 = 0.0;
+    for (uint32_t n = 0; n < num_samples; n++) {
+      double window = 0.5 - 0.5 * cos(2.0 * M_PI * n / num_samples);
+      double q0 = coeff * q1 - q2 + window * samples[n];
+      q2 = q1;
+      q1 = q0;
+    }
+    float power = (float) (q1 * q1 + q2 * q2 - coeff * q1 * q2);
+    if (fabsf((float) f - centre) > BAND_HALF_WIDTH) {
+      outside += power;
+    }
+    else {
+      inside += power;
+    }
+  }
+  return outside / (inside + outside);
+}
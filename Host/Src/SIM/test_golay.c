@@ -0,0 +1,209 @@
+/*
+ * test_golay.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Checks the Golay(24,12) header code. Every nonzero codeword must have at
+ *  least 8 bits set, which is what lets it correct 3 bits and detect 4.
+ *  Every pattern of up to 3 bits in error must then decode back to the data
+ *  sent, and every pattern of exactly 4 must be rejected, for a spread of
+ *  data words. A header sent through the packet builder in either packet
+ *  format must come out of Input_DecodeBits with the same fields after 3
+ *  bits of one of its codewords are flipped, and be rejected after 4. Longer
+ *  byte-exact packets put their byte count in a second codeword.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "golay.h"
+#include "mess_input.h"
+#include "mess_packet.h"
+#include "mess_error_correction.h"
+#include "cfg_parameters.h"
+#include "mess_main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define NUM_DATA_WORDS      16      // Data words every error pattern is tried on
+#define NUM_HEADER_TRIALS   200
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint32_t seed = 1;
+static const uint8_t data_types[] = {INTEGER, STRING, FLOAT, UNKNOWN};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool checkDistance(void);
+static bool checkPatterns(void);
+static bool checkPacketHeaders(PacketFormat_t format);
+static bool checkPattern(uint16_t data, uint32_t error, uint8_t weight);
+static uint8_t countBits(uint32_t value);
+static uint32_t nextRandom(void);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(void)
+{
+  bool passed = checkDistance();
+  if (checkPatterns() == false) {
+    passed = false;
+  }
+  if (Param_Init() == false || Packet_RegisterParams() == false) {
+    printf("failed to register the packet parameters\n");
+    return 1;
+  }
+  for (uint8_t format = 0; format < NUM_PACKET_FORMATS; format++) {
+    if (checkPacketHeaders((PacketFormat_t) format) == false) {
+      passed = false;
+    }
+  }
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static bool checkDistance(void)
+{
+  uint8_t min_weight = GOLAY_CODEWORD_BITS;
+  for (uint16_t data = 1; data < (1u << GOLAY_DATA_BITS); data++) {
+    uint8_t weight = countBits(Golay_Encode(data));
+    if (weight < min_weight) {
+      min_weight = weight;
+    }
+  }
+  printf("minimum distance %u\n", min_weight);
+  return min_weight == 8;
+}
+
+static bool checkPatterns(void)
+{
+  uint32_t failures = 0;
+  uint32_t patterns = 0;
+  for (uint8_t d = 0; d < NUM_DATA_WORDS; d++) {
+    uint16_t data = (d == 0) ? 0 : (uint16_t) (nextRandom() & 0xFFF);
+    failures += (checkPattern(data, 0, 0) == false);
+    for (uint8_t i = 0; i < GOLAY_CODEWORD_BITS; i++) {
+      failures += (checkPattern(data, 1u << i, 1) == false);
+      for (uint8_t j = i + 1; j < GOLAY_CODEWORD_BITS; j++) {
+        failures += (checkPattern(data, (1u << i) | (1u << j), 2) == false);
+        for (uint8_t k = j + 1; k < GOLAY_CODEWORD_BITS; k++) {
+          uint32_t error = (1u << i) | (1u << j) | (1u << k);
+          failures += (checkPattern(data, error, 3) == false);
+          for (uint8_t l = k + 1; l < GOLAY_CODEWORD_BITS; l++) {
+            failures += (checkPattern(data, error | (1u << l), 4) == false);
+            patterns++;
+          }
+        }
+      }
+    }
+  }
+  printf("%u data words, %u patterns of 4 bits each: %u failures\n", NUM_DATA_WORDS,
+         patterns / NUM_DATA_WORDS, failures);
+  return failures == 0;
+}
+
+// Up to 3 bits in error must be corrected and 4 rejected
+static bool checkPattern(uint16_t data, uint32_t error, uint8_t weight)
+{
+  uint16_t decoded = 0xFFFF;
+  uint8_t num_corrected = 0;
+  bool corrected = Golay_Decode(Golay_Encode(data) ^ error, &decoded, &num_corrected);
+  if (weight > GOLAY_MAX_CORRECTED) {
+    return corrected == false && decoded == 0xFFFF;
+  }
+  return corrected == true && decoded == data && num_corrected == weight;
+}
+
+static bool checkPacketHeaders(PacketFormat_t format)
+{
+  uint8_t value = format;
+  if (Param_SetUint8(PARAM_PACKET_FORMAT, &value) == false) {
+    return false;
+  }
+
+  uint32_t failures = 0;
+  uint32_t rejects = Input_GetHeaderRejects();
+  for (uint32_t trial = 0; trial < NUM_HEADER_TRIALS; trial++) {
+    Message_t msg;
+    memset(&msg, 0, sizeof(Message_t));
+    msg.data_type = data_types[nextRandom() % sizeof(data_types)];
+    if (format == PACKET_FORMAT_BYTE_EXACT) {
+      msg.length_bits = 8 * (1 + nextRandom() % PACKET_DATA_MAX_LENGTH_BYTES);
+    }
+    else {
+      msg.length_bits = 8u << (nextRandom() % 8);
+    }
+    BitMessage_t tx_msg;
+    if (Packet_PrepareTx(&msg, &tx_msg) == false) {
+      printf("failed to prepare a packet\n");
+      return false;
+    }
+
+    // Flips 3 or 4 distinct bits of one of the codewords, alternately
+    uint8_t num_errors = 3 + (trial & 1);
+    uint8_t codeword = nextRandom() % (tx_msg.preamble_length / GOLAY_CODEWORD_BITS);
+    BitMessage_t rx_msg;
+    Packet_PrepareRx(&rx_msg, NULL);
+    memcpy(rx_msg.data, tx_msg.data, sizeof(rx_msg.data));
+    rx_msg.bit_count = tx_msg.preamble_length;
+    uint32_t flipped = 0;
+    while (countBits(flipped) < num_errors) {
+      flipped |= 1u << (nextRandom() % GOLAY_CODEWORD_BITS);
+    }
+    for (uint8_t b = 0; b < GOLAY_CODEWORD_BITS; b++) {
+      if ((flipped & (1u << b)) != 0) {
+        uint16_t bit = codeword * GOLAY_CODEWORD_BITS + b;
+        rx_msg.data[bit / 8] ^= 1 << (7 - bit % 8);
+      }
+    }
+
+    if (Input_DecodeBits(&rx_msg, false) == false) {
+      failures++;
+    }
+    else if (num_errors > GOLAY_MAX_CORRECTED) {
+      failures += (rx_msg.header_rejected == false || rx_msg.preamble_received == true);
+    }
+    else {
+      uint16_t error_bits = 0;
+      ErrorCorrection_CheckLength(msg.length_bits, &error_bits);
+      failures += (rx_msg.header_rejected == true || rx_msg.preamble_received == false ||
+                   rx_msg.contents_data_type != msg.data_type ||
+                   rx_msg.data_len_bits != msg.length_bits ||
+                   rx_msg.preamble_length != tx_msg.preamble_length ||
+                   rx_msg.final_length != tx_msg.preamble_length + msg.length_bits + error_bits ||
+                   memcmp(rx_msg.data, tx_msg.data, tx_msg.preamble_length / 8) != 0);
+    }
+  }
+  printf("%u packet headers of format %u: %u failures, %u rejected\n", NUM_HEADER_TRIALS, format,
+         failures, Input_GetHeaderRejects() - rejects);
+  return failures == 0;
+}
+
+static uint8_t countBits(uint32_t value)
+{
+  uint8_t count = 0;
+  while (value != 0) {
+    value &= value - 1;
+    count++;
+  }
+  return count;
+}
+
+static uint32_t nextRandom(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
@@ -0,0 +1,231 @@
+/*
+ * test_interleaver.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Checks the block interleaver. Deinterleaving must undo interleaving for
+ *  every depth over a spread of block lengths, short last rows included.
+ *  Tracking where each bit is sent, every position must be used exactly
+ *  once, bits next to each other in a row must go out at least one less
+ *  than the rows in use apart, and the reliabilities must come back to the bits they belong to.
+ *  A packet through Packet_PrepareTx and Packet_Deinterleave at each depth
+ *  must come out as it was coded, header sent as is.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "interleaver.h"
+#include "mess_input.h"
+#include "mess_packet.h"
+#include "cfg_defaults.h"
+#include "cfg_parameters.h"
+#include "mess_main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define MAX_BITS            (PACKET_MAX_LENGTH_BYTES * 8)
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint32_t seed = 1;
+static uint8_t coded[PACKET_MAX_LENGTH_BYTES];
+static uint8_t sent[PACKET_MAX_LENGTH_BYTES];
+static uint8_t restored[PACKET_MAX_LENGTH_BYTES];
+static uint16_t sent_position[MAX_BITS];
+static int8_t llr_sent[MAX_BITS];
+static int8_t llr_restored[MAX_BITS];
+
+static const uint16_t lengths[] = {1, 7, 8, 100, 557, 1000, MAX_BITS};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool checkRoundTrips(void);
+static bool checkPositions(uint16_t num_bits, uint8_t depth);
+static bool checkPackets(uint8_t depth);
+static bool getBit(const uint8_t* bits, uint16_t position);
+static uint32_t nextRandom(void);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(void)
+{
+  bool passed = checkRoundTrips();
+
+  uint32_t failures = 0;
+  for (uint8_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+    for (uint8_t depth = MIN_INTERLEAVER_DEPTH; depth <= MAX_INTERLEAVER_DEPTH; depth += 7) {
+      failures += (checkPositions(lengths[l], depth) == false);
+    }
+  }
+  printf("positions, spread and reliabilities: %u failures\n", failures);
+  if (failures != 0) {
+    passed = false;
+  }
+
+  if (Interleaver_Interleave(coded, sent, 8, 0) == true ||
+      Interleaver_Deinterleave(sent, restored, 8, 0) == true ||
+      Interleaver_DeinterleaveLlr(llr_sent, llr_restored, 8, 0) == true) {
+    printf("a depth of 0 was accepted\n");
+    passed = false;
+  }
+
+  if (Param_Init() == false || Packet_RegisterParams() == false) {
+    printf("failed to register the packet parameters\n");
+    return 1;
+  }
+  const uint8_t depths[] = {1, 5, 13, MAX_INTERLEAVER_DEPTH};
+  for (uint8_t d = 0; d < sizeof(depths); d++) {
+    if (checkPackets(depths[d]) == false) {
+      passed = false;
+    }
+  }
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static bool checkRoundTrips(void)
+{
+  uint32_t failures = 0;
+  for (uint8_t depth = MIN_INTERLEAVER_DEPTH; depth <= MAX_INTERLEAVER_DEPTH; depth++) {
+    for (uint16_t num_bits = 1; num_bits <= MAX_BITS; num_bits += 1 + nextRandom() % 37) {
+      for (uint16_t i = 0; i < sizeof(coded); i++) {
+        coded[i] = (uint8_t) nextRandom();
+      }
+      Interleaver_Interleave(coded, sent, num_bits, depth);
+      Interleaver_Deinterleave(sent, restored, num_bits, depth);
+      for (uint16_t i = 0; i < num_bits; i++) {
+        if (getBit(restored, i) != getBit(coded, i)) {
+          failures++;
+          break;
+        }
+      }
+    }
+  }
+  printf("round trips of depths %u to %u: %u failures\n", MIN_INTERLEAVER_DEPTH,
+         MAX_INTERLEAVER_DEPTH, failures);
+  return failures == 0;
+}
+
+// Sends one bit set at a time to find where each coded bit goes out
+static bool checkPositions(uint16_t num_bits, uint8_t depth)
+{
+  static uint8_t used[MAX_BITS];
+  memset(used, 0, sizeof(used));
+  for (uint16_t k = 0; k < num_bits; k++) {
+    memset(coded, 0, sizeof(coded));
+    coded[k / 8] = 0x80 >> (k % 8);
+    Interleaver_Interleave(coded, sent, num_bits, depth);
+
+    uint16_t found = 0;
+    for (uint16_t p = 0; p < num_bits; p++) {
+      if (getBit(sent, p) == true) {
+        sent_position[k] = p;
+        used[p]++;
+        found++;
+      }
+    }
+    if (found != 1) {
+      return false;
+    }
+  }
+
+  // Rounding the columns up can leave fewer rows than depth in use
+  uint16_t num_columns = (num_bits + depth - 1) / depth;
+  uint16_t num_rows = (num_bits + num_columns - 1) / num_columns;
+  for (uint16_t k = 0; k < num_bits; k++) {
+    if (used[k] != 1) {
+      return false;
+    }
+    bool same_row = (k + 1 < num_bits) && ((k + 1) % num_columns != 0);
+    if (same_row == true && sent_position[k + 1] - sent_position[k] + 1 < num_rows) {
+      return false;
+    }
+    llr_sent[sent_position[k]] = (int8_t) (k % 128);
+  }
+
+  Interleaver_DeinterleaveLlr(llr_sent, llr_restored, num_bits, depth);
+  for (uint16_t k = 0; k < num_bits; k++) {
+    if (llr_restored[k] != (int8_t) (k % 128)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The packet as coded is the one sent with a depth of 1
+static bool checkPackets(uint8_t depth)
+{
+  uint32_t failures = 0;
+  for (uint8_t format = 0; format < NUM_PACKET_FORMATS; format++) {
+    Param_SetUint8(PARAM_PACKET_FORMAT, &format);
+    for (uint8_t l = 0; l < 8; l++) {
+      Message_t msg;
+      memset(&msg, 0, sizeof(Message_t));
+      msg.data_type = STRING;
+      msg.length_bits = (format == PACKET_FORMAT_BYTE_EXACT) ? 8 * (1 + nextRandom() % 128) : 8u << l;
+      for (uint16_t i = 0; i < msg.length_bits / 8; i++) {
+        msg.data[i] = (uint8_t) nextRandom();
+      }
+
+      static BitMessage_t reference;
+      static BitMessage_t tx_msg;
+      static BitMessage_t rx_msg;
+      static int8_t rx_llr[PACKET_MAX_LENGTH_BITS];
+      uint8_t one = 1;
+      Param_SetUint8(PARAM_INTERLEAVER_DEPTH, &one);
+      Packet_PrepareTx(&msg, &reference);
+      Param_SetUint8(PARAM_INTERLEAVER_DEPTH, &depth);
+      if (Packet_PrepareTx(&msg, &tx_msg) == false || tx_msg.bit_count != reference.bit_count ||
+          memcmp(tx_msg.data, reference.data, tx_msg.preamble_length / 8) != 0) {
+        failures++;
+        continue;
+      }
+
+      Packet_PrepareRx(&rx_msg, rx_llr);
+      for (uint16_t i = 0; i < tx_msg.bit_count; i++) {
+        bool bit = getBit(tx_msg.data, i);
+        float llr = (float) (1 + i % 31);
+        Packet_AddSoftBit(&rx_msg, bit, (bit == true) ? llr : -llr);
+      }
+      if (Input_DecodeBits(&rx_msg, false) == false || rx_msg.preamble_received == false ||
+          Packet_Deinterleave(&rx_msg) == false) {
+        failures++;
+        continue;
+      }
+      for (uint16_t i = 0; i < reference.bit_count; i++) {
+        // A bit's reliability must have moved with it
+        bool bit = getBit(rx_msg.data, i);
+        if (bit != getBit(reference.data, i) || (rx_msg.llr[i] > 0) != bit) {
+          failures++;
+          break;
+        }
+      }
+    }
+  }
+  printf("packets of depth %u: %u failures\n", depth, failures);
+  return failures == 0;
+}
+
+static bool getBit(const uint8_t* bits, uint16_t position)
+{
+  return (bits[position / 8] & (0x80 >> (position % 8))) != 0;
+}
+
+static uint32_t nextRandom(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
@@ -0,0 +1,211 @@
+/*
+ * test_reed_solomon.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Encodes random codewords with each parity length and corrupts them with
+ *  up to the number of bytes the code corrects, both scattered and as one
+ *  burst, which must all decode back to the codeword sent. One byte more
+ *  than that must never decode silently back to the codeword: the decoder
+ *  has to refuse it and leave it as received, or at worst settle on another
+ *  codeword for the CRC to catch. Encoding and decoding a full packet are
+ *  timed last.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "reed_solomon.h"
+#include "mess_main.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define NUM_TRIALS          200     // Codewords of each parity and error pattern
+#define TIMING_ITERATIONS   2000
+#define PACKET_DATA_BYTES   (PACKET_DATA_MAX_LENGTH_BYTES + 2)  // With its CRC-16
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint32_t seed = 1;
+static uint8_t sent[REED_SOLOMON_MAX_LENGTH];
+static uint8_t received[REED_SOLOMON_MAX_LENGTH];
+static uint8_t corrupted[REED_SOLOMON_MAX_LENGTH];
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool checkParity(uint8_t num_parity, uint16_t num_data);
+static void encodeRandom(uint16_t num_data, uint8_t num_parity);
+static void corrupt(uint16_t length, uint8_t num_errors, bool burst);
+static void benchPacket(uint8_t num_parity);
+static uint32_t nextRandom(void);
+static double now(void);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(void)
+{
+  const uint8_t parities[] = {2, 8, 16, 32, REED_SOLOMON_MAX_PARITY};
+
+  bool passed = true;
+  printf("%-7s %-6s %10s %10s %10s %10s\n", "parity", "length", "scattered", "burst", "refused",
+         "miscorr");
+  for (uint8_t i = 0; i < sizeof(parities); i++) {
+    if (checkParity(parities[i], PACKET_DATA_BYTES) == false ||
+        checkParity(parities[i], REED_SOLOMON_MAX_LENGTH - parities[i]) == false) {
+      passed = false;
+    }
+  }
+
+  uint8_t parity[REED_SOLOMON_MAX_PARITY];
+  uint8_t num_corrected;
+  if (ReedSolomon_Encode(sent, REED_SOLOMON_MAX_LENGTH, 2, parity) == true ||
+      ReedSolomon_Encode(sent, 10, REED_SOLOMON_MAX_PARITY + 1, parity) == true ||
+      ReedSolomon_Decode(received, REED_SOLOMON_MAX_LENGTH + 1, 2, &num_corrected) == true) {
+    printf("sizes out of range were accepted\n");
+    passed = false;
+  }
+
+  printf("%-7s %10s %10s\n", "parity", "encode us", "decode us");
+  benchPacket(2);
+  benchPacket(16);
+  benchPacket(REED_SOLOMON_MAX_PARITY);
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static bool checkParity(uint8_t num_parity, uint16_t num_data)
+{
+  uint16_t length = num_data + num_parity;
+  uint8_t correctable = num_parity / 2;
+  uint32_t failures[2] = {0, 0};
+  uint32_t refused = 0;
+  uint32_t miscorrected = 0;
+  uint32_t silent = 0;
+
+  for (uint32_t trial = 0; trial < NUM_TRIALS; trial++) {
+    // Every count of errors up to the limit, scattered and as a burst
+    for (uint8_t burst = 0; burst < 2; burst++) {
+      encodeRandom(num_data, num_parity);
+      uint8_t num_errors = trial % (correctable + 1);
+      corrupt(length, num_errors, burst == 1);
+      uint8_t num_corrected = 0;
+      if (ReedSolomon_Decode(received, length, num_parity, &num_corrected) == false ||
+          num_corrected != num_errors || memcmp(received, sent, length) != 0) {
+        failures[burst]++;
+      }
+    }
+
+    // One more than the code corrects
+    encodeRandom(num_data, num_parity);
+    corrupt(length, correctable + 1, (trial & 1) == 1);
+    uint8_t num_corrected;
+    if (ReedSolomon_Decode(received, length, num_parity, &num_corrected) == false) {
+      refused++;
+      if (memcmp(received, corrupted, length) != 0) {
+        silent++;
+      }
+    }
+    else if (memcmp(received, sent, length) == 0) {
+      silent++;
+    }
+    else {
+      miscorrected++;
+    }
+  }
+
+  printf("%-7u %-6u %10u %10u %10u %10u\n", num_parity, length, failures[0], failures[1], refused,
+         miscorrected);
+  if (failures[0] != 0 || failures[1] != 0 || silent != 0) {
+    printf("parity %u of length %u FAILED\n", num_parity, length);
+    return false;
+  }
+  return true;
+}
+
+static void encodeRandom(uint16_t num_data, uint8_t num_parity)
+{
+  for (uint16_t i = 0; i < num_data; i++) {
+    sent[i] = (uint8_t) nextRandom();
+  }
+  ReedSolomon_Encode(sent, num_data, num_parity, &sent[num_data]);
+  memcpy(received, sent, num_data + num_parity);
+}
+
+// Changes num_errors distinct bytes of the received codeword
+static void corrupt(uint16_t length, uint8_t num_errors, bool burst)
+{
+  uint16_t start = (uint16_t) (nextRandom() % (length - num_errors + 1));
+  for (uint8_t e = 0; e < num_errors; e++) {
+    uint16_t position;
+    if (burst == true) {
+      position = start + e;
+    }
+    else {
+      do {
+        position = (uint16_t) (nextRandom() % length);
+      } while (received[position] != sent[position]);
+    }
+    received[position] ^= (uint8_t) (1 + nextRandom() % 255);
+  }
+  memcpy(corrupted, received, length);
+}
+
+static void benchPacket(uint8_t num_parity)
+{
+  const uint16_t length = PACKET_DATA_BYTES + num_parity;
+  uint8_t correctable = num_parity / 2;
+  volatile uint32_t sink = 0;
+
+  encodeRandom(PACKET_DATA_BYTES, num_parity);
+  double start = now();
+  for (uint32_t it = 0; it < TIMING_ITERATIONS; it++) {
+    sent[it % PACKET_DATA_BYTES] ^= 1;
+    ReedSolomon_Encode(sent, PACKET_DATA_BYTES, num_parity, &sent[PACKET_DATA_BYTES]);
+    sink ^= sent[length - 1];
+  }
+  double encode_seconds = now() - start;
+
+  // Decoding as many errors as the code corrects is the slowest case
+  encodeRandom(PACKET_DATA_BYTES, num_parity);
+  corrupt(length, correctable, false);
+  double decode_seconds = 0.0;
+  for (uint32_t it = 0; it < TIMING_ITERATIONS; it++) {
+    memcpy(received, corrupted, length);
+    uint8_t num_corrected;
+    start = now();
+    ReedSolomon_Decode(received, length, num_parity, &num_corrected);
+    decode_seconds += now() - start;
+    sink ^= num_corrected;
+  }
+  (void) sink;
+
+  printf("%-7u %10.2f %10.2f\n", num_parity, encode_seconds * 1e6 / TIMING_ITERATIONS,
+         decode_seconds * 1e6 / TIMING_ITERATIONS);
+}
+
+static uint32_t nextRandom(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,248 @@
+/*
+ * test_sample_ring.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Stress test for the SPSC sample ring. A producer thread stands in for the
+ *  ADC interrupt and publishes numbered samples in random chunks while the
+ *  main thread consumes them. The first run throttles the producer and must
+ *  see every sample in order with no overruns, the second lets it run free
+ *  against a stalling consumer and checks that the overruns are counted and
+ *  that nothing the consumer accepted was overwritten.
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "sample_ring.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+typedef struct {
+  uint32_t samples;
+  bool throttled;         // Wait for space instead of overwriting unread samples
+  uint32_t seed;
+} ProducerConfig_t;
+
+/* Private define ------------------------------------------------------------*/
+
+#define RING_SIZE         4096
+#define MAX_CHUNK         512
+#define LOSSLESS_SAMPLES  20000000
+#define OVERRUN_SAMPLES   2000000
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint16_t ring_buffer[RING_SIZE];
+static SampleRing_t ring;
+static volatile bool producer_done = false;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool testCounterWrap(void);
+static bool testLossless(void);
+static bool testOverrun(void);
+static void* producerThread(void* arg);
+static uint32_t nextRandom(uint32_t* seed);
+
+/* Exported function definitions ---------------------------------------------*/
+
+int main(int argc, char** argv)
+{
+  (void)(argc);
+  (void)(argv);
+
+  bool passed = true;
+  if (testCounterWrap() == false) {
+    printf("counter wrap test failed\n");
+    passed = false;
+  }
+  if (testLossless() == false) {
+    printf("lossless stress test failed\n");
+    passed = false;
+  }
+  if (testOverrun() == false) {
+    printf("overrun stress test failed\n");
+    passed = false;
+  }
+  if (passed == true) {
+    printf("sample ring tests passed\n");
+  }
+  return (passed == true) ? 0 : 1;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// The counters are free running, so crossing 2^32 must not look like a lap
+static bool testCounterWrap(void)
+{
+  if (SampleRing_Init(&ring, ring_buffer, RING_SIZE, MAX_CHUNK) == false) return false;
+  ring.write_count = UINT32_MAX - 100;
+  ring.read_count = UINT32_MAX - 100;
+
+  if (SampleRing_Commit(&ring, 300) == false) return false;
+  if (SampleRing_Available(&ring) != 300) return false;
+  if (SampleRing_Resync(&ring) == true) return false;
+  SampleRing_Advance(&ring, 300);
+  if (SampleRing_Available(&ring) != 0) return false;
+
+  // Lap the reader by one chunk
+  if (SampleRing_Commit(&ring, RING_SIZE - MAX_CHUNK) == false) return false;
+  if (SampleRing_Commit(&ring, MAX_CHUNK) == true) return false;
+  if (SampleRing_GetOverruns(&ring) != 1 || SampleRing_GetLostSamples(&ring) != MAX_CHUNK) return false;
+  if (SampleRing_Commit(&ring, MAX_CHUNK) == true) return false;
+  if (SampleRing_GetOverruns(&ring) != 1 || SampleRing_GetLostSamples(&ring) != 2 * MAX_CHUNK) return false;
+  if (SampleRing_Resync(&ring) == false) return false;
+  if (SampleRing_Available(&ring) != RING_SIZE - MAX_CHUNK) return false;
+
+  // Seeking takes the nearest position in either direction
+  uint32_t index = SampleRing_GetReadIndex(&ring);
+  SampleRing_SeekIndex(&ring, (index - 100) & (RING_SIZE - 1));
+  if (SampleRing_Available(&ring) != RING_SIZE - MAX_CHUNK + 100) return false;
+  SampleRing_SeekIndex(&ring, (index + 50) & (RING_SIZE - 1));
+  return SampleRing_Available(&ring) == RING_SIZE - MAX_CHUNK - 50;
+}
+
+static bool testLossless(void)
+{
+  if (SampleRing_Init(&ring, ring_buffer, RING_SIZE, MAX_CHUNK) == false) return false;
+
+  ProducerConfig_t config = {.samples = LOSSLESS_SAMPLES, .throttled = true, .seed = 1};
+  pthread_t producer;
+  producer_done = false;
+  if (pthread_create(&producer, NULL, producerThread, &config) != 0) return false;
+
+  uint32_t expected = 0;
+  uint32_t errors = 0;
+  while (expected < LOSSLESS_SAMPLES) {
+    uint32_t available = SampleRing_Available(&ring);
+    for (uint32_t i = 0; i < available; i++) {
+      if (ring_buffer[SampleRing_GetReadIndex(&ring)] != (uint16_t) expected) {
+        errors++;
+      }
+      SampleRing_Advance(&ring, 1);
+      expected++;
+    }
+    if (available == 0) {
+      sched_yield();
+    }
+  }
+  pthread_join(producer, NULL);
+
+  printf("lossless: %u samples, %u errors, %u overruns\n", expected, errors, SampleRing_GetOverruns(&ring));
+  return errors == 0 && SampleRing_GetOverruns(&ring) == 0 && SampleRing_Available(&ring) == 0;
+}
+
+static bool testOverrun(void)
+{
+  if (SampleRing_Init(&ring, ring_buffer, RING_SIZE, MAX_CHUNK) == false) return false;
+
+  ProducerConfig_t config = {.samples = OVERRUN_SAMPLES, .throttled = false, .seed = 2};
+  pthread_t producer;
+  producer_done = false;
+  if (pthread_create(&producer, NULL, producerThread, &config) != 0) return false;
+
+  uint32_t seed = 3;
+  uint32_t verified = 0;
+  uint32_t errors = 0;
+  uint32_t resyncs = 0;
+  uint32_t skipped = 0;
+  uint32_t consumed = 0;
+  while (__atomic_load_n(&producer_done, __ATOMIC_ACQUIRE) == false || SampleRing_Available(&ring) > 0) {
+    uint32_t before = ring.read_count;
+    if (SampleRing_Resync(&ring) == true) {
+      resyncs++;
+      skipped += ring.read_count - before;
+    }
+
+    uint32_t start = ring.read_count;
+    uint32_t available = SampleRing_Available(&ring);
+    uint32_t chunk_errors = 0;
+    for (uint32_t i = 0; i < available; i++) {
+      if (ring_buffer[(start + i) & (RING_SIZE - 1)] != (uint16_t) (start + i)) {
+        chunk_errors++;
+      }
+    }
+
+    // Only samples the producer could not have reached while they were being
+    // read count, like a seqlock reader
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    uint32_t write_count = __atomic_load_n(&ring.write_count, __ATOMIC_RELAXED);
+    if (write_count - start <= ring.capacity) {
+      verified += available;
+      errors += chunk_errors;
+    }
+    SampleRing_Advance(&ring, available);
+    consumed += available;
+
+    // Stall now and then so the producer laps
+    if (nextRandom(&seed) % 8 == 0) {
+      for (volatile uint32_t spin = nextRandom(&seed) % 20000; spin > 0; spin--) {
+      }
+    }
+  }
+  pthread_join(producer, NULL);
+
+  printf("overrun: %u verified, %u errors, %u overruns, %u lost, %u resyncs, %u skipped\n",
+         verified, errors, SampleRing_GetOverruns(&ring), SampleRing_GetLostSamples(&ring), resyncs, skipped);
+
+  // Every resync follows its own overrun and every sample is either consumed
+  // or skipped
+  return errors == 0 && verified > 0 && resyncs > 0 && resyncs <= SampleRing_GetOverruns(&ring) &&
+         SampleRing_GetLostSamples(&ring) > 0 && consumed + skipped == OVERRUN_SAMPLES;
+}
+
+// Writes numbered samples ahead of write_count, at most MAX_CHUNK of them,
+// before publishing them, as the ADC DMA does with its slots
+static void* producerThread(void* arg)
+{
+  ProducerConfig_t* config = (ProducerConfig_t*) arg;
+  uint32_t written = 0;
+
+  while (written < config->samples) {
+    uint32_t chunk = 1 + nextRandom(&config->seed) % MAX_CHUNK;
+    if (chunk > config->samples - written) {
+      chunk = config->samples - written;
+    }
+    if (config->throttled == true) {
+      uint32_t read_count = __atomic_load_n(&ring.read_count, __ATOMIC_ACQUIRE);
+      while (written + chunk - read_count > ring.capacity) {
+        sched_yield();
+        read_count = __atomic_load_n(&ring.read_count, __ATOMIC_ACQUIRE);
+      }
+    }
+    for (uint32_t i = 0; i < chunk; i++) {
+      ring_buffer[(written + i) & (RING_SIZE - 1)] = (uint16_t) (written + i);
+    }
+    SampleRing_Commit(&ring, chunk);
+    written += chunk;
+
+    // Free running, pace it roughly like a sampling clock and let the
+    // consumer in now and then on single core hosts
+    if (config->throttled == false) {
+      for (volatile uint32_t spin = 4 * chunk; spin > 0; spin--) {
+      }
+      if (nextRandom(&config->seed) % 4 == 0) {
+        sched_yield();
+      }
+    }
+  }
+
+  __atomic_store_n(&producer_done, true, __ATOMIC_RELEASE);
+  return NULL;
+}
+
+static uint32_t nextRandom(uint32_t* seed)
+{
+  *seed = *seed * 1664525u + 1013904223u;
+  return *seed >> 8;
+}
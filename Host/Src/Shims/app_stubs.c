@@ -0,0 +1,110 @@
+/*
+ * app_stubs.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ *
+ *  Host replacements for the firmware modules outside the MESS pipeline
+ *  (PGA driver, USB CDC, system error routine, CubeMX globals).
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "stm32h7xx_hal.h"
+#include "cmsis_os.h"
+#include "usb_comm.h"
+#include "sys_error.h"
+#include "sim_hal.h"
+#include "PGA113-driver.h"
+#include "main.h"
+#include <stdio.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+osEventFlagsId_t print_event_handle = NULL;
+osSemaphoreId_t usbSemaphoreHandle = NULL;
+
+static uint8_t pga_gain = PGA_GAIN_1;
+static uint32_t error_count = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+
+
+
+/* Exported function definitions ---------------------------------------------*/
+
+void Error_Routine(ErrorCodes_t error_code)
+{
+  error_count++;
+  fprintf(stderr, "Error_Routine(%d)\n", (int) error_code);
+}
+
+void Error_Handler(void)
+{
+  Error_Routine(ERROR_OTHER);
+}
+
+uint32_t SimHal_GetErrorCount(void)
+{
+  return error_count;
+}
+
+uint8_t CDC_Transmit_HS(uint8_t* Buf, uint16_t Len)
+{
+  fwrite(Buf, 1, Len, stdout);
+  return 0;
+}
+
+HAL_StatusTypeDef PGA_Init()
+{
+  return HAL_OK;
+}
+
+void PGA_SetGain(PGA_Gain_t gain)
+{
+  pga_gain = gain;
+}
+
+HAL_StatusTypeDef PGA_Read()
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef PGA_Update()
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef PGA_Shutdown()
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef PGA_Enable()
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef PGA_Status()
+{
+  return HAL_OK;
+}
+
+uint8_t PGA_GetGain()
+{
+  return pga_gain;
+}
+
+/* Private function definitions ----------------------------------------------*/
@@ -0,0 +1,243 @@
+/*
+ * arm_math_shim.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+
+
+/* Private define ------------------------------------------------------------*/
+
+#define MAX_FFT_LENGTH      4096
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static float32_t scratch[2 * MAX_FFT_LENGTH];
+static float32_t twiddle[MAX_FFT_LENGTH];  // cos/sin pairs for MAX_FFT_LENGTH / 2 angles
+static bool twiddle_ready = false;
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len16   = {16, NULL, NULL, 0};
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len32   = {32, NULL, NULL, 0};
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len64   = {64, NULL, NULL, 0};
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len128  = {128, NULL, NULL, 0};
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len256  = {256, NULL, NULL, 0};
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len512  = {512, NULL, NULL, 0};
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024 = {1024, NULL, NULL, 0};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void complexFft(float32_t* data, uint16_t length, bool inverse);
+
+/* Exported function definitions ---------------------------------------------*/
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32* S, uint16_t fftLen)
+{
+  if (S == NULL || fftLen < 32 || fftLen > MAX_FFT_LENGTH || (fftLen & (fftLen - 1)) != 0) {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+  S->fftLenRFFT = fftLen;
+  S->Sint.fftLen = fftLen / 2;
+  S->Sint.pTwiddle = NULL;
+  S->Sint.pBitRevTable = NULL;
+  S->Sint.bitRevLength = 0;
+  S->pTwiddleRFFT = NULL;
+  return ARM_MATH_SUCCESS;
+}
+
+arm_status arm_rfft_64_fast_init_f32(arm_rfft_fast_instance_f32* S)
+{
+  return arm_rfft_fast_init_f32(S, 64);
+}
+
+// Packed format as CMSIS: [X0.re, X(N/2).re, X1.re, X1.im, ..., X(N/2-1).re, X(N/2-1).im]
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32* S, float32_t* p, float32_t* pOut, uint8_t ifftFlag)
+{
+  uint16_t n = S->fftLenRFFT;
+
+  if (ifftFlag == 0) {
+    for (uint16_t i = 0; i < n; i++) {
+      scratch[2 * i] = p[i];
+      scratch[2 * i + 1] = 0.0f;
+    }
+    complexFft(scratch, n, false);
+    pOut[0] = scratch[0];
+    pOut[1] = scratch[n];
+    for (uint16_t k = 1; k < n / 2; k++) {
+      pOut[2 * k] = scratch[2 * k];
+      pOut[2 * k + 1] = scratch[2 * k + 1];
+    }
+  }
+  else {
+    scratch[0] = p[0];
+    scratch[1] = 0.0f;
+    scratch[n] = p[1];
+    scratch[n + 1] = 0.0f;
+    for (uint16_t k = 1; k < n / 2; k++) {
+      scratch[2 * k] = p[2 * k];
+      scratch[2 * k + 1] = p[2 * k + 1];
+      scratch[2 * (n - k)] = p[2 * k];
+      scratch[2 * (n - k) + 1] = -p[2 * k + 1];
+    }
+    complexFft(scratch, n, true);
+    for (uint16_t i = 0; i < n; i++) {
+      pOut[i] = scratch[2 * i];
+    }
+  }
+}
+
+// Output is always in natural order regardless of bitReverseFlag
+void arm_cfft_f32(const arm_cfft_instance_f32* S, float32_t* p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+  (void)(bitReverseFlag);
+  complexFft(p1, S->fftLen, ifftFlag != 0);
+}
+
+void arm_cmplx_mag_squared_f32(const float32_t* pSrc, float32_t* pDst, uint32_t numSamples)
+{
+  for (uint32_t i = 0; i < numSamples; i++) {
+    float32_t real = pSrc[2 * i];
+    float32_t imag = pSrc[2 * i + 1];
+    pDst[i] = real * real + imag * imag;
+  }
+}
+
+void arm_cmplx_mult_cmplx_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t numSamples)
+{
+  for (uint32_t i = 0; i < numSamples; i++) {
+    float32_t a = pSrcA[2 * i];
+    float32_t b = pSrcA[2 * i + 1];
+    float32_t c = pSrcB[2 * i];
+    float32_t d = pSrcB[2 * i + 1];
+    pDst[2 * i] = a * c - b * d;
+    pDst[2 * i + 1] = a * d + b * c;
+  }
+}
+
+void arm_cmplx_conj_f32(const float32_t* pSrc, float32_t* pDst, uint32_t numSamples)
+{
+  for (uint32_t i = 0; i < numSamples; i++) {
+    pDst[2 * i] = pSrc[2 * i];
+    pDst[2 * i + 1] = -pSrc[2 * i + 1];
+  }
+}
+
+void arm_mean_f32(const float32_t* pSrc, uint32_t blockSize, float32_t* pResult)
+{
+  float32_t sum = 0.0f;
+  for (uint32_t i = 0; i < blockSize; i++) {
+    sum += pSrc[i];
+  }
+  *pResult = sum / (float32_t) blockSize;
+}
+
+void arm_max_f32(const float32_t* pSrc, uint32_t blockSize, float32_t* pResult, uint32_t* pIndex)
+{
+  float32_t max_value = pSrc[0];
+  uint32_t max_index = 0;
+  for (uint32_t i = 1; i < blockSize; i++) {
+    if (pSrc[i] > max_value) {
+      max_value = pSrc[i];
+      max_index = i;
+    }
+  }
+  *pResult = max_value;
+  *pIndex = max_index;
+}
+
+void arm_dot_prod_f32(const float32_t* pSrcA, const float32_t* pSrcB, uint32_t blockSize, float32_t* result)
+{
+  float32_t sum = 0.0f;
+  for (uint32_t i = 0; i < blockSize; i++) {
+    sum += pSrcA[i] * pSrcB[i];
+  }
+  *result = sum;
+}
+
+float32_t arm_sin_f32(float32_t x)
+{
+  return sinf(x);
+}
+
+float32_t arm_cos_f32(float32_t x)
+{
+  return cosf(x);
+}
+
+arm_status arm_sqrt_f32(float32_t in, float32_t* pOut)
+{
+  if (in < 0.0f) {
+    *pOut = 0.0f;
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+  *pOut = sqrtf(in);
+  return ARM_MATH_SUCCESS;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+// Iterative radix-2 FFT on interleaved complex data. The inverse is scaled by
+// 1/length to match CMSIS-DSP.
+static void complexFft(float32_t* data, uint16_t length, bool inverse)
+{
+  for (uint16_t i = 1, j = 0; i < length; i++) {
+    uint16_t bit = length >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      float32_t temp_re = data[2 * i];
+      float32_t temp_im = data[2 * i + 1];
+      data[2 * i] = data[2 * j];
+      data[2 * i + 1] = data[2 * j + 1];
+      data[2 * j] = temp_re;
+      data[2 * j + 1] = temp_im;
+    }
+  }
+
+  if (twiddle_ready == false) {
+    for (uint16_t k = 0; k < MAX_FFT_LENGTH / 2; k++) {
+      twiddle[2 * k] = (float32_t) cos(2.0 * M_PI * k / MAX_FFT_LENGTH);
+      twiddle[2 * k + 1] = (float32_t) -sin(2.0 * M_PI * k / MAX_FFT_LENGTH);
+    }
+    twiddle_ready = true;
+  }
+
+  for (uint16_t len = 2; len <= length; len <<= 1) {
+    uint16_t stride = MAX_FFT_LENGTH / len;
+    for (uint16_t i = 0; i < length; i += len) {
+      for (uint16_t k = 0; k < len / 2; k++) {
+        float32_t w_re = twiddle[2 * k * stride];
+        float32_t w_im = (inverse == true) ? -twiddle[2 * k * stride + 1] : twiddle[2 * k * stride + 1];
+        uint16_t a = i + k;
+        uint16_t b = i + k + len / 2;
+        float32_t t_re = data[2 * b] * w_re - data[2 * b + 1] * w_im;
+        float32_t t_im = data[2 * b] * w_im + data[2 * b + 1] * w_re;
+        data[2 * b] = data[2 * a] - t_re;
+        data[2 * b + 1] = data[2 * a + 1] - t_im;
+        data[2 * a] += t_re;
+        data[2 * a + 1] += t_im;
+      }
+    }
+  }
+
+  if (inverse == true) {
+    for (uint16_t i = 0; i < 2 * length; i++) {
+      data[i] /= (float32_t) length;
+    }
+  }
+}
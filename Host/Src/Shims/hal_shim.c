@@ -0,0 +1,353 @@
+/*
+ * hal_shim.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "stm32h7xx_hal.h"
+#include "sim_hal.h"
+#include "cmsis_os.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+typedef struct {
+  uint16_t* buffer;
+  uint32_t length;
+  uint32_t position;
+  bool running;
+  bool double_buffer;
+  uint16_t* memory[2];    // Double-buffer targets, the DMA fills memory[target]
+  uint8_t target;
+} AdcDma_t;
+
+typedef struct {
+  const uint32_t* buffer;
+  uint32_t length;
+  uint32_t position;
+  bool running;
+  uint32_t value;
+} DacDma_t;
+
+/* Private define ------------------------------------------------------------*/
+
+
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+GPIO_TypeDef sim_gpio_ports[5];
+
+DMA_HandleTypeDef hdma_adc1 = {.instance = 1, .Parent = &hadc1};
+DMA_HandleTypeDef hdma_adc3 = {.instance = 3, .Parent = &hadc3};
+
+ADC_TypeDef sim_adc_registers[2];
+
+ADC_HandleTypeDef hadc1 = {.instance = 1, .Instance = ADC1, .DMA_Handle = &hdma_adc1};
+ADC_HandleTypeDef hadc3 = {.instance = 3, .Instance = ADC3, .DMA_Handle = &hdma_adc3};
+DAC_HandleTypeDef hdac1 = {.instance = 1};
+TIM_HandleTypeDef htim6 = {.instance = 6};
+TIM_HandleTypeDef htim8 = {.instance = 8};
+
+static AdcDma_t adc_dma[2];
+static DacDma_t dac_dma[2];
+
+/* Private function prototypes -----------------------------------------------*/
+
+static AdcDma_t* getAdcDma(ADC_HandleTypeDef* hadc);
+static ADC_HandleTypeDef* getDmaAdc(DMA_HandleTypeDef* hdma);
+static uint16_t* dmaAddress(uint32_t address);
+static DacDma_t* getDacDma(uint32_t channel);
+
+/* Exported function definitions ---------------------------------------------*/
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+  if (PinState == GPIO_PIN_SET) {
+    GPIOx->ODR |= GPIO_Pin;
+  }
+  else {
+    GPIOx->ODR &= ~((uint32_t) GPIO_Pin);
+  }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+  return ((GPIOx->ODR & GPIO_Pin) != 0) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+uint32_t HAL_GetTick(void)
+{
+  return osKernelGetTickCount();
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef* htim)
+{
+  (void)(htim);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef* htim)
+{
+  (void)(htim);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef* hadc, uint32_t* pData, uint32_t Length)
+{
+  AdcDma_t* dma = getAdcDma(hadc);
+  if (dma == NULL || pData == NULL || Length < 2) {
+    return HAL_ERROR;
+  }
+  dma->buffer = (uint16_t*) pData;
+  dma->length = Length;
+  dma->position = 0;
+  dma->running = true;
+  dma->double_buffer = false;
+  return HAL_OK;
+}
+
+// The DMA is set up separately in double-buffer mode, conversions just start
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef* hadc)
+{
+  return (getAdcDma(hadc) != NULL) ? HAL_OK : HAL_ERROR;
+}
+
+void LL_ADC_REG_SetDMATransferMode(ADC_TypeDef* ADCx, uint32_t DMATransfer)
+{
+  ADCx->CFGR = (ADCx->CFGR & ~0x3U) | DMATransfer;
+}
+
+void LL_ADC_EnableDMAReq(ADC_TypeDef* ADCx)
+{
+  ADCx->CFGR |= 0x1U;
+}
+
+void LL_ADC_REG_SetDataTransferMode(ADC_TypeDef* ADCx, uint32_t DataTransferMode)
+{
+  ADCx->CFGR = (ADCx->CFGR & ~0x3U) | DataTransferMode;
+}
+
+// Same as the HAL, which HAL_ADC_Start_DMA installs as the DMA error callback
+void ADC_DMAError(DMA_HandleTypeDef* hdma)
+{
+  ADC_HandleTypeDef* hadc = (ADC_HandleTypeDef*) hdma->Parent;
+  hadc->ErrorCode |= HAL_ADC_ERROR_DMA;
+  HAL_ADC_ErrorCallback(hadc);
+}
+
+HAL_StatusTypeDef HAL_DMAEx_MultiBufferStart_IT(DMA_HandleTypeDef* hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                                uint32_t SecondMemAddress, uint32_t DataLength)
+{
+  (void)(SrcAddress);
+  AdcDma_t* dma = getAdcDma(getDmaAdc(hdma));
+  if (dma == NULL || DataLength == 0 || hdma->XferCpltCallback == NULL || hdma->XferM1CpltCallback == NULL) {
+    return HAL_ERROR;
+  }
+  dma->memory[0] = dmaAddress(DstAddress);
+  dma->memory[1] = dmaAddress(SecondMemAddress);
+  dma->target = 0;
+  dma->length = DataLength;
+  dma->position = 0;
+  dma->running = true;
+  dma->double_buffer = true;
+  return HAL_OK;
+}
+
+// Like the stream hardware, the register the DMA is currently filling cannot
+// be changed
+HAL_StatusTypeDef HAL_DMAEx_ChangeMemory(DMA_HandleTypeDef* hdma, uint32_t Address, HAL_DMA_MemoryTypeDef memory)
+{
+  AdcDma_t* dma = getAdcDma(getDmaAdc(hdma));
+  if (dma == NULL || dma->double_buffer == false || memory == dma->target) {
+    return HAL_ERROR;
+  }
+  dma->memory[memory] = dmaAddress(Address);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef* hadc)
+{
+  AdcDma_t* dma = getAdcDma(hadc);
+  if (dma == NULL) {
+    return HAL_ERROR;
+  }
+  dma->running = false;
+  dma->double_buffer = false;
+  __HAL_ADC_DISABLE_IT(hadc, ADC_IT_OVR);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DAC_Start(DAC_HandleTypeDef* hdac, uint32_t Channel)
+{
+  (void)(hdac);
+  return (getDacDma(Channel) != NULL) ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_DAC_Stop(DAC_HandleTypeDef* hdac, uint32_t Channel)
+{
+  (void)(hdac);
+  return (getDacDma(Channel) != NULL) ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_DAC_SetValue(DAC_HandleTypeDef* hdac, uint32_t Channel, uint32_t Alignment, uint32_t Data)
+{
+  (void)(hdac);
+  (void)(Alignment);
+  DacDma_t* dma = getDacDma(Channel);
+  if (dma == NULL) {
+    return HAL_ERROR;
+  }
+  dma->value = Data;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DAC_Start_DMA(DAC_HandleTypeDef* hdac, uint32_t Channel, const uint32_t* pData,
+                                    uint32_t Length, uint32_t Alignment)
+{
+  (void)(hdac);
+  (void)(Alignment);
+  DacDma_t* dma = getDacDma(Channel);
+  if (dma == NULL || pData == NULL || Length < 2) {
+    return HAL_ERROR;
+  }
+  dma->buffer = pData;
+  dma->length = Length;
+  dma->position = 0;
+  dma->running = true;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DAC_Stop_DMA(DAC_HandleTypeDef* hdac, uint32_t Channel)
+{
+  (void)(hdac);
+  DacDma_t* dma = getDacDma(Channel);
+  if (dma == NULL) {
+    return HAL_ERROR;
+  }
+  dma->running = false;
+  return HAL_OK;
+}
+
+bool SimHal_AdcPushSample(ADC_HandleTypeDef* hadc, uint16_t sample)
+{
+  AdcDma_t* dma = getAdcDma(hadc);
+  if (dma == NULL || dma->running == false) {
+    return false;
+  }
+
+  if (dma->double_buffer == true) {
+    DMA_HandleTypeDef* hdma = hadc->DMA_Handle;
+    dma->memory[dma->target][dma->position++] = sample;
+    if (dma->position == dma->length) {
+      // The stream switches registers before raising the interrupt
+      uint8_t completed = dma->target;
+      dma->position = 0;
+      dma->target ^= 1;
+      if (completed == MEMORY0) {
+        hdma->XferCpltCallback(hdma);
+      }
+      else {
+        hdma->XferM1CpltCallback(hdma);
+      }
+    }
+    return true;
+  }
+
+  dma->buffer[dma->position++] = sample;
+
+  if (dma->position == dma->length / 2) {
+    HAL_ADC_ConvHalfCpltCallback(hadc);
+  }
+  else if (dma->position == dma->length) {
+    dma->position = 0;
+    HAL_ADC_ConvCpltCallback(hadc);
+  }
+  return true;
+}
+
+bool SimHal_DacPullSample(uint32_t channel, uint16_t* sample)
+{
+  DacDma_t* dma = getDacDma(channel);
+  if (dma == NULL || dma->running == false) {
+    return false;
+  }
+
+  dma->value = dma->buffer[dma->position++];
+  *sample = (uint16_t) dma->value;
+
+  if (dma->position == dma->length / 2) {
+    if (channel == DAC_CHANNEL_1) {
+      HAL_DAC_ConvHalfCpltCallbackCh1(&hdac1);
+    }
+    else {
+      HAL_DACEx_ConvHalfCpltCallbackCh2(&hdac1);
+    }
+  }
+  else if (dma->position == dma->length) {
+    dma->position = 0;
+    if (channel == DAC_CHANNEL_1) {
+      HAL_DAC_ConvCpltCallbackCh1(&hdac1);
+    }
+    else {
+      HAL_DACEx_ConvCpltCallbackCh2(&hdac1);
+    }
+  }
+  return true;
+}
+
+bool SimHal_IsDacRunning(uint32_t channel)
+{
+  DacDma_t* dma = getDacDma(channel);
+  return (dma != NULL) && (dma->running == true);
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static AdcDma_t* getAdcDma(ADC_HandleTypeDef* hadc)
+{
+  if (hadc == &hadc1) {
+    return &adc_dma[0];
+  }
+  if (hadc == &hadc3) {
+    return &adc_dma[1];
+  }
+  return NULL;
+}
+
+static ADC_HandleTypeDef* getDmaAdc(DMA_HandleTypeDef* hdma)
+{
+  if (hdma == hadc1.DMA_Handle) {
+    return &hadc1;
+  }
+  if (hdma == hadc3.DMA_Handle) {
+    return &hadc3;
+  }
+  return NULL;
+}
+
+// DMA addresses are 32 bits wide on the target. Host data lives in one image
+// well inside a 4 GiB window, so the upper half is restored from a static
+static uint16_t* dmaAddress(uint32_t address)
+{
+  uintptr_t base = (uintptr_t) &sim_adc_registers & ~(uintptr_t) UINT32_MAX;
+  return (uint16_t*) (base | address);
+}
+
+static DacDma_t* getDacDma(uint32_t channel)
+{
+  switch (channel) {
+    case DAC_CHANNEL_1:
+      return &dac_dma[0];
+    case DAC_CHANNEL_2:
+      return &dac_dma[1];
+    default:
+      return NULL;
+  }
+}
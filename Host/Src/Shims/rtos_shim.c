@@ -0,0 +1,313 @@
+/*
+ * rtos_shim.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: ericv
+ */
+
+/* Private includes ----------------------------------------------------------*/
+
+#include "cmsis_os.h"
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "semphr.h"
+#include "sim_hal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+typedef struct {
+  uint32_t flags;
+} EventFlags_t;
+
+struct QueueDefinition {
+  uint8_t* storage;
+  UBaseType_t length;
+  UBaseType_t item_size;
+  UBaseType_t head;
+  UBaseType_t count;
+};
+
+/* Private define ------------------------------------------------------------*/
+
+#define MAX_EVENT_FLAGS     8
+
+/* Private macro -------------------------------------------------------------*/
+
+
+
+/* Private variables ---------------------------------------------------------*/
+
+static volatile uint32_t kernel_tick = 0;
+
+static void (*tick_hook)(void) = NULL;
+static bool in_tick_hook = false;
+static bool in_blocking_wait = false;
+static uint32_t task_wakeups = 0;   // Times a task call that can block returned
+
+static EventFlags_t event_flags[MAX_EVENT_FLAGS];
+static uint8_t event_flags_count = 0;
+
+// The MESS task is the only thread on the host, so it owns the only flags
+static EventFlags_t thread_flags;
+
+// Every mutex and semaphore shares one token since nothing ever contends
+static uint8_t sync_token;
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool checkFlags(const EventFlags_t* ef, uint32_t flags, uint32_t options);
+static uint32_t waitFlags(EventFlags_t* ef, uint32_t flags, uint32_t options, uint32_t timeout);
+
+
+/* Exported function definitions ---------------------------------------------*/
+
+osStatus_t osDelay(uint32_t ticks)
+{
+  if (in_tick_hook == false && in_blocking_wait == false) {
+    task_wakeups++;
+  }
+  for (uint32_t i = 0; i < ticks; i++) {
+    kernel_tick++;
+    if (tick_hook != NULL && in_tick_hook == false) {
+      in_tick_hook = true;
+      tick_hook();
+      in_tick_hook = false;
+    }
+  }
+  return osOK;
+}
+
+uint32_t osKernelGetTickCount(void)
+{
+  return kernel_tick;
+}
+
+void SimHal_SetTickHook(void (*hook)(void))
+{
+  tick_hook = hook;
+}
+
+uint32_t SimHal_GetTaskWakeups(void)
+{
+  return task_wakeups;
+}
+
+osEventFlagsId_t osEventFlagsNew(const osEventFlagsAttr_t* attr)
+{
+  (void)(attr);
+  if (event_flags_count >= MAX_EVENT_FLAGS) {
+    return NULL;
+  }
+  EventFlags_t* ef = &event_flags[event_flags_count++];
+  ef->flags = 0;
+  return ef;
+}
+
+uint32_t osEventFlagsSet(osEventFlagsId_t ef_id, uint32_t flags)
+{
+  if (ef_id == NULL) {
+    return osFlagsErrorParameter;
+  }
+  EventFlags_t* ef = (EventFlags_t*) ef_id;
+  ef->flags |= flags;
+  return ef->flags;
+}
+
+uint32_t osEventFlagsClear(osEventFlagsId_t ef_id, uint32_t flags)
+{
+  if (ef_id == NULL) {
+    return osFlagsErrorParameter;
+  }
+  EventFlags_t* ef = (EventFlags_t*) ef_id;
+  uint32_t previous = ef->flags;
+  ef->flags &= ~flags;
+  return previous;
+}
+
+uint32_t osEventFlagsGet(osEventFlagsId_t ef_id)
+{
+  if (ef_id == NULL) {
+    return 0;
+  }
+  return ((EventFlags_t*) ef_id)->flags;
+}
+
+uint32_t osEventFlagsWait(osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout)
+{
+  if (ef_id == NULL) {
+    return osFlagsErrorParameter;
+  }
+  return waitFlags((EventFlags_t*) ef_id, flags, options, timeout);
+}
+
+osThreadId_t osThreadGetId(void)
+{
+  return &thread_flags;
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
+{
+  if (thread_id == NULL) {
+    return osFlagsErrorParameter;
+  }
+  EventFlags_t* ef = (EventFlags_t*) thread_id;
+  ef->flags |= flags;
+  return ef->flags;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout)
+{
+  return waitFlags(&thread_flags, flags, options, timeout);
+}
+
+osMutexId_t osMutexNew(const osMutexAttr_t* attr)
+{
+  (void)(attr);
+  return &sync_token;
+}
+
+osStatus_t osMutexAcquire(osMutexId_t mutex_id, uint32_t timeout)
+{
+  (void)(timeout);
+  return (mutex_id != NULL) ? osOK : osErrorParameter;
+}
+
+osStatus_t osMutexRelease(osMutexId_t mutex_id)
+{
+  return (mutex_id != NULL) ? osOK : osErrorParameter;
+}
+
+osSemaphoreId_t osSemaphoreNew(uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t* attr)
+{
+  (void)(max_count);
+  (void)(initial_count);
+  (void)(attr);
+  return &sync_token;
+}
+
+osStatus_t osSemaphoreAcquire(osSemaphoreId_t semaphore_id, uint32_t timeout)
+{
+  (void)(semaphore_id);
+  (void)(timeout);
+  return osOK;
+}
+
+osStatus_t osSemaphoreRelease(osSemaphoreId_t semaphore_id)
+{
+  (void)(semaphore_id);
+  return osOK;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime)
+{
+  (void)(xSemaphore);
+  (void)(xBlockTime);
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+  (void)(xSemaphore);
+  return pdTRUE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize)
+{
+  QueueHandle_t queue = calloc(1, sizeof(struct QueueDefinition));
+  if (queue == NULL) {
+    return NULL;
+  }
+  queue->storage = calloc(uxQueueLength, uxItemSize);
+  if (queue->storage == NULL) {
+    free(queue);
+    return NULL;
+  }
+  queue->length = uxQueueLength;
+  queue->item_size = uxItemSize;
+  return queue;
+}
+
+void vQueueDelete(QueueHandle_t xQueue)
+{
+  if (xQueue == NULL) {
+    return;
+  }
+  free(xQueue->storage);
+  free(xQueue);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t xQueue, const void* pvItemToQueue, TickType_t xTicksToWait)
+{
+  (void)(xTicksToWait);
+  if (xQueue == NULL || xQueue->count >= xQueue->length) {
+    return errQUEUE_FULL;
+  }
+  UBaseType_t tail = (xQueue->head + xQueue->count) % xQueue->length;
+  memcpy(&xQueue->storage[tail * xQueue->item_size], pvItemToQueue, xQueue->item_size);
+  xQueue->count++;
+  return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void* pvBuffer, TickType_t xTicksToWait)
+{
+  if (xQueuePeek(xQueue, pvBuffer, xTicksToWait) == pdFAIL) {
+    return pdFAIL;
+  }
+  xQueue->head = (xQueue->head + 1) % xQueue->length;
+  xQueue->count--;
+  return pdPASS;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t xQueue, void* pvBuffer, TickType_t xTicksToWait)
+{
+  (void)(xTicksToWait);
+  if (xQueue == NULL || xQueue->count == 0) {
+    return pdFAIL;
+  }
+  memcpy(pvBuffer, &xQueue->storage[xQueue->head * xQueue->item_size], xQueue->item_size);
+  return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t xQueue)
+{
+  return (xQueue != NULL) ? xQueue->count : 0;
+}
+
+/* Private function definitions ----------------------------------------------*/
+
+static bool checkFlags(const EventFlags_t* ef, uint32_t flags, uint32_t options)
+{
+  uint32_t matched = ef->flags & flags;
+  return ((options & osFlagsWaitAll) != 0) ? (matched == flags) : (matched != 0);
+}
+
+// Blocking waits let simulated time pass through the tick hook, which is the
+// only other context that can set the flags on the host
+static uint32_t waitFlags(EventFlags_t* ef, uint32_t flags, uint32_t options, uint32_t timeout)
+{
+  uint32_t waited = 0;
+
+  if (timeout != 0 && in_tick_hook == false) {
+    task_wakeups++;
+  }
+  while (checkFlags(ef, flags, options) == false) {
+    if (timeout == 0) {
+      return osFlagsErrorResource;
+    }
+    if ((timeout != osWaitForever && waited >= timeout) || in_tick_hook == true) {
+      return osFlagsErrorTimeout;
+    }
+    in_blocking_wait = true;
+    osDelay(1);
+    in_blocking_wait = false;
+    waited++;
+  }
+
+  uint32_t current = ef->flags;
+  if ((options & osFlagsNoClear) == 0) {
+    ef->flags &= ~flags;
+  }
+  return current;
+}